@@ -3,6 +3,7 @@
 #define GLFW_INCLUDE_NONE
 #include "ImGuiNotify.hpp"
 #include <GLFW/glfw3.h>
+#include <filesystem>
 #include <imgui.h>
 #include <nfd.hpp>
 #include <spdlog/spdlog.h>
@@ -102,6 +103,9 @@ void Application::initializeUIComponents() {
   // Wire persistence: load custom brushes from AppData
   brush_system_->setConfigService(&settings_registry_->getConfig());
 
+  // Auto-border rules ship with the sample data next to the executable
+  brush_system_->loadBorderRules(std::filesystem::current_path() / "data");
+
   UIFactoryContext ctx{
       .view_settings = settings_registry_->getViewSettings(),
       .selection_settings = settings_registry_->getSelectionSettings(),
@@ -391,6 +395,11 @@ void Application::onUpdateEditor() {
         version_manager_.getClientData(), *ui_.map_panel);
   }
 
+  // Deliver async map search results and track the search origin
+  if (ui_.search_controller && ui_.map_panel) {
+    ui_.search_controller->update(ui_.map_panel->getCameraCenter());
+  }
+
   // NOTE: MapCompatibilityPopup is rendered in
   // RenderOrchestrator::renderDialogs() ImGui rendering must happen during
   // render phase (between newFrame and Render)
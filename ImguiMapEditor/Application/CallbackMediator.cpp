@@ -55,9 +55,10 @@ void CallbackMediator::wireAll(Context &ctx) {
 void CallbackMediator::wireInputCallbacks(Context &ctx) {
   if (ctx.input_controller) {
     ctx.input_controller->setOpenItemPropertiesCallback(
-        [main_window = ctx.main_window](Domain::Item *item) {
+        [main_window = ctx.main_window](Domain::Item *item,
+                                        const Domain::Position &pos) {
           if (main_window) {
-            main_window->openPropertiesDialog(item);
+            main_window->openPropertiesDialog(item, pos);
           }
         });
     ctx.input_controller->setOpenSpawnPropertiesCallback(
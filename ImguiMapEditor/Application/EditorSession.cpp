@@ -1,8 +1,15 @@
 #include "EditorSession.h"
 #include "../Application.h" // For accessing RenderingManager singleton/service if needed, simplified here
 #include "Rendering/Frame/RenderingManager.h"
+#include "Brushes/Behaviors/AutoBorderer.h"
 #include "Services/ClientDataService.h"
 #include "Services/Preview/PastePreviewProvider.h"
+#include "Core/Config.h"
+#include "Domain/ChunkedMap.h"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <unordered_map>
 
 namespace MapEditor::AppLogic {
 
@@ -71,6 +78,17 @@ void EditorSession::confirmPaste(const Domain::Position &target_pos,
   std::string op_name = replace_mode ? "Paste (Replace)" : "Paste tiles";
   history_manager.beginOperation(op_name, Domain::History::ActionType::Other, &selection_service);
 
+  // Large pastes record regions instead of a snapshot per tile
+  const bool bulk =
+      paste_preview_.size() >= Config::Performance::BULK_HISTORY_MIN_TILES;
+  if (bulk) {
+    recordPasteRegions(target_pos);
+  }
+
+  // Pasted positions, re-bordered in one batch after the paste
+  const bool auto_border = auto_border_ && auto_border_->hasRules();
+  std::vector<Domain::Position> pasted_positions;
+
   // Apply paste directly, recording tile states for undo/redo
   for (const auto &ct : paste_preview_) {
     // Calculate world position
@@ -85,10 +103,12 @@ void EditorSession::confirmPaste(const Domain::Position &target_pos,
     }
 
     // Record BEFORE state
-    history_manager.recordTileBefore(world_pos, map->getTile(world_pos));
+    Domain::Tile *target_tile = map->getTile(world_pos);
+    if (!bulk) {
+      history_manager.recordTileBefore(world_pos, target_tile);
+    }
 
     // Get or create target tile
-    Domain::Tile *target_tile = map->getTile(world_pos);
     if (!target_tile) {
       auto new_tile = std::make_unique<Domain::Tile>(world_pos);
       map->setTile(world_pos, std::move(new_tile));
@@ -98,6 +118,10 @@ void EditorSession::confirmPaste(const Domain::Position &target_pos,
     if (!target_tile || !ct.tile)
       continue;
 
+    if (auto_border) {
+      pasted_positions.push_back(world_pos);
+    }
+
     // REPLACE MODE: Clear destination tile first
     if (replace_mode) {
       target_tile->clearItems();
@@ -141,6 +165,10 @@ void EditorSession::confirmPaste(const Domain::Position &target_pos,
     }
   }
 
+  if (auto_border) {
+    auto_border_->resolve(*map, pasted_positions, &history_manager);
+  }
+
   // End operation (captures AFTER states including selection)
   history_manager.endOperation(map, &selection_service);
   document_->setModified(true);
@@ -149,4 +177,85 @@ void EditorSession::confirmPaste(const Domain::Position &target_pos,
   cancelPaste();
 }
 
+void EditorSession::recordPasteRegions(const Domain::Position &target_pos) {
+  auto *map = document_->getMap();
+  auto &history_manager = document_->getHistoryManager();
+
+  struct Bounds {
+    int32_t min_x = std::numeric_limits<int32_t>::max();
+    int32_t min_y = std::numeric_limits<int32_t>::max();
+    int32_t max_x = std::numeric_limits<int32_t>::min();
+    int32_t max_y = std::numeric_limits<int32_t>::min();
+    size_t tiles = 0;
+
+    void add(int32_t x, int32_t y) {
+      min_x = std::min(min_x, x);
+      min_y = std::min(min_y, y);
+      max_x = std::max(max_x, x);
+      max_y = std::max(max_y, y);
+      ++tiles;
+    }
+    // A scattered footprint would snapshot every tile between its parts
+    bool dense() const {
+      return static_cast<size_t>(max_x - min_x + 1) *
+                 static_cast<size_t>(max_y - min_y + 1) <=
+             tiles * 2;
+    }
+  };
+  std::array<Bounds, Domain::ChunkedMap::FLOOR_COUNT> floors{};
+
+  auto forEachTarget = [&](auto &&callback) {
+    for (const auto &ct : paste_preview_) {
+      const Domain::Position pos{
+          target_pos.x + ct.relative_pos.x, target_pos.y + ct.relative_pos.y,
+          static_cast<int16_t>(target_pos.z + ct.relative_pos.z)};
+      if (pos.x < 0 || pos.y < 0 || pos.z < Domain::ChunkedMap::FLOOR_MIN ||
+          pos.z > Domain::ChunkedMap::FLOOR_MAX) {
+        continue;
+      }
+      callback(pos);
+    }
+  };
+
+  forEachTarget([&](const Domain::Position &pos) {
+    floors[pos.z - Domain::ChunkedMap::FLOOR_MIN].add(pos.x, pos.y);
+  });
+
+  // Sparse floors fall back to a region per dense chunk, tile snapshots
+  // elsewhere (as fillArea does)
+  std::unordered_map<uint64_t, Bounds> chunks;
+  auto chunkKey = [](const Domain::Position &pos) {
+    constexpr int32_t SIZE = Domain::Chunk::SIZE;
+    return Domain::Position(pos.x / SIZE * SIZE, pos.y / SIZE * SIZE, pos.z)
+        .pack();
+  };
+  for (size_t i = 0; i < floors.size(); ++i) {
+    const Bounds &b = floors[i];
+    if (b.tiles > 0 && b.dense()) {
+      history_manager.recordRegionBefore(
+          *map, b.min_x, b.min_y, b.max_x, b.max_y,
+          static_cast<int16_t>(Domain::ChunkedMap::FLOOR_MIN + i));
+    }
+  }
+  forEachTarget([&](const Domain::Position &pos) {
+    if (!floors[pos.z - Domain::ChunkedMap::FLOOR_MIN].dense()) {
+      chunks[chunkKey(pos)].add(pos.x, pos.y);
+    }
+  });
+  for (const auto &[key, b] : chunks) {
+    if (b.dense()) {
+      history_manager.recordRegionBefore(*map, b.min_x, b.min_y, b.max_x,
+                                         b.max_y,
+                                         Domain::Position::unpack(key).z);
+    }
+  }
+  // After all regions, so tiles they cover are skipped
+  forEachTarget([&](const Domain::Position &pos) {
+    auto it = chunks.find(chunkKey(pos));
+    if (it != chunks.end() && !it->second.dense()) {
+      history_manager.recordTileBefore(pos, map->getTile(pos));
+    }
+  });
+}
+
 } // namespace MapEditor::AppLogic
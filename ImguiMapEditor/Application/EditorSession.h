@@ -14,6 +14,10 @@ namespace MapEditor::Services {
 class ClientDataService;
 }
 
+namespace MapEditor::Brushes {
+class AutoBorderer;
+}
+
 namespace MapEditor::AppLogic {
 
 /**
@@ -68,6 +72,14 @@ public:
                     int16_t z) {
     document_->selectRegion(min_x, min_y, max_x, max_y, z);
   }
+  void deselectRegion(int32_t min_x, int32_t min_y, int32_t max_x,
+                      int32_t max_y, int16_t z) {
+    document_->deselectRegion(min_x, min_y, max_x, max_y, z);
+  }
+  void toggleRegion(int32_t min_x, int32_t min_y, int32_t max_x, int32_t max_y,
+                    int16_t z) {
+    document_->toggleRegion(min_x, min_y, max_x, max_y, z);
+  }
   void clearSelection() { document_->clearSelection(); }
   void deleteSelection() { document_->deleteSelection(); }
 
@@ -110,6 +122,11 @@ public:
   void confirmPaste(const Domain::Position &target_pos,
                     bool replace_mode = false); // Commits paste action
 
+  // Auto-border engine run over pasted tiles (non-owning, may be null)
+  void setAutoBorderer(Brushes::AutoBorderer *auto_border) {
+    auto_border_ = auto_border;
+  }
+
   // View state (preserved when switching tabs)
   struct ViewState {
     float camera_x = 0.0f;
@@ -178,6 +195,10 @@ public:
   }
 
 private:
+  // Record history regions covering the paste footprint: one per floor, or
+  // per chunk (tiles where sparse) when the floor's footprint is scattered
+  void recordPasteRegions(const Domain::Position &target_pos);
+
   std::unique_ptr<Domain::MapInstance> document_;
   SessionID session_id_;
 
@@ -185,6 +206,7 @@ private:
   bool is_pasting_ = false;
   bool paste_replace_mode_ = false;  // True if Ctrl+Shift+V was used
   std::vector<Domain::CopyBuffer::CopiedTile> paste_preview_;
+  Brushes::AutoBorderer *auto_border_ = nullptr;
 
   ViewState view_state_;
   MinimapState minimap_state_;
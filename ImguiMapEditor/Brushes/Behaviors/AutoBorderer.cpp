@@ -0,0 +1,376 @@
+#include "AutoBorderer.h"
+#include "Domain/ChunkedMap.h"
+#include "Domain/History/HistoryManager.h"
+#include "Domain/Item.h"
+#include "Domain/ItemType.h"
+#include "Domain/Position.h"
+#include "Domain/Tile.h"
+#include "Services/Brushes/BorderLookupService.h"
+#include "Services/Brushes/WallLookupService.h"
+#include "Services/ClientDataService.h"
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include <unordered_map>
+
+namespace MapEditor::Brushes {
+
+namespace {
+
+constexpr int CHUNK_SIZE = Domain::Chunk::SIZE;
+constexpr int GRID_STRIDE = CHUNK_SIZE + 2; // Chunk plus one-tile rim
+
+// Neighbour offsets in TileNeighbor bit order (NW, N, NE, W, E, SW, S, SE)
+constexpr int NEIGHBOUR_DX[8] = {-1, 0, 1, -1, 1, -1, 0, 1};
+constexpr int NEIGHBOUR_DY[8] = {-1, -1, -1, 0, 0, 1, 1, 1};
+
+uint64_t chunkKey(int32_t cx, int32_t cy, int16_t z) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 28) ^
+                  (static_cast<uint64_t>(static_cast<uint32_t>(cy)) << 4) ^
+                  static_cast<uint64_t>(z & 0xF);
+}
+
+struct AffectedChunk {
+    int32_t cx = 0;
+    int32_t cy = 0;
+    int16_t z = 0;
+    std::bitset<Domain::Chunk::TILE_COUNT> tiles;
+};
+
+// Lookup tables are immutable, one instance serves every map
+const Services::Brushes::BorderLookupService& borderLookup() {
+        static const Services::Brushes::BorderLookupService lookup;
+        return lookup;
+}
+
+const Services::Brushes::WallLookupService& wallLookup() {
+        static const Services::Brushes::WallLookupService lookup;
+        return lookup;
+}
+
+template <typename T>
+void growTable(std::vector<T>& table, uint32_t id, const T& fill) {
+    if (id >= table.size()) {
+        table.resize(static_cast<size_t>(id) + 1, fill);
+    }
+}
+
+} // namespace
+
+void AutoBorderer::registerGround(const std::vector<uint32_t>& groundIds,
+                                  int zOrder, BorderBlock borders) {
+    const auto rule = static_cast<int16_t>(grounds_.size());
+
+    for (uint32_t id : groundIds) {
+        if (id == 0 || id > UINT16_MAX) {
+            continue;
+        }
+        growTable(groundRuleById_, id, NO_RULE);
+        groundRuleById_[id] = rule;
+    }
+
+    for (uint8_t e = 1; e < BorderBlock::kEdgeTypeCount; ++e) {
+        const auto edge = static_cast<EdgeType>(e);
+        for (const auto &[id, chance] : borders.getItems(edge)) {
+            if (id == 0 || id > UINT16_MAX) {
+                continue;
+            }
+            growTable(borderById_, id, BorderRef{});
+            borderById_[id] = BorderRef{rule, edge};
+        }
+    }
+
+    grounds_.push_back(GroundRule{zOrder, std::move(borders)});
+}
+
+void AutoBorderer::registerWall(std::array<WallNode, 16> nodes) {
+    const auto rule = static_cast<int16_t>(walls_.size());
+
+    for (uint8_t a = 0; a < nodes.size(); ++a) {
+        for (const auto &[id, chance] : nodes[a].getItems()) {
+            if (id == 0 || id > UINT16_MAX) {
+                continue;
+            }
+            growTable(wallById_, id, WallRef{});
+            wallById_[id] = WallRef{rule, static_cast<WallAlign>(a)};
+        }
+    }
+
+    walls_.push_back(std::move(nodes));
+}
+
+void AutoBorderer::clear() {
+    grounds_.clear();
+    walls_.clear();
+    groundRuleById_.clear();
+    borderById_.clear();
+    wallById_.clear();
+}
+
+int16_t AutoBorderer::groundRuleOf(const Domain::Tile* tile) const {
+    if (!tile || !tile->hasGround()) {
+        return NO_RULE;
+    }
+    const uint16_t id = tile->getGround()->getServerId();
+    return id < groundRuleById_.size() ? groundRuleById_[id] : NO_RULE;
+}
+
+int16_t AutoBorderer::wallRuleOf(const Domain::Tile* tile) const {
+    if (!tile || wallById_.empty()) {
+        return NO_RULE;
+    }
+    for (const auto& item : tile->getItems()) {
+        if (const WallRef* ref = wallRefOf(item->getServerId())) {
+            return ref->rule;
+        }
+    }
+    return NO_RULE;
+}
+
+const AutoBorderer::BorderRef *
+AutoBorderer::borderRefOf(uint16_t serverId) const {
+    if (serverId >= borderById_.size() ||
+            borderById_[serverId].rule == NO_RULE) {
+        return nullptr;
+    }
+    return &borderById_[serverId];
+}
+
+const AutoBorderer::WallRef *
+AutoBorderer::wallRefOf(uint16_t serverId) const {
+    if (serverId >= wallById_.size() || wallById_[serverId].rule == NO_RULE) {
+        return nullptr;
+    }
+    return &wallById_[serverId];
+}
+
+std::unique_ptr<Domain::Item>
+AutoBorderer::makeItem(uint32_t serverId) const {
+    auto item = std::make_unique<Domain::Item>(static_cast<uint16_t>(serverId));
+    if (clientData_) {
+        if (const auto* type =
+                clientData_->getItemTypeByServerId(static_cast<uint16_t>(serverId))) {
+            item->setType(type);
+            item->setClientId(type->client_id);
+        }
+    }
+    return item;
+}
+
+size_t AutoBorderer::resolve(Domain::ChunkedMap& map,
+                             const std::vector<Domain::Position>& dirty,
+                             Domain::History::HistoryManager* history) {
+    if (!hasRules() || dirty.empty()) {
+        return 0;
+    }
+
+    // 1. Dirty tiles plus one-tile margin, bucketed per chunk
+    std::unordered_map<uint64_t, AffectedChunk> affected;
+    for (const auto& pos : dirty) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                const int32_t x = pos.x + dx;
+                const int32_t y = pos.y + dy;
+                if (x < 0 || y < 0) {
+                    continue;
+                }
+                const int32_t cx = x / CHUNK_SIZE;
+                const int32_t cy = y / CHUNK_SIZE;
+                auto& chunk = affected[chunkKey(cx, cy, pos.z)];
+                chunk.cx = cx;
+                chunk.cy = cy;
+                chunk.z = pos.z;
+                chunk.tiles.set((y - cy * CHUNK_SIZE) * CHUNK_SIZE +
+                                (x - cx * CHUNK_SIZE));
+            }
+        }
+    }
+
+    size_t changed = 0;
+    std::vector<int16_t> groundGrid(GRID_STRIDE * GRID_STRIDE);
+    std::vector<int16_t> wallGrid(GRID_STRIDE * GRID_STRIDE);
+
+    for (const auto &[key, chunk] : affected) {
+        // 2. Gather rule ids of the chunk and its rim from up to 9 chunks
+        const Domain::Chunk* around[3][3] = {};
+        for (int j = 0; j < 3; ++j) {
+            for (int i = 0; i < 3; ++i) {
+                const int32_t ncx = chunk.cx + i - 1;
+                const int32_t ncy = chunk.cy + j - 1;
+                if (ncx >= 0 && ncy >= 0) {
+                    around[j][i] = map.getChunk(ncx, ncy, chunk.z);
+                }
+            }
+        }
+
+        for (int gy = 0; gy < GRID_STRIDE; ++gy) {
+            const int ly = gy - 1;
+            const int j = ly < 0 ? 0 : (ly < CHUNK_SIZE ? 1 : 2);
+            const int ty = ly - (j - 1) * CHUNK_SIZE;
+            for (int gx = 0; gx < GRID_STRIDE; ++gx) {
+                const int lx = gx - 1;
+                const int i = lx < 0 ? 0 : (lx < CHUNK_SIZE ? 1 : 2);
+                const int tx = lx - (i - 1) * CHUNK_SIZE;
+                const Domain::Chunk* c = around[j][i];
+                const Domain::Tile* tile = c ? c->getTileUnsafe(tx, ty) : nullptr;
+                groundGrid[gy * GRID_STRIDE + gx] = groundRuleOf(tile);
+                wallGrid[gy * GRID_STRIDE + gx] = wallRuleOf(tile);
+            }
+        }
+
+        // 3. Masks and table lookups for every affected tile
+        const Domain::Chunk* center = around[1][1];
+        for (int ly = 0; ly < CHUNK_SIZE; ++ly) {
+            for (int lx = 0; lx < CHUNK_SIZE; ++lx) {
+                if (!chunk.tiles.test(ly * CHUNK_SIZE + lx)) {
+                    continue;
+                }
+                const Domain::Position pos{chunk.cx * CHUNK_SIZE + lx,
+                                         chunk.cy * CHUNK_SIZE + ly, chunk.z};
+                Domain::Tile* tile = center ? center->getTileUnsafe(lx, ly) : nullptr;
+                const int cell = (ly + 1) * GRID_STRIDE + (lx + 1);
+
+                bool tileChanged = false;
+                if (!grounds_.empty()) {
+                    tileChanged |= updateGroundBorders(map, tile, pos, &groundGrid[cell],
+                                                       GRID_STRIDE, history);
+                    tile = map.getTile(pos); // May have been created for a border
+                }
+                if (!walls_.empty() && wallGrid[cell] != NO_RULE) {
+                    tileChanged |= updateWall(tile, pos, &wallGrid[cell], GRID_STRIDE, history);
+                }
+                if (tileChanged) {
+                    ++changed;
+                }
+            }
+        }
+    }
+
+    return changed;
+}
+
+bool AutoBorderer::updateGroundBorders(
+        Domain::ChunkedMap& map, Domain::Tile* tile, const Domain::Position& pos,
+        const int16_t* cell, int stride, Domain::History::HistoryManager* history) {
+    const int16_t own = *cell;
+    const int ownZ = own == NO_RULE ? INT_MIN : grounds_[own].zOrder;
+
+    // Neighbouring grounds drawn over this tile, each with its 8-neighbour mask
+    struct Overlap {
+        int16_t rule;
+        uint8_t mask;
+    };
+    Overlap overlaps[8];
+    int overlapCount = 0;
+    for (int n = 0; n < 8; ++n) {
+        const int16_t rule = cell[NEIGHBOUR_DY[n] * stride + NEIGHBOUR_DX[n]];
+        if (rule == NO_RULE || rule == own || grounds_[rule].zOrder <= ownZ) {
+            continue;
+        }
+        int o = 0;
+        while (o < overlapCount && overlaps[o].rule != rule) {
+            ++o;
+        }
+        if (o == overlapCount) {
+            overlaps[overlapCount++] = Overlap{rule, 0};
+        }
+        overlaps[o].mask |= static_cast<uint8_t>(1u << n);
+    }
+
+    // Lower z-order borders go first so higher grounds overlap them
+    std::sort(overlaps, overlaps + overlapCount,
+              [this](const Overlap& a, const Overlap& b) {
+                  return grounds_[a.rule].zOrder < grounds_[b.rule].zOrder;
+              });
+
+    std::vector<BorderRef> desired;
+    for (int o = 0; o < overlapCount; ++o) {
+        const auto& borders = grounds_[overlaps[o].rule].borders;
+        const uint32_t packed = borderLookup().getBorderTypes(
+                static_cast<TileNeighbor>(overlaps[o].mask));
+        for (int e = 0; e < 4; ++e) {
+            const auto edge = static_cast<EdgeType>((packed >> (e * 8)) & 0xFF);
+            if (edge != EdgeType::None && borders.hasItemsFor(edge)) {
+                desired.push_back(BorderRef{overlaps[o].rule, edge});
+            }
+        }
+    }
+
+    // Compare with the border items already on the tile
+    std::vector<BorderRef> existing;
+    if (tile) {
+        for (const auto& item : tile->getItems()) {
+            if (const BorderRef* ref = borderRefOf(item->getServerId())) {
+                existing.push_back(*ref);
+            }
+        }
+    }
+    if (existing == desired) {
+        return false;
+    }
+
+    if (history) {
+        history->recordTileBefore(pos, tile);
+    }
+    if (!tile) {
+        tile = map.getOrCreateTile(pos);
+    }
+
+    tile->removeItemsIf([this](const Domain::Item* item) {
+        return borderRefOf(item->getServerId()) != nullptr;
+    });
+    for (const auto& ref : desired) {
+        const uint32_t id = grounds_[ref.rule].borders.getRandomItem(ref.edge);
+        if (id != 0) {
+            tile->addItem(makeItem(id));
+        }
+    }
+    return true;
+}
+
+bool AutoBorderer::updateWall(Domain::Tile* tile,
+                              const Domain::Position& pos,
+                              const int16_t* cell, int stride,
+                              Domain::History::HistoryManager* history) {
+    if (!tile) {
+        return false;
+    }
+    const int16_t own = *cell;
+
+    WallNeighbor mask = WallNeighbor::None;
+    if (cell[-stride] == own)
+        mask |= WallNeighbor::North;
+    if (cell[-1] == own)
+        mask |= WallNeighbor::West;
+    if (cell[1] == own)
+        mask |= WallNeighbor::East;
+    if (cell[stride] == own)
+        mask |= WallNeighbor::South;
+
+    const WallAlign align = wallLookup().getFullType(mask);
+    const WallNode& node = walls_[own][static_cast<uint8_t>(align)];
+    if (!node.hasItems()) {
+        return false;
+    }
+
+    const auto& items = tile->getItems();
+    for (size_t i = 0; i < items.size(); ++i) {
+        const WallRef* ref = wallRefOf(items[i]->getServerId());
+        if (!ref || ref->rule != own) {
+            continue;
+        }
+        if (ref->align == align) {
+            return false;
+        }
+
+        if (history) {
+            history->recordTileBefore(pos, tile);
+        }
+        tile->removeItem(i);
+        tile->addItem(makeItem(node.getRandomItem()));
+        return true;
+    }
+    return false;
+}
+
+} // namespace MapEditor::Brushes
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Brushes/Data/BorderBlock.h"
+#include "Brushes/Data/WallNode.h"
+#include "Brushes/Enums/BrushEnums.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MapEditor::Domain {
+    class ChunkedMap;
+    class Tile;
+    class Item;
+    struct Position;
+    namespace History {
+        class HistoryManager;
+    }
+}
+
+namespace MapEditor::Services {
+    class ClientDataService;
+}
+
+namespace MapEditor::Brushes {
+
+/**
+ * Re-borders the area around a set of edited tiles in one batch.
+ *
+ * Ground and wall brushes register their item ids; flat server-id -> rule
+ * tables make classifying a tile an array index. A resolve pass takes the
+ * dirty tiles of a stroke or paste, adds a one-tile margin and walks it chunk
+ * by chunk: the rule ids of a chunk plus its one-tile rim are gathered into a
+ * small dense grid, every affected tile gets its 8-neighbour (ground) or
+ * 4-neighbour (wall) mask from that grid, and the masks are resolved through
+ * BorderLookupService / WallLookupService. Tiles whose border or wall
+ * alignment already matches are left untouched.
+ */
+class AutoBorderer {
+public:
+    /**
+     * Set client data for item type lookup of placed border/wall items.
+     */
+    void setClientData(Services::ClientDataService* clientData) { clientData_ = clientData; }
+
+    /**
+     * Register a ground brush.
+     * @param groundIds Server ids of the brush's ground items
+     * @param zOrder Higher z-order grounds border onto lower ones
+     * @param borders Border items drawn around this ground
+     */
+    void registerGround(const std::vector<uint32_t>& groundIds, int zOrder, BorderBlock borders);
+
+    /**
+     * Register a wall brush.
+     * @param nodes Wall items indexed by WallAlign
+     */
+    void registerWall(std::array<WallNode, 16> nodes);
+
+    /**
+     * Check if any ground or wall brush is registered.
+     */
+    bool hasRules() const { return !grounds_.empty() || !walls_.empty(); }
+
+    /**
+     * Recompute borders and wall alignment around edited tiles.
+     * Changed tiles are recorded into the active history operation first.
+     *
+     * @param map Map to update
+     * @param dirty Edited positions (duplicates allowed)
+     * @param history History manager with an active operation, or nullptr
+     * @return Number of tiles changed
+     */
+    size_t resolve(Domain::ChunkedMap& map,
+                   const std::vector<Domain::Position>& dirty,
+                   Domain::History::HistoryManager* history);
+
+    /**
+     * Forget all registered brushes.
+     */
+    void clear();
+
+private:
+    static constexpr int16_t NO_RULE = -1;
+
+    struct GroundRule {
+        int zOrder = 0;
+        BorderBlock borders;
+    };
+
+    // Border item on a tile: owning ground rule and edge
+    struct BorderRef {
+        int16_t rule = NO_RULE;
+        EdgeType edge = EdgeType::None;
+
+        bool operator==(const BorderRef& other) const {
+            return rule == other.rule && edge == other.edge;
+        }
+    };
+
+    // Wall item on a tile: owning wall rule and alignment
+    struct WallRef {
+        int16_t rule = NO_RULE;
+        WallAlign align = WallAlign::Pole;
+    };
+
+    int16_t groundRuleOf(const Domain::Tile* tile) const;
+    int16_t wallRuleOf(const Domain::Tile* tile) const;
+    const BorderRef* borderRefOf(uint16_t serverId) const;
+    const WallRef* wallRefOf(uint16_t serverId) const;
+
+    // cell points into a dense rule grid with rows of length stride
+    bool updateGroundBorders(Domain::ChunkedMap& map, Domain::Tile* tile,
+                             const Domain::Position& pos, const int16_t* cell, int stride,
+                             Domain::History::HistoryManager* history);
+    bool updateWall(Domain::Tile* tile, const Domain::Position& pos,
+                    const int16_t* cell, int stride,
+                    Domain::History::HistoryManager* history);
+
+    std::unique_ptr<Domain::Item> makeItem(uint32_t serverId) const;
+
+    Services::ClientDataService* clientData_ = nullptr;
+
+    std::vector<GroundRule> grounds_;
+    std::vector<std::array<WallNode, 16>> walls_;
+
+    // Flat tables indexed by server id
+    std::vector<int16_t> groundRuleById_;
+    std::vector<BorderRef> borderById_;
+    std::vector<WallRef> wallById_;
+};
+
+} // namespace MapEditor::Brushes
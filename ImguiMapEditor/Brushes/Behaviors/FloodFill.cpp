@@ -0,0 +1,155 @@
+#include "FloodFill.h"
+#include "Core/Config.h"
+#include "Domain/ChunkedMap.h"
+#include "Domain/Item.h"
+#include "Domain/Position.h"
+#include "Domain/Tile.h"
+#include <bitset>
+#include <cstdint>
+#include <unordered_map>
+
+namespace MapEditor::Brushes {
+
+namespace {
+
+constexpr int CHUNK_SIZE = Domain::Chunk::SIZE;
+
+// Header width/height is advisory in OTBM, tiles may lie beyond it
+constexpr int32_t COORD_LIMIT = Config::Map::MAX_SIZE;
+
+/**
+ * Reads ground ids and tracks visited tiles on one floor.
+ * Caches the last chunk so consecutive reads along a row cost an index.
+ */
+class FillCursor {
+public:
+    FillCursor(const Domain::ChunkedMap& map, int16_t z, uint16_t ground)
+        : map_(map), z_(z), ground_(ground) {}
+
+    // Unvisited tile in bounds with the seed ground
+    bool inside(int32_t x, int32_t y) {
+        if (x < 0 || y < 0 || x >= COORD_LIMIT || y >= COORD_LIMIT) {
+            return false;
+        }
+        select(x, y);
+        const int index = (y - cy_ * CHUNK_SIZE) * CHUNK_SIZE + (x - cx_ * CHUNK_SIZE);
+        if (visited_->test(index)) {
+            return false;
+        }
+        const Domain::Tile* tile =
+            chunk_ ? chunk_->getTileUnsafe(x - cx_ * CHUNK_SIZE, y - cy_ * CHUNK_SIZE) : nullptr;
+        const uint16_t id = tile && tile->hasGround() ? tile->getGround()->getServerId() : 0;
+        return id == ground_;
+    }
+
+    // Mark a tile returned by inside() as filled
+    void mark(int32_t x, int32_t y) {
+        select(x, y);
+        visited_->set((y - cy_ * CHUNK_SIZE) * CHUNK_SIZE + (x - cx_ * CHUNK_SIZE));
+    }
+
+private:
+    void select(int32_t x, int32_t y) {
+        const int32_t cx = x / CHUNK_SIZE;
+        const int32_t cy = y / CHUNK_SIZE;
+        if (visited_ && cx == cx_ && cy == cy_) {
+            return;
+        }
+        cx_ = cx;
+        cy_ = cy;
+        chunk_ = map_.getChunk(cx, cy, z_);
+        visited_ = &visited_chunks_[(static_cast<uint64_t>(cx) << 32) | static_cast<uint32_t>(cy)];
+    }
+
+    const Domain::ChunkedMap& map_;
+    int16_t z_;
+    uint16_t ground_;
+
+    int32_t cx_ = 0;
+    int32_t cy_ = 0;
+    const Domain::Chunk* chunk_ = nullptr;
+    std::bitset<Domain::Chunk::TILE_COUNT>* visited_ = nullptr;
+    std::unordered_map<uint64_t, std::bitset<Domain::Chunk::TILE_COUNT>> visited_chunks_;
+};
+
+// Row range [x1, x2] on row y still to scan, reached from row y - dy
+struct Span {
+    int32_t x1;
+    int32_t x2;
+    int32_t y;
+    int32_t dy;
+};
+
+} // anonymous namespace
+
+bool FloodFill::collect(const Domain::ChunkedMap& map,
+                        const Domain::Position& seed,
+                        size_t limit,
+                        std::vector<Domain::Position>& out) {
+    out.clear();
+
+    const Domain::Tile* seed_tile = map.getTile(seed);
+    const uint16_t ground =
+        seed_tile && seed_tile->hasGround() ? seed_tile->getGround()->getServerId() : 0;
+
+    FillCursor cursor(map, seed.z, ground);
+    if (!cursor.inside(seed.x, seed.y)) {
+        return true;
+    }
+
+    auto fill = [&](int32_t x, int32_t y) {
+        cursor.mark(x, y);
+        out.emplace_back(x, y, seed.z);
+        return out.size() <= limit;
+    };
+
+    std::vector<Span> stack;
+    stack.push_back({seed.x, seed.x, seed.y, 1});
+    stack.push_back({seed.x, seed.x, seed.y - 1, -1});
+
+    while (!stack.empty()) {
+        Span span = stack.back();
+        stack.pop_back();
+
+        int32_t x1 = span.x1;
+        int32_t x = x1;
+
+        // Extend the run to the left of the span
+        if (cursor.inside(x, span.y)) {
+            while (cursor.inside(x - 1, span.y)) {
+                if (!fill(x - 1, span.y)) {
+                    return false;
+                }
+                --x;
+            }
+            if (x < x1) {
+                stack.push_back({x, x1 - 1, span.y - span.dy, -span.dy});
+            }
+        }
+
+        // Fill runs across the span, queueing the rows beyond them
+        while (x1 <= span.x2) {
+            while (cursor.inside(x1, span.y)) {
+                if (!fill(x1, span.y)) {
+                    return false;
+                }
+                ++x1;
+            }
+            if (x1 > x) {
+                stack.push_back({x, x1 - 1, span.y + span.dy, span.dy});
+            }
+            if (x1 - 1 > span.x2) {
+                stack.push_back({span.x2 + 1, x1 - 1, span.y - span.dy, -span.dy});
+            }
+            ++x1;
+            while (x1 < span.x2 && !cursor.inside(x1, span.y)) {
+                ++x1;
+            }
+            x = x1;
+        }
+    }
+
+    return true;
+}
+
+} // namespace MapEditor::Brushes
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MapEditor::Domain {
+    class ChunkedMap;
+    struct Position;
+}
+
+namespace MapEditor::Brushes {
+
+/**
+ * Connected-area search for the brush fill mode.
+ *
+ * Collects the 4-connected region of tiles that share the seed tile's ground
+ * item (tiles without ground match empty seeds). Uses span-based scanline
+ * filling: each step consumes a whole horizontal run and only queues the
+ * row ranges above and below it that have not been scanned yet, so the work
+ * stack stays small and tiles are read row by row through the chunk arrays.
+ */
+class FloodFill {
+public:
+    /**
+     * Collect the region connected to seed.
+     *
+     * @param map Map to search (seed floor only)
+     * @param seed Start position
+     * @param limit Maximum number of tiles in the region
+     * @param out Region positions, in scan order
+     * @return false if the region exceeds limit (out is then incomplete)
+     */
+    static bool collect(const Domain::ChunkedMap& map,
+                        const Domain::Position& seed,
+                        size_t limit,
+                        std::vector<Domain::Position>& out);
+};
+
+} // namespace MapEditor::Brushes
@@ -1,4 +1,6 @@
 #include "BrushController.h"
+#include "Behaviors/FloodFill.h"
+#include "Core/Config.h"
 #include "Domain/Item.h"
 #include "Services/BrushSettingsService.h"
 #include "Services/ClientDataService.h"
@@ -16,6 +18,7 @@ void BrushController::initialize(
   map_ = map;
   historyManager_ = historyManager;
   clientData_ = clientData;
+  autoBorder_.setClientData(clientData);
   spdlog::debug("[BrushController] Initialized with map, history manager, and "
                 "client data");
 }
@@ -83,17 +86,7 @@ bool BrushController::applyBrush(const Domain::Position &pos) {
 
   // If in stroke mode, use optimized direct painting
   if (strokeActive_) {
-    auto key = std::make_tuple(pos.x, pos.y, pos.z);
-    if (paintedPositions_.count(key) > 0) {
-      return true; // Already painted
-    }
-    paintedPositions_.insert(key);
-
-    // Capture BEFORE state for undo
-    const Domain::Tile *tile = map_->getTile(pos);
-    historyManager_->recordTileBefore(pos, tile);
-
-    paintTileDirect(pos);
+    paintStrokePosition(pos);
     return true;
   }
 
@@ -106,6 +99,7 @@ bool BrushController::applyBrush(const Domain::Position &pos) {
   historyManager_->recordTileBefore(pos, tile);
 
   paintTileDirect(pos);
+  resolveBorders({pos});
 
   historyManager_->endOperation(map_, nullptr);
 
@@ -130,6 +124,7 @@ bool BrushController::eraseBrush(const Domain::Position &pos) {
 
   // Use IBrush::undraw() for unified erasing
   currentBrush_->undraw(*map_, tile);
+  resolveBorders({pos});
 
   historyManager_->endOperation(map_, nullptr);
 
@@ -147,8 +142,7 @@ void BrushController::beginStroke() {
 
   // Set stroke active flag (HistoryManager handles actual undo)
   strokeActive_ = true;
-  paintedPositions_.clear();
-  lastStrokePos_.reset();
+  resetStroke();
   spdlog::debug("[BrushController] Started brush stroke");
 }
 
@@ -157,7 +151,10 @@ void BrushController::paintTileDirect(const Domain::Position &pos) {
   if (!map_ || !currentBrush_)
     return;
 
-  Domain::Tile *tile = map_->getOrCreateTile(pos);
+  paintTile(map_->getOrCreateTile(pos));
+}
+
+void BrushController::paintTile(Domain::Tile *tile) {
   if (!tile)
     return;
 
@@ -171,73 +168,166 @@ void BrushController::paintTileDirect(const Domain::Position &pos) {
   currentBrush_->draw(*map_, tile, ctx);
 }
 
-void BrushController::continueStroke(const Domain::Position &pos) {
-  if (!strokeActive_ || !historyManager_ || !currentBrush_)
+void BrushController::resetStroke() {
+  strokeChunks_.clear();
+  lastStrokeChunk_ = nullptr;
+  strokePositions_.clear();
+  lastStrokePos_.reset();
+}
+
+BrushController::StrokeChunk &
+BrushController::strokeChunk(int32_t chunk_x, int32_t chunk_y, int16_t z) {
+  const uint64_t key = (static_cast<uint64_t>(chunk_x) << 36) |
+                       (static_cast<uint64_t>(chunk_y) << 8) |
+                       static_cast<uint64_t>(z & 0xFF);
+  if (lastStrokeChunk_ && key == lastStrokeKey_) {
+    return *lastStrokeChunk_;
+  }
+
+  auto [it, inserted] = strokeChunks_.try_emplace(key);
+  if (inserted) {
+    it->second.chunk = map_->getChunk(chunk_x, chunk_y, z);
+  }
+  lastStrokeKey_ = key;
+  lastStrokeChunk_ = &it->second;
+  return it->second;
+}
+
+void BrushController::paintStrokePosition(const Domain::Position &pos) {
+  if (pos.x < 0 || pos.y < 0) {
     return;
+  }
 
-  // Helper function to paint at a single position with duplicate tracking
-  auto paintAtPosition = [&](const Domain::Position &targetPos) {
-    auto key = std::make_tuple(targetPos.x, targetPos.y, targetPos.z);
-    if (paintedPositions_.count(key) > 0) {
-      return; // Already painted
+  constexpr int32_t size = Domain::Chunk::SIZE;
+  const int32_t chunk_x = pos.x / size;
+  const int32_t chunk_y = pos.y / size;
+  const int local_x = pos.x - chunk_x * size;
+  const int local_y = pos.y - chunk_y * size;
+
+  StrokeChunk &entry = strokeChunk(chunk_x, chunk_y, pos.z);
+  const size_t bit = static_cast<size_t>(local_y * size + local_x);
+  if (entry.painted.test(bit)) {
+    return; // Already painted
+  }
+  entry.painted.set(bit);
+  strokePositions_.push_back(pos);
+
+  // Capture BEFORE state (no-op if covered by a region snapshot)
+  Domain::Tile *tile =
+      entry.chunk ? entry.chunk->getTileUnsafe(local_x, local_y) : nullptr;
+  historyManager_->recordTileBefore(pos, tile);
+
+  if (!tile) {
+    tile = map_->getOrCreateTile(pos);
+    if (!entry.chunk) {
+      entry.chunk = map_->getChunk(chunk_x, chunk_y, pos.z);
     }
-    paintedPositions_.insert(key);
+  }
+  paintTile(tile);
+}
 
-    // Capture BEFORE state
-    const Domain::Tile *tile = map_->getTile(targetPos);
-    historyManager_->recordTileBefore(targetPos, tile);
+bool BrushController::fillArea(const Domain::Position &seed) {
+  if (!map_ || !historyManager_ || !currentBrush_ || strokeActive_) {
+    return false;
+  }
 
-    paintTileDirect(targetPos);
-  };
+  const size_t limit =
+      brushSettingsService_
+          ? static_cast<size_t>(brushSettingsService_->getFillLimit())
+          : Config::Performance::BRUSH_FILL_MAX_TILES;
 
-  // Get all positions to paint based on brush settings
-  std::vector<Domain::Position> brushPositions;
-  if (brushSettingsService_) {
-    brushPositions = brushSettingsService_->getBrushPositions(pos);
-  } else {
-    // Fallback: just paint the single position
-    brushPositions.push_back(pos);
+  std::vector<Domain::Position> region;
+  if (!FloodFill::collect(*map_, seed, limit, region)) {
+    spdlog::warn("[BrushController] Fill area exceeds {} tiles, not filled",
+                 limit);
+    return false;
+  }
+  if (region.empty()) {
+    return false;
+  }
+
+  beginStroke();
+  if (!strokeActive_) {
+    return false;
+  }
+
+  // Dense large fills record their bounding box once instead of every tile
+  if (region.size() >= Config::Performance::BULK_HISTORY_MIN_TILES) {
+    int32_t min_x = seed.x, max_x = seed.x;
+    int32_t min_y = seed.y, max_y = seed.y;
+    for (const auto &pos : region) {
+      min_x = std::min(min_x, pos.x);
+      max_x = std::max(max_x, pos.x);
+      min_y = std::min(min_y, pos.y);
+      max_y = std::max(max_y, pos.y);
+    }
+    const size_t area = static_cast<size_t>(max_x - min_x + 1) *
+                        static_cast<size_t>(max_y - min_y + 1);
+    if (area <= region.size() * 2) {
+      historyManager_->recordRegionBefore(*map_, min_x, min_y, max_x, max_y,
+                                          seed.z);
+    }
   }
 
+  for (const auto &pos : region) {
+    paintStrokePosition(pos);
+  }
+
+  spdlog::debug("[BrushController] Filled {} tiles at ({}, {}, {})",
+                region.size(), seed.x, seed.y, seed.z);
+  endStroke();
+  return true;
+}
+
+void BrushController::continueStroke(const Domain::Position &pos) {
+  if (!strokeActive_ || !historyManager_ || !currentBrush_)
+    return;
+
+  // Cached brush stamp (offsets from center); no settings = single tile
+  const std::vector<std::pair<int, int>> *stamp =
+      brushSettingsService_ ? &brushSettingsService_->getStampOffsets()
+                            : nullptr;
+
+  auto paintStamp = [&](const Domain::Position &center) {
+    if (!stamp) {
+      paintStrokePosition(center);
+      return;
+    }
+    for (const auto &[dx, dy] : *stamp) {
+      paintStrokePosition(
+          Domain::Position(center.x + dx, center.y + dy, center.z));
+    }
+  };
+
   // First position of stroke
   if (!lastStrokePos_.has_value()) {
-    for (const auto &brushPos : brushPositions) {
-      paintAtPosition(brushPos);
-    }
+    paintStamp(pos);
     lastStrokePos_ = pos;
     return;
   }
 
   // Interpolate line between last pos and current
-  auto linePositions = getLinePositions(lastStrokePos_.value(), pos);
+  getLinePositions(lastStrokePos_.value(), pos, lineBuffer_);
   lastStrokePos_ = pos;
 
-  for (const auto &linePos : linePositions) {
-    // For each line position, get all brush positions
-    std::vector<Domain::Position> expandedPositions;
-    if (brushSettingsService_) {
-      expandedPositions = brushSettingsService_->getBrushPositions(linePos);
-    } else {
-      expandedPositions.push_back(linePos);
-    }
-
-    for (const auto &brushPos : expandedPositions) {
-      paintAtPosition(brushPos);
-    }
+  for (const auto &linePos : lineBuffer_) {
+    paintStamp(linePos);
   }
 }
 
 void BrushController::endStroke() {
   if (!strokeActive_ || !historyManager_) {
     strokeActive_ = false;
-    paintedPositions_.clear();
-    lastStrokePos_.reset();
+    resetStroke();
     return;
   }
 
-  if (!paintedPositions_.empty()) {
+  if (!strokePositions_.empty()) {
     spdlog::debug("[BrushController] Ended stroke with {} tiles",
-                  paintedPositions_.size());
+                  strokePositions_.size());
+
+    // Re-border the whole stroke at once instead of per painted tile
+    resolveBorders(strokePositions_);
 
     // End the history operation - captures AFTER states and pushes to history
     historyManager_->endOperation(map_, nullptr);
@@ -247,16 +337,27 @@ void BrushController::endStroke() {
   }
 
   strokeActive_ = false;
-  paintedPositions_.clear();
-  lastStrokePos_.reset();
+  resetStroke();
 }
 
-// Bresenham's line algorithm implementation
-std::vector<Domain::Position>
-BrushController::getLinePositions(const Domain::Position &from,
-                                  const Domain::Position &to) const {
+void BrushController::resolveBorders(
+    const std::vector<Domain::Position> &positions) {
+  if (!map_ || !currentBrush_ || !currentBrush_->needsBorderUpdate() ||
+      !autoBorder_.hasRules()) {
+    return;
+  }
+
+  size_t changed = autoBorder_.resolve(*map_, positions, historyManager_);
+  if (changed > 0) {
+    spdlog::debug("[BrushController] Auto-border updated {} tiles", changed);
+  }
+}
 
-  std::vector<Domain::Position> positions;
+// Bresenham's line algorithm implementation
+void BrushController::getLinePositions(const Domain::Position &from,
+                                       const Domain::Position &to,
+                                       std::vector<Domain::Position> &out) const {
+  out.clear();
 
   int32_t x0 = from.x, y0 = from.y;
   int32_t x1 = to.x, y1 = to.y;
@@ -269,7 +370,7 @@ BrushController::getLinePositions(const Domain::Position &from,
   int32_t err = dx + dy;
 
   while (true) {
-    positions.push_back({x0, y0, z});
+    out.push_back({x0, y0, z});
 
     if (x0 == x1 && y0 == y1)
       break;
@@ -288,8 +389,6 @@ BrushController::getLinePositions(const Domain::Position &from,
       y0 += sy;
     }
   }
-
-  return positions;
 }
 
 } // namespace MapEditor::Brushes
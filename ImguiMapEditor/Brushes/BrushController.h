@@ -1,4 +1,5 @@
 #pragma once
+#include "Brushes/Behaviors/AutoBorderer.h"
 #include "Brushes/Core/IBrush.h"
 #include "Brushes/Types/EraserBrush.h"
 #include "Brushes/Types/FlagBrush.h"
@@ -9,11 +10,11 @@
 #include "Domain/History/HistoryManager.h"
 #include "Domain/Position.h"
 #include <algorithm>
+#include <bitset>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 // Forward declarations
@@ -125,6 +126,14 @@ public:
    */
   bool eraseBrush(const Domain::Position &pos);
 
+  /**
+   * Fill the connected area of the ground at seed with the current brush.
+   * The fill is one stroke: single undo step, borders resolved once.
+   * @param seed Clicked position
+   * @return false if nothing was filled or the area exceeds the fill limit
+   */
+  bool fillArea(const Domain::Position &seed);
+
   /**
    * Start a new brush stroke (for drag operations).
    * Call endStroke() when drag completes.
@@ -203,6 +212,11 @@ public:
   void activateWaypointBrush() { setBrush(&waypointBrush_); }
   WaypointBrush *getWaypointBrush() { return &waypointBrush_; }
 
+  /**
+   * Auto-border engine run after strokes (also used by paste).
+   */
+  AutoBorderer &getAutoBorderer() { return autoBorder_; }
+
 private:
   Domain::ChunkedMap *map_ = nullptr;
   Domain::History::HistoryManager *historyManager_ = nullptr;
@@ -245,30 +259,51 @@ private:
   // Waypoint brush instance
   WaypointBrush waypointBrush_;
 
+  // Ground border / wall alignment engine
+  AutoBorderer autoBorder_;
+
   // Simple flag for stroke tracking (HistoryManager handles actual undo)
   bool strokeActive_ = false;
 
-  // Track positions painted in current stroke (to avoid duplicates)
-  struct PositionHash {
-    size_t operator()(const std::tuple<int32_t, int32_t, int16_t> &p) const {
-      return std::hash<int64_t>()(static_cast<int64_t>(std::get<0>(p)) |
-                                  (static_cast<int64_t>(std::get<1>(p)) << 20) |
-                                  (static_cast<int64_t>(std::get<2>(p)) << 40));
-    }
+  // Per-stroke dedup bitmap for one chunk; the chunk pointer is resolved
+  // once so tiles of the stroke are read straight from its tile array
+  struct StrokeChunk {
+    const Domain::Chunk *chunk = nullptr;
+    std::bitset<Domain::Chunk::TILE_COUNT> painted;
   };
-  std::unordered_set<std::tuple<int32_t, int32_t, int16_t>, PositionHash>
-      paintedPositions_;
+  std::unordered_map<uint64_t, StrokeChunk> strokeChunks_;
+  uint64_t lastStrokeKey_ = 0;
+  StrokeChunk *lastStrokeChunk_ = nullptr;
+
+  // Positions painted in the current stroke, in paint order
+  std::vector<Domain::Position> strokePositions_;
+
+  // Reused interpolation buffer for continueStroke()
+  std::vector<Domain::Position> lineBuffer_;
 
   // Track last position within current stroke for line interpolation
   std::optional<Domain::Position> lastStrokePos_;
 
-  // Helper: get all positions on line between two points (Bresenham)
-  std::vector<Domain::Position>
-  getLinePositions(const Domain::Position &from,
-                   const Domain::Position &to) const;
+  // Helper: fill out with all positions on line between two points (Bresenham)
+  void getLinePositions(const Domain::Position &from,
+                        const Domain::Position &to,
+                        std::vector<Domain::Position> &out) const;
 
   // Paint tile using current brush
   void paintTileDirect(const Domain::Position &pos);
+  void paintTile(Domain::Tile *tile);
+
+  // Paint a stroke position once, recording its BEFORE state
+  void paintStrokePosition(const Domain::Position &pos);
+
+  // Stroke dedup entry for a chunk (cached for consecutive lookups)
+  StrokeChunk &strokeChunk(int32_t chunk_x, int32_t chunk_y, int16_t z);
+
+  // Forget all per-stroke state
+  void resetStroke();
+
+  // Re-border around edited tiles inside the active history operation
+  void resolveBorders(const std::vector<Domain::Position> &positions);
 };
 
 } // namespace MapEditor::Brushes
@@ -1,4 +1,5 @@
 #include "BrushSystem.h"
+#include "IO/BrushXmlReader.h"
 #include "Services/ConfigService.h"
 #include <filesystem>
 #include <spdlog/spdlog.h>
@@ -47,5 +48,24 @@ void BrushSystem::saveBrushes() {
   }
 }
 
+void BrushSystem::loadBorderRules(const std::filesystem::path &dataDir) {
+  auto &autoBorder = controller_.getAutoBorderer();
+  autoBorder.clear();
+
+  IO::BrushXmlReader::Dependencies deps;
+  deps.autoBorder = &autoBorder;
+  IO::BrushXmlReader reader(deps);
+
+  // Shared border definitions first so ground brushes can reference them
+  const auto bordersFile = dataDir / "borders" / "borders.xml";
+  if (std::filesystem::exists(bordersFile)) {
+    reader.loadFile(bordersFile);
+  }
+  size_t count = reader.loadDirectory(dataDir / "brushes");
+
+  spdlog::info("[BrushSystem] Auto-border rules from {} brushes ({})", count,
+               autoBorder.hasRules() ? "active" : "none");
+}
+
 } // namespace Brushes
 } // namespace MapEditor
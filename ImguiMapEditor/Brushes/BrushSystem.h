@@ -6,6 +6,7 @@
 #include "Services/TilesetService.h"
 #include "UI/Panels/BrushSizePanel.h"
 #include "UI/Widgets/TilesetWidget.h"
+#include <filesystem>
 #include <memory>
 
 namespace MapEditor {
@@ -56,6 +57,9 @@ public:
   void saveBrushes(); // Save custom brushes to JSON
   std::string getBrushSavePath() const { return brushPath_; }
 
+  // Feed the auto-border engine from <dataDir>/borders and <dataDir>/brushes
+  void loadBorderRules(const std::filesystem::path &dataDir);
+
   const BrushRegistry &getRegistry() const { return registry_; }
   const BrushController &getController() const { return controller_; }
   const UI::TilesetWidget &getTilesetWidget() const { return tileset_widget_; }
@@ -26,6 +26,8 @@ public:
   const std::string &getName() const override { return name_; }
   BrushType getType() const override { return BrushType::Eraser; }
   uint32_t getLookId() const override { return 0; }
+  // Erased grounds/walls leave stale borders behind otherwise
+  bool needsBorderUpdate() const override { return true; }
 
   // Configuration - what to erase
   void setEraseGround(bool val) { eraseGround_ = val; }
@@ -40,6 +40,9 @@ public:
     
     bool ownsItem(const Domain::Item* item) const override;
     
+    // Placing grounds or walls re-resolves the borders around them
+    bool needsBorderUpdate() const override { return true; }
+    
     // ─── RawBrush Specific ────────────────────────────────────────────────
     
     /**
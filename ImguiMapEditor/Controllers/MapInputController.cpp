@@ -10,6 +10,7 @@
 #include "Domain/Item.h"
 #include "Domain/Selection/SelectionEntry.h"
 #include "Domain/Tile.h"
+#include "Services/BrushSettingsService.h"
 #include "Services/Map/MapEditingService.hpp"
 #include <GLFW/glfw3.h>
 #include <spdlog/spdlog.h>
@@ -68,6 +69,12 @@ void MapInputController::onLeftClick(const Domain::Position &pos, int mods,
   // BRUSH MODE: Paint single tile on click (atomic undo entry)
   if (brush_controller_ && brush_controller_->hasBrush() &&
       !(mods & (GLFW_MOD_CONTROL | GLFW_MOD_SHIFT))) {
+    if (isBrushFillMode()) {
+      if (brush_controller_->fillArea(pos)) {
+        session->setModified(true);
+      }
+      return;
+    }
     brush_controller_->applyBrush(pos);
     session->setModified(true);
     return;
@@ -147,6 +154,11 @@ void MapInputController::onLeftDragStart(const Domain::Position &pos,
   if (!session)
     return;
 
+  // BRUSH MODE: Fill mode paints on click only
+  if (brush_controller_ && brush_controller_->hasBrush() && isBrushFillMode()) {
+    return;
+  }
+
   // BRUSH MODE: Start stroke
   if (brush_controller_ && brush_controller_->hasBrush()) {
     is_brush_dragging_ = true;
@@ -267,7 +279,7 @@ void MapInputController::onDoubleClick(const Domain::Position &pos,
         auto &items = mutable_tile->getItems();
         for (auto &item : items) {
           if (item.get() == item_ptr) {
-            open_item_properties_callback_(item.get());
+            open_item_properties_callback_(item.get(), entry.getPosition());
             break;
           }
         }
@@ -300,4 +312,10 @@ bool MapInputController::hasBrush() const {
   return brush_controller_ && brush_controller_->hasBrush();
 }
 
+bool MapInputController::isBrushFillMode() const {
+  const auto *settings =
+      brush_controller_ ? brush_controller_->getBrushSettingsService() : nullptr;
+  return settings && settings->isFillMode();
+}
+
 } // namespace MapEditor::AppLogic
@@ -80,7 +80,8 @@ public:
   void onDoubleClick(const Domain::Position &pos, const glm::vec2 &pixel_offset,
                      EditorSession *session);
 
-  using OpenItemPropertiesCallback = std::function<void(Domain::Item *)>;
+  using OpenItemPropertiesCallback =
+      std::function<void(Domain::Item *, const Domain::Position &)>;
   using OpenSpawnPropertiesCallback =
       std::function<void(Domain::Spawn *, const Domain::Position &)>;
   using OpenCreaturePropertiesCallback = std::function<void(
@@ -131,6 +132,9 @@ private:
   // Ensure correct strategy is active based on settings
   void ensureCorrectStrategy();
 
+  // Brush settings request area fill instead of shape painting
+  bool isBrushFillMode() const;
+
   // Drag state
   bool is_dragging_ = false;
   Domain::Position drag_start_pos_;
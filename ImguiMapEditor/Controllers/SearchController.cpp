@@ -1,13 +1,19 @@
 #include "Controllers/SearchController.h"
 #include "Services/ClientDataService.h"
 #include "Services/SpriteManager.h"
+#include "Services/Map/MapSearchJob.h"
 #include "Domain/ChunkedMap.h"
+#include <algorithm>
+#include <cctype>
+
 namespace MapEditor {
 namespace AppLogic {
 
 SearchController::SearchController() = default;
 
-SearchController::~SearchController() = default;
+SearchController::~SearchController() {
+    cancelMapSearch();
+}
 
 void SearchController::onMapLoaded(
     Domain::ChunkedMap* map,
@@ -15,6 +21,10 @@ void SearchController::onMapLoaded(
     Services::SpriteManager* sprite_manager,
     Services::ViewSettings* view_settings
 ) {
+    // Any running search references the previous map
+    cancelMapSearch();
+    current_map_ = map;
+
     if (!client_data) return;
 
     // Only recreate ItemPickerService if client data changed (it doesn't support setting new data)
@@ -29,7 +39,10 @@ void SearchController::onMapLoaded(
         map_search_service_ = std::make_unique<Services::MapSearchService>();
 
         // Wire up UI components that depend on the service instance
-        search_results_widget_.setMapSearchService(map_search_service_.get());
+        search_results_widget_.setSearchRequestCallback(
+            [this](const std::string& query, bool search_items, bool search_creatures) {
+                startMapSearch(query, search_items, search_creatures);
+            });
         advanced_search_dialog_.setMapSearchService(map_search_service_.get());
         advanced_search_dialog_.setSearchResultsWidget(&search_results_widget_);
     }
@@ -60,5 +73,86 @@ void SearchController::onMapLoaded(
     current_client_data_ = client_data;
 }
 
+void SearchController::update(const Domain::Position& camera_center) {
+    search_origin_ = camera_center;
+
+    if (!active_search_) return;
+
+    // Results were replaced (e.g. by Advanced Search) or the search was cleared
+    if (!search_results_widget_.isSearchInProgress()) {
+        cancelMapSearch();
+        return;
+    }
+
+    // Workers scan snapshots only; hand them the next chunks
+    if (current_map_) {
+        active_search_->feed(*current_map_);
+    } else {
+        active_search_->cancel();
+    }
+
+    drainMapSearch();
+
+    if (active_search_->isFinished()) {
+        // Pick up anything published between the drain and the last worker exiting
+        drainMapSearch();
+        search_results_widget_.setSearchProgress(false);
+        active_search_.reset();
+    } else {
+        search_results_widget_.setSearchProgress(true, active_search_->getProgress());
+    }
+}
+
+void SearchController::startMapSearch(const std::string& query, bool search_items,
+                                      bool search_creatures) {
+    cancelMapSearch();
+
+    if (query.empty() || !map_search_service_ || !current_map_) {
+        search_results_widget_.setSearchProgress(false);
+        return;
+    }
+
+    Services::MapSearchRequest request;
+    request.query = query;
+    request.search_items = search_items;
+    request.search_creatures = search_creatures;
+    request.limit = UI::SearchResultsWidget::MAX_RESULTS;
+    request.origin = search_origin_;
+
+    // Numeric queries also match server and client IDs; passes are listed in
+    // display order, so ID matches stay ahead of name matches
+    bool is_number = std::all_of(query.begin(), query.end(),
+                                 [](unsigned char c) { return std::isdigit(c); });
+    request.modes.clear();
+    if (is_number) {
+        request.modes.push_back(Services::MapSearchMode::ByServerId);
+        request.modes.push_back(Services::MapSearchMode::ByClientId);
+    }
+    request.modes.push_back(Services::MapSearchMode::ByName);
+
+    active_search_ = map_search_service_->startSearch(request);
+    if (!active_search_) {
+        search_results_widget_.setSearchProgress(false);
+    }
+}
+
+void SearchController::drainMapSearch() {
+    if (active_search_->drainResults(drained_results_) == 0) return;
+
+    for (size_t pass = 0; pass < drained_results_.size(); ++pass) {
+        if (!drained_results_[pass].empty()) {
+            search_results_widget_.appendResults(drained_results_[pass], pass);
+            drained_results_[pass].clear();
+        }
+    }
+}
+
+void SearchController::cancelMapSearch() {
+    if (active_search_) {
+        active_search_->cancel();
+        active_search_.reset();
+    }
+}
+
 } // namespace AppLogic
 } // namespace MapEditor
@@ -5,13 +5,17 @@
 #include "UI/Dialogs/AdvancedSearchDialog.h"
 #include "UI/Widgets/SearchResultsWidget.h"
 #include "Services/ViewSettings.h"
+#include "Domain/Position.h"
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace MapEditor {
 
 namespace Services {
     class ClientDataService;
     class SpriteManager;
+    class MapSearchJob;
 }
 
 namespace Domain {
@@ -39,12 +43,24 @@ public:
         Services::ViewSettings* view_settings
     );
 
+    /**
+     * Per-frame pump for the async map search.
+     * Feeds the job the next chunk snapshots (time-budgeted) and drains
+     * finished result batches into SearchResultsWidget, one section per pass.
+     * @param camera_center Origin for the next search's nearest-first scan
+     */
+    void update(const Domain::Position& camera_center);
+
     // Accessors for UI components (needed for rendering and callbacks)
     UI::QuickSearchPopup* getQuickSearchPopup() { return &quick_search_popup_; }
     UI::AdvancedSearchDialog* getAdvancedSearchDialog() { return &advanced_search_dialog_; }
     UI::SearchResultsWidget* getSearchResultsWidget() { return &search_results_widget_; }
 
 private:
+    void startMapSearch(const std::string& query, bool search_items, bool search_creatures);
+    void cancelMapSearch();
+    void drainMapSearch();
+
     // UI Components
     UI::QuickSearchPopup quick_search_popup_;
     UI::AdvancedSearchDialog advanced_search_dialog_;
@@ -54,8 +70,14 @@ private:
     std::unique_ptr<AppLogic::ItemPickerService> item_picker_service_;
     std::unique_ptr<Services::MapSearchService> map_search_service_;
 
+    // Declared after map_search_service_ so it is destroyed (and joined) first
+    std::unique_ptr<Services::MapSearchJob> active_search_;
+    std::vector<std::vector<Domain::Search::MapSearchResult>> drained_results_;  // Per pass
+
     // State tracking
     Services::ClientDataService* current_client_data_ = nullptr;
+    Domain::ChunkedMap* current_map_ = nullptr;
+    Domain::Position search_origin_;
 };
 
 } // namespace AppLogic
@@ -84,6 +84,9 @@ void WorkspaceController::bindSession(
     // Wire preview service
     brush_controller_.setPreviewService(&session->getPreviewService());
 
+    // Paste shares the stroke auto-border engine
+    session->setAutoBorderer(&brush_controller_.getAutoBorderer());
+
     // Clear selection when brush is activated
     brush_controller_.setOnBrushActivatedCallback(
         [session]() { session->getSelectionService().clear(); });
@@ -111,8 +111,35 @@ inline constexpr float CACHE_ZOOM_THRESHOLD = 0.2f;
 inline constexpr float OVERLAY_ZOOM_THRESHOLD =
     0.2f; // Hide detailed overlays at very low zoom
 
+// Far-zoom chunk impostors: below this zoom each cached chunk is drawn as one
+// pre-rasterized quad. IMPOSTOR_SIZE texels cover the chunk plus
+// IMPOSTOR_MARGIN world pixels above/left of it (overhanging sprites), so a
+// texel is ~17 world pixels, about one screen pixel at the threshold.
+inline constexpr float IMPOSTOR_ZOOM_THRESHOLD = 0.07f;
+inline constexpr int IMPOSTOR_SIZE = 64;
+inline constexpr int IMPOSTOR_MARGIN = 64;
+inline constexpr int IMPOSTOR_PAGE_SIZE = 2048; // 1024 impostors per page
+inline constexpr int IMPOSTOR_MAX_PAGES = 4;    // ~88MB with mips
+inline constexpr int IMPOSTOR_BUILDS_PER_FRAME = 64;
+
+// Cached chunk VBOs: above this many, chunks leaving the view are evicted
+inline constexpr size_t CHUNK_CACHE_SOFT_LIMIT = 4096;
+// Opaque-ground masks kept for multi-floor occlusion
+inline constexpr size_t COVERAGE_CHUNK_CACHE_LIMIT = 4096;
+// Roof/blocker masks kept for the preview's first-visible-floor scan
+inline constexpr size_t FLOOR_BLOCKER_CACHE_LIMIT = 256;
+// Rasterized spawn radius masks kept per prepared floor
+inline constexpr size_t SPAWN_TINT_CACHE_LIMIT = 1024;
+// Laid-out overlay labels and formatted tooltip texts kept across frames
+inline constexpr size_t OVERLAY_TEXT_CACHE_LIMIT = 4096;
+inline constexpr size_t TOOLTIP_TEXT_CACHE_LIMIT = 4096;
+// Overlay text scales snap to 1/N steps so zooming reuses laid-out labels
+inline constexpr float OVERLAY_TEXT_SCALE_STEPS = 16.0f;
+
 // Reserve capacities
 inline constexpr size_t WALL_VERTICES_RESERVE = 512;
+// Cached wall-outline chunks kept before off-screen ones are dropped
+inline constexpr size_t WALL_CHUNK_CACHE_LIMIT = 2048;
 inline constexpr size_t MINIMAP_BUFFER_SIZE = 256 * 256;
 inline constexpr size_t TOOLTIP_TEXT_RESERVE = 128;
 inline constexpr size_t MISSING_SPRITES_RESERVE = 64;
@@ -123,6 +150,46 @@ inline constexpr size_t DEFAULT_VISIBLE_CHUNK_ESTIMATE = 100;
 // Async sprite loading
 inline constexpr size_t SPRITE_LOADER_THREADS = 4;
 
+// Async map search
+inline constexpr size_t MAP_SEARCH_THREADS = 4;
+// Chunk snapshots a search keeps built ahead of its workers
+inline constexpr size_t MAP_SEARCH_FEED_WINDOW = 1024;
+// Main-thread time per frame spent building those snapshots
+inline constexpr double MAP_SEARCH_FEED_BUDGET_MS = 2.0;
+
+// Frame preparation: per-floor visibility/overlay collection runs on this
+// many workers once at least FRAME_PREP_MIN_FLOORS floors are drawn
+inline constexpr size_t FRAME_PREP_THREADS = 3;
+inline constexpr size_t FRAME_PREP_MIN_FLOORS = 2;
+
+// Per-chunk render snapshots kept by RenderSnapshotStore (LRU beyond this)
+inline constexpr size_t RENDER_SNAPSHOT_LIMIT = 8192;
+
+// Bulk move/paste: record region history instead of per-tile snapshots
+inline constexpr size_t BULK_HISTORY_MIN_TILES = 256;
+
+// Brush fill mode: default cap on tiles filled by one click
+inline constexpr size_t BRUSH_FILL_MAX_TILES = 65536;
+
+// Colorized outfit sprites kept in the sprite atlas (LRU beyond this)
+inline constexpr size_t COLORIZED_OUTFIT_CACHE_BYTES = 32 * 1024 * 1024;
+
+// UI thumbnail atlas (palette, search results, quick search)
+inline constexpr int THUMBNAIL_PAGE_SIZE = 2048;
+inline constexpr int THUMBNAIL_MAX_PAGES = 4;
+inline constexpr size_t THUMBNAIL_WORKER_THREADS = 2;
+inline constexpr size_t THUMBNAIL_UPLOADS_PER_FRAME = 64;
+
+// Sprite atlas residency: once this many layers are full, sprites not drawn
+// for EVICTION_MIN_AGE frames are evicted in batches before a layer is added
+inline constexpr int ATLAS_RESIDENT_LAYERS = 32;
+inline constexpr uint32_t ATLAS_EVICTION_MIN_AGE_FRAMES = 600;
+inline constexpr size_t ATLAS_EVICTION_BATCH = 4096;
+// Cached chunks re-mark their sprites as used at this interval
+inline constexpr uint32_t ATLAS_TOUCH_INTERVAL_FRAMES = 120;
+// A sprite reloaded within this many frames of its eviction counts as thrash
+inline constexpr uint32_t ATLAS_THRASH_WINDOW_FRAMES = 600;
+
 // Fence synchronization
 inline constexpr int32_t MAX_FENCE_WAIT_RETRIES = 1000;
 inline constexpr uint64_t FENCE_WAIT_TIMEOUT_NS = 1000000; // 1ms
@@ -136,6 +203,8 @@ namespace Input {
 inline constexpr float DRAG_THRESHOLD_SQ = 100.0f;       // 10 pixels squared
 inline constexpr float SHIFT_DRAG_THRESHOLD_SQ = 100.0f; // 10 pixels squared
 inline constexpr double DRAG_DELAY_SECONDS = 0.1;
+// Search-as-you-type waits this long after the last keystroke
+inline constexpr double SEARCH_DEBOUNCE_SECONDS = 0.25;
 // Lasso drag configuration
 inline constexpr float LASSO_DRAG_POINT_DISTANCE_SQ = 64.0f; // 8 pixels squared
 } // namespace Input
@@ -367,6 +436,11 @@ inline constexpr int DEFAULT_ROAM_RADIUS =
     3; // Default radius for creatures without spawn
 inline constexpr float RANDOM_MOVE_INTERVAL_MIN = 0.5f;
 inline constexpr float RANDOM_MOVE_INTERVAL_MAX = 1.0f;
+inline constexpr float FAR_STEP_INTERVAL_SEC =
+    0.5f; // Chunks outside the viewport are stepped at this rate
+inline constexpr size_t WORKER_THREADS = 3; // Helpers besides the main thread
+inline constexpr size_t PARALLEL_MIN_CREATURES =
+    256; // Fewer stepped creatures than this run on the main thread only
 } // namespace Simulation
 
 } // namespace MapEditor::Config
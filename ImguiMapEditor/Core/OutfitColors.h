@@ -5,6 +5,12 @@
 #include <unordered_map>
 #include <memory>
 #include "Domain/Outfit.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MAPEDITOR_OUTFIT_COLORIZE_SSE2 1
+#endif
+
 namespace MapEditor {
 namespace Rendering {
 
@@ -80,6 +86,11 @@ inline int getTemplatePartFromColor(uint8_t r, uint8_t g, uint8_t b) {
 /**
  * CPU-based outfit colorizer.
  * Takes base sprite and template mask, applies head/body/legs/feet colors.
+ *
+ * On SSE2 targets four pixels are colorized per step: each RGBA pixel is one
+ * 32-bit lane, the template part masks are built with lane compares and the
+ * per-part channel factors are selected with bit masks, so results match
+ * colorizePixel exactly. Remaining pixels use the scalar loop.
  */
 class OutfitColorizer {
 public:
@@ -93,7 +104,20 @@ public:
     static void colorize(uint8_t* basePixels, const uint8_t* templatePixels, 
                          size_t pixelCount, const Domain::Outfit& outfit) {
         if (!basePixels || !templatePixels) return;
-        
+
+        size_t done = 0;
+#ifdef MAPEDITOR_OUTFIT_COLORIZE_SSE2
+        done = colorizeSse2(basePixels, templatePixels, pixelCount, outfit);
+#endif
+        colorizeScalar(basePixels + done * 4, templatePixels + done * 4,
+                       pixelCount - done, outfit);
+    }
+
+    /**
+     * Reference per-pixel implementation (also handles SIMD tails).
+     */
+    static void colorizeScalar(uint8_t* basePixels, const uint8_t* templatePixels,
+                               size_t pixelCount, const Domain::Outfit& outfit) {
         uint8_t lookHead = static_cast<uint8_t>(outfit.lookHead);
         uint8_t lookBody = static_cast<uint8_t>(outfit.lookBody);
         uint8_t lookLegs = static_cast<uint8_t>(outfit.lookLegs);
@@ -121,6 +145,70 @@ public:
             }
         }
     }
+
+#ifdef MAPEDITOR_OUTFIT_COLORIZE_SSE2
+    /**
+     * Colorize whole groups of four pixels.
+     * @return Number of pixels processed (pixelCount rounded down to 4)
+     */
+    static size_t colorizeSse2(uint8_t* basePixels, const uint8_t* templatePixels,
+                               size_t pixelCount, const Domain::Outfit& outfit) {
+        // Channel factors per part, as computed by colorizePixel
+        auto factor = [](int look, int shift) {
+            uint8_t colorIndex = static_cast<uint8_t>(look);
+            if (colorIndex >= OUTFIT_COLOR_COUNT) colorIndex = 0;
+            uint8_t channel = (TemplateOutfitLookupTable[colorIndex] >> shift) & 0xFF;
+            return _mm_set1_ps(channel / 255.0f);
+        };
+        // Table is 0xRRGGBB, pixels are R in the low byte of each lane
+        const __m128 headR = factor(outfit.lookHead, 16), headG = factor(outfit.lookHead, 8), headB = factor(outfit.lookHead, 0);
+        const __m128 bodyR = factor(outfit.lookBody, 16), bodyG = factor(outfit.lookBody, 8), bodyB = factor(outfit.lookBody, 0);
+        const __m128 legsR = factor(outfit.lookLegs, 16), legsG = factor(outfit.lookLegs, 8), legsB = factor(outfit.lookLegs, 0);
+        const __m128 feetR = factor(outfit.lookFeet, 16), feetG = factor(outfit.lookFeet, 8), feetB = factor(outfit.lookFeet, 0);
+
+        const __m128i byteMask = _mm_set1_epi32(0xFF);
+        const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        const size_t count = pixelCount & ~static_cast<size_t>(3);
+        for (size_t i = 0; i < count; i += 4) {
+            __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(basePixels + i * 4));
+            __m128i tp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(templatePixels + i * 4));
+
+            // All-ones lanes where the template channel is zero
+            __m128i zr = _mm_cmpeq_epi32(_mm_and_si128(tp, byteMask), zero);
+            __m128i zg = _mm_cmpeq_epi32(_mm_and_si128(_mm_srli_epi32(tp, 8), byteMask), zero);
+            __m128i zb = _mm_cmpeq_epi32(_mm_and_si128(_mm_srli_epi32(tp, 16), byteMask), zero);
+
+            // Same classification as getTemplatePartFromColor
+            __m128 head = _mm_castsi128_ps(_mm_andnot_si128(zr, _mm_andnot_si128(zg, zb)));
+            __m128 body = _mm_castsi128_ps(_mm_andnot_si128(zr, _mm_and_si128(zg, zb)));
+            __m128 legs = _mm_castsi128_ps(_mm_and_si128(zr, _mm_andnot_si128(zg, zb)));
+            __m128 feet = _mm_castsi128_ps(_mm_andnot_si128(zb, _mm_and_si128(zr, zg)));
+            __m128 any = _mm_or_ps(_mm_or_ps(head, body), _mm_or_ps(legs, feet));
+            if (_mm_movemask_ps(any) == 0) {
+                continue;  // No template pixels in this group
+            }
+
+            auto scale = [&](int shift, __m128 fHead, __m128 fBody, __m128 fLegs, __m128 fFeet) {
+                __m128 f = _mm_or_ps(_mm_or_ps(_mm_and_ps(head, fHead), _mm_and_ps(body, fBody)),
+                                     _mm_or_ps(_mm_and_ps(legs, fLegs), _mm_and_ps(feet, fFeet)));
+                f = _mm_or_ps(f, _mm_andnot_ps(any, one));
+                __m128i channel = _mm_and_si128(_mm_srli_epi32(px, shift), byteMask);
+                __m128 scaled = _mm_mul_ps(_mm_cvtepi32_ps(channel), f);
+                return _mm_slli_epi32(_mm_cvttps_epi32(scaled), shift);
+            };
+
+            __m128i out = _mm_and_si128(px, alphaMask);
+            out = _mm_or_si128(out, scale(0, headR, bodyR, legsR, feetR));
+            out = _mm_or_si128(out, scale(8, headG, bodyG, legsG, feetG));
+            out = _mm_or_si128(out, scale(16, headB, bodyB, legsB, feetB));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(basePixels + i * 4), out);
+        }
+        return count;
+    }
+#endif
 };
 
 } // namespace Rendering
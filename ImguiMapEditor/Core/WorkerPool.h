@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MapEditor {
+
+/**
+ * Persistent fork/join pool. The calling thread takes part in every run(),
+ * so a pool with no threads simply runs the jobs inline.
+ *
+ * Jobs receive a worker slot (0 = calling thread) so callers can give each
+ * thread its own output buffer without locking.
+ */
+class WorkerPool {
+public:
+  using Job = std::function<void(size_t job, size_t worker)>;
+
+  explicit WorkerPool(size_t thread_count) {
+    threads_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+      threads_.emplace_back([this, worker = i + 1] { workerLoop(worker); });
+    }
+  }
+
+  ~WorkerPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  // Number of worker slots, including the calling thread (slot 0)
+  size_t size() const { return threads_.size() + 1; }
+
+  /**
+   * Run job(0..job_count-1) across the pool and wait for all of them.
+   */
+  void run(size_t job_count, const Job &job) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      job_ = &job;
+      job_count_ = job_count;
+      next_job_.store(0, std::memory_order_relaxed);
+      busy_ = threads_.size();
+      ++generation_;
+    }
+    start_cv_.notify_all();
+
+    drain(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return busy_ == 0; });
+    job_ = nullptr;
+  }
+
+private:
+  void drain(size_t worker) {
+    for (size_t i = next_job_.fetch_add(1); i < job_count_;
+         i = next_job_.fetch_add(1)) {
+      (*job_)(i, worker);
+    }
+  }
+
+  void workerLoop(size_t worker) {
+    uint64_t seen = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        start_cv_.wait(lock,
+                       [&] { return shutdown_ || generation_ != seen; });
+        if (shutdown_)
+          return;
+        seen = generation_;
+      }
+
+      drain(worker);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--busy_ == 0) {
+        done_cv_.notify_one();
+      }
+    }
+  }
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  const Job *job_ = nullptr;
+  size_t job_count_ = 0;
+  std::atomic<size_t> next_job_{0};
+  size_t busy_ = 0;
+  uint64_t generation_ = 0;
+  bool shutdown_ = false;
+};
+
+} // namespace MapEditor
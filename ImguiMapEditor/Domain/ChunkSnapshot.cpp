@@ -0,0 +1,81 @@
+#include "Domain/ChunkSnapshot.h"
+#include "Domain/ChunkedMap.h"
+#include "Domain/Item.h"
+#include "Domain/Tile.h"
+
+namespace MapEditor::Domain {
+
+namespace {
+
+void appendContents(const Domain::Item &container,
+                    std::vector<ChunkSnapshot::Item> &items) {
+  for (const auto &item : container.getContainerItems()) {
+    if (item) {
+      items.push_back({item->getServerId(), item->getSubtype()});
+      appendContents(*item, items);
+    }
+  }
+}
+
+} // anonymous namespace
+
+std::shared_ptr<const ChunkSnapshot>
+ChunkSnapshot::build(const Domain::Chunk &chunk, int8_t z) {
+  auto snapshot = std::make_shared<ChunkSnapshot>();
+  snapshot->world_x = chunk.world_x;
+  snapshot->world_y = chunk.world_y;
+  snapshot->z = z;
+  snapshot->revision = chunk.getRevision();
+
+  chunk.forEachTileWithCoords(
+      [&](const Domain::Tile *tile, int local_x, int local_y) {
+        Tile entry;
+        entry.index = static_cast<uint16_t>(local_y * Domain::Chunk::SIZE +
+                                            local_x);
+        entry.flags = static_cast<uint16_t>(tile->getFlags());
+        entry.first_item = static_cast<uint32_t>(snapshot->items.size());
+
+        if (const Domain::Item *ground = tile->getGround()) {
+          snapshot->items.push_back({ground->getServerId(),
+                                     ground->getSubtype()});
+          entry.state |= Tile::HAS_GROUND;
+        }
+        for (const auto &item : tile->getItems()) {
+          if (item) {
+            snapshot->items.push_back({item->getServerId(),
+                                       item->getSubtype()});
+          }
+        }
+        entry.item_count = static_cast<uint16_t>(snapshot->items.size() -
+                                                 entry.first_item);
+
+        for (const auto &item : tile->getItems()) {
+          if (item) {
+            appendContents(*item, snapshot->items);
+          }
+        }
+        entry.content_count = static_cast<uint16_t>(
+            snapshot->items.size() - entry.first_item - entry.item_count);
+
+        if (const Domain::Creature *creature = tile->getCreature()) {
+          entry.creature =
+              static_cast<uint16_t>(snapshot->creature_names.size());
+          snapshot->creature_names.push_back(creature->name);
+        }
+        if (tile->hasCreature())
+          entry.state |= Tile::HAS_CREATURE;
+        if (tile->hasSpawn())
+          entry.state |= Tile::HAS_SPAWN;
+        if (tile->isHouseTile())
+          entry.state |= Tile::IS_HOUSE;
+
+        snapshot->tiles.push_back(entry);
+      });
+
+  snapshot->tiles.shrink_to_fit();
+  snapshot->items.shrink_to_fit();
+  snapshot->creature_names.shrink_to_fit();
+  return snapshot;
+}
+
+} // namespace MapEditor::Domain
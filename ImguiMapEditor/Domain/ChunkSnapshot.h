@@ -0,0 +1,59 @@
+#pragma once
+#include "Core/Config.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MapEditor::Domain {
+
+class Chunk;
+
+/**
+ * Immutable, compact copy of what rendering and map search read from one
+ * chunk, safe to read from any thread while the live map keeps changing.
+ *
+ * Tiles are listed in storage order (row-major) with their items flattened
+ * into one array, ground first, followed by the contents of any containers
+ * in the stack (depth-first). Item types are resolved by the reader, so a
+ * snapshot only changes when the chunk is edited.
+ */
+struct ChunkSnapshot {
+  struct Item {
+    uint16_t server_id = 0;
+    uint16_t subtype = 0; // Count / fluid type / charges
+  };
+
+  struct Tile {
+    static constexpr uint8_t HAS_GROUND = 1 << 0;
+    static constexpr uint8_t HAS_CREATURE = 1 << 1;
+    static constexpr uint8_t HAS_SPAWN = 1 << 2;
+    static constexpr uint8_t IS_HOUSE = 1 << 3;
+    static constexpr uint16_t NO_CREATURE = 0xFFFF;
+
+    uint16_t index = 0;              // local_y * Chunk::SIZE + local_x
+    uint16_t flags = 0;              // Domain::TileFlag bits
+    uint32_t first_item = 0;         // Into items
+    uint16_t item_count = 0;         // Including ground
+    uint16_t content_count = 0;      // Container contents after the stack
+    uint16_t creature = NO_CREATURE; // Into creature_names
+    uint8_t state = 0;               // HAS_* / IS_HOUSE bits
+
+    int localX() const { return index % Config::Performance::CHUNK_SIZE; }
+    int localY() const { return index / Config::Performance::CHUNK_SIZE; }
+  };
+
+  int32_t world_x = 0;
+  int32_t world_y = 0;
+  int8_t z = 0;
+  uint32_t revision = 0; // Domain::Chunk revision copied
+
+  std::vector<Tile> tiles;
+  std::vector<Item> items;
+  std::vector<std::string> creature_names;
+
+  static std::shared_ptr<const ChunkSnapshot>
+  build(const Domain::Chunk &chunk, int8_t z);
+};
+
+} // namespace MapEditor::Domain
@@ -1,4 +1,5 @@
 #include "ChunkedMap.h"
+#include <atomic>
 #include <limits>
 #include <algorithm>
 #include <ranges>
@@ -75,6 +76,8 @@ std::unique_ptr<Tile> Chunk::removeTile(int local_x, int local_y) {
     if (tiles_[idx]->hasCreature())
       creature_count_--;
     setDirty(true);
+    // Detached: later edits of the tile must not touch this chunk's counts
+    tiles_[idx]->setParentChunk(nullptr);
     return std::move(tiles_[idx]);
   }
   return nullptr;
@@ -110,6 +113,31 @@ void Chunk::updateSpawnCache() const {
   spawns_dirty_ = false;
 }
 
+uint32_t Chunk::nextRevision() {
+  static std::atomic<uint32_t> counter{0};
+  return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void Chunk::relocate(int32_t new_world_x, int32_t new_world_y, int16_t z) {
+  world_x = new_world_x;
+  world_y = new_world_y;
+
+  for (int i = 0; i < TILE_COUNT; ++i) {
+    Tile *tile = tiles_[i].get();
+    if (!tile) {
+      continue;
+    }
+    const Position pos(world_x + i % SIZE, world_y + i / SIZE, z);
+    tile->setPosition(pos);
+    if (Spawn *spawn = tile->getSpawn()) {
+      spawn->position = pos;
+    }
+  }
+
+  invalidateSpawns();
+  setDirty(true);
+}
+
 // ========== ChunkedFloor Implementation ==========
 
 Tile *ChunkedFloor::getTile(int32_t x, int32_t y) const {
@@ -206,13 +234,58 @@ Chunk *ChunkedFloor::getOrCreateChunk(int32_t chunk_x, int32_t chunk_y) {
 
   Chunk *ptr = chunk.get();
   chunks_[key] = std::move(chunk);
+  addChunkToSuper(chunk_x, chunk_y);
 
   return ptr;
 }
 
+std::unique_ptr<Chunk> ChunkedFloor::extractChunk(int32_t chunk_x,
+                                                  int32_t chunk_y) {
+  auto it = chunks_.find(chunkKey(chunk_x, chunk_y));
+  if (it == chunks_.end()) {
+    return nullptr;
+  }
+  std::unique_ptr<Chunk> chunk = std::move(it->second);
+  chunks_.erase(it);
+  removeChunkFromSuper(chunk_x, chunk_y);
+  return chunk;
+}
+
+std::unique_ptr<Chunk> ChunkedFloor::insertChunk(int32_t chunk_x,
+                                                 int32_t chunk_y,
+                                                 std::unique_ptr<Chunk> chunk) {
+  auto [it, inserted] = chunks_.try_emplace(chunkKey(chunk_x, chunk_y));
+  if (!inserted) {
+    return chunk; // Occupied - caller falls back to per-tile merge
+  }
+  it->second = std::move(chunk);
+  addChunkToSuper(chunk_x, chunk_y);
+  return nullptr;
+}
+
+void ChunkedFloor::addChunkToSuper(int32_t chunk_x, int32_t chunk_y) {
+  ++super_chunks_[chunkKey(chunk_x >> SUPER_SHIFT, chunk_y >> SUPER_SHIFT)];
+  layout_revision_ = nextLayoutRevision();
+}
+
+void ChunkedFloor::removeChunkFromSuper(int32_t chunk_x, int32_t chunk_y) {
+  auto it =
+      super_chunks_.find(chunkKey(chunk_x >> SUPER_SHIFT, chunk_y >> SUPER_SHIFT));
+  if (it != super_chunks_.end() && --it->second == 0) {
+    super_chunks_.erase(it);
+  }
+  layout_revision_ = nextLayoutRevision();
+}
+
+uint32_t ChunkedFloor::nextLayoutRevision() {
+  static std::atomic<uint32_t> counter{0};
+  return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
 void ChunkedFloor::getChunksInRegion(int32_t min_x, int32_t min_y,
                                      int32_t max_x, int32_t max_y,
-                                     std::vector<Chunk *> &out_result) const {
+                                     std::vector<Chunk *> &out_result,
+                                     bool include_empty) const {
   // Convert to chunk coordinates
   int32_t min_chunk_x = min_x >> 5; // floor(min_x / 32)
   int32_t min_chunk_y = min_y >> 5;
@@ -251,11 +324,14 @@ void ChunkedFloor::getChunksInRegion(int32_t min_x, int32_t min_y,
     }
 
     // BOLT OPTIMIZATION: Hybrid Iteration Strategy
-    // If the query region (viewport) is significantly larger than the number of
+    // If the query region (viewport) covers more super-chunks than there are
     // populated chunks, it's faster to iterate the sparse map of existing
-    // chunks than to check every coordinate in the dense grid. Factor 2
-    // accounts for unordered_map iteration overhead vs hash lookup.
-    if (total_chunks * 2 < region_area) {
+    // chunks than to probe the grid.
+    size_t super_width = static_cast<size_t>(
+        (max_chunk_x >> SUPER_SHIFT) - (min_chunk_x >> SUPER_SHIFT) + 1);
+    size_t super_height = static_cast<size_t>(
+        (max_chunk_y >> SUPER_SHIFT) - (min_chunk_y >> SUPER_SHIFT) + 1);
+    if (total_chunks < super_width * super_height) {
       // Sparse Iteration: O(TotalChunks)
       // C++20: Iterate over values (chunks) directly using ranges
       for (const auto &chunk : chunks_ | std::views::values) {
@@ -265,22 +341,48 @@ void ChunkedFloor::getChunksInRegion(int32_t min_x, int32_t min_y,
         // Simple bounds check
         if (cx >= min_chunk_x && cx <= max_chunk_x && cy >= min_chunk_y &&
             cy <= max_chunk_y) {
-          if (!chunk->isEmpty()) {
+          if (include_empty || !chunk->isEmpty()) {
             out_result.push_back(chunk.get());
           }
         }
       }
     } else {
-      // Dense Iteration: O(RegionArea)
-      // C++20: Use iota views for coordinate ranges
-      auto y_range = std::views::iota(min_chunk_y, max_chunk_y + 1);
-      auto x_range = std::views::iota(min_chunk_x, max_chunk_x + 1);
-
-      for (int32_t cy : y_range) {
-        for (int32_t cx : x_range) {
-          Chunk *chunk = getChunk(cx, cy);
-          if (chunk && !chunk->isEmpty()) {
-            out_result.push_back(chunk);
+      // Dense Iteration: O(SuperChunks + OccupiedArea)
+      // One lookup per super-chunk rejects empty 8x8 blocks (ocean) in bulk;
+      // chunks are still probed row by row so the output is row-major.
+      const int32_t min_super_x = min_chunk_x >> SUPER_SHIFT;
+      std::vector<uint8_t> occupied(super_width);
+
+      for (int32_t sy = min_chunk_y >> SUPER_SHIFT;
+           sy <= (max_chunk_y >> SUPER_SHIFT); ++sy) {
+        bool any = false;
+        for (size_t i = 0; i < super_width; ++i) {
+          occupied[i] = super_chunks_.contains(
+              chunkKey(min_super_x + static_cast<int32_t>(i), sy));
+          any = any || occupied[i];
+        }
+        if (!any) {
+          continue;
+        }
+
+        const int32_t row_begin = std::max(min_chunk_y, sy << SUPER_SHIFT);
+        const int32_t row_end =
+            std::min(max_chunk_y, (sy << SUPER_SHIFT) + SUPER_SIZE - 1);
+        for (int32_t cy = row_begin; cy <= row_end; ++cy) {
+          for (size_t i = 0; i < super_width; ++i) {
+            if (!occupied[i]) {
+              continue;
+            }
+            const int32_t sx = min_super_x + static_cast<int32_t>(i);
+            const int32_t col_begin = std::max(min_chunk_x, sx << SUPER_SHIFT);
+            const int32_t col_end =
+                std::min(max_chunk_x, (sx << SUPER_SHIFT) + SUPER_SIZE - 1);
+            for (int32_t cx = col_begin; cx <= col_end; ++cx) {
+              Chunk *chunk = getChunk(cx, cy);
+              if (chunk && (include_empty || !chunk->isEmpty())) {
+                out_result.push_back(chunk);
+              }
+            }
           }
         }
       }
@@ -296,7 +398,11 @@ size_t ChunkedFloor::getTileCount() const {
   return count;
 }
 
-void ChunkedFloor::clear() { chunks_.clear(); }
+void ChunkedFloor::clear() {
+  chunks_.clear();
+  super_chunks_.clear();
+  layout_revision_ = nextLayoutRevision();
+}
 
 // ========== ChunkedMap Implementation ==========
 
@@ -361,11 +467,20 @@ bool ChunkedMap::hasTile(const Position &pos) const {
 
 void ChunkedMap::getVisibleChunks(int32_t min_x, int32_t min_y, int32_t max_x,
                                   int32_t max_y, int16_t floor,
-                                  std::vector<Chunk *> &out_result) const {
+                                  std::vector<Chunk *> &out_result,
+                                  bool include_empty) const {
   if (floor < FLOOR_MIN || floor > FLOOR_MAX) {
     return;
   }
-  floors_[floor].getChunksInRegion(min_x, min_y, max_x, max_y, out_result);
+  floors_[floor].getChunksInRegion(min_x, min_y, max_x, max_y, out_result,
+                                   include_empty);
+}
+
+uint32_t ChunkedMap::getLayoutRevision(int16_t floor) const {
+  if (floor < FLOOR_MIN || floor > FLOOR_MAX) {
+    return 0;
+  }
+  return floors_[floor].getLayoutRevision();
 }
 
 const Chunk *ChunkedMap::getChunk(int32_t chunk_x, int32_t chunk_y, int16_t z) const {
@@ -375,6 +490,27 @@ const Chunk *ChunkedMap::getChunk(int32_t chunk_x, int32_t chunk_y, int16_t z) c
   return floors_[z].getChunk(chunk_x, chunk_y);
 }
 
+std::unique_ptr<Chunk> ChunkedMap::extractChunk(int32_t chunk_x,
+                                                int32_t chunk_y, int16_t z) {
+  if (z < FLOOR_MIN || z > FLOOR_MAX) {
+    return nullptr;
+  }
+  return floors_[z].extractChunk(chunk_x, chunk_y);
+}
+
+std::unique_ptr<Chunk> ChunkedMap::insertChunk(int32_t chunk_x,
+                                               int32_t chunk_y, int16_t z,
+                                               std::unique_ptr<Chunk> chunk) {
+  if (!chunk || z < FLOOR_MIN || z > FLOOR_MAX) {
+    return chunk;
+  }
+  if (floors_[z].getChunk(chunk_x, chunk_y)) {
+    return chunk;
+  }
+  chunk->relocate(chunk_x * Chunk::SIZE, chunk_y * Chunk::SIZE, z);
+  return floors_[z].insertChunk(chunk_x, chunk_y, std::move(chunk));
+}
+
 void ChunkedMap::notifySpawnChange(const Position &pos, bool added) {
   if (pos.z < FLOOR_MIN || pos.z > FLOOR_MAX)
     return;
@@ -224,6 +224,13 @@ public:
    */
   bool isEmpty() const { return non_empty_count_ == 0; }
 
+  /**
+   * Move the chunk to a new world origin.
+   * Rewrites tile and spawn positions in place and marks the chunk dirty;
+   * tiles, items and cached counts are kept as-is.
+   */
+  void relocate(int32_t new_world_x, int32_t new_world_y, int16_t z);
+
   /**
    * Get number of non-empty tiles.
    */
@@ -251,7 +258,10 @@ public:
    * Update creature count (called by Tile::setCreature).
    * @param delta +1 or -1
    */
-  void updateCreatureCount(int delta) { creature_count_ += delta; }
+  void updateCreatureCount(int delta) {
+    creature_count_ += delta;
+    revision_ = nextRevision();
+  }
 
   // STATIC MESH CACHING (Phase 2 Optimization)
   // When dirty=true, rebuildChunkMesh() will regenerate static geometry.
@@ -259,7 +269,27 @@ public:
   // Animated items rendered separately via SpriteBatch.
 
   bool isDirty() const { return dirty_; }
-  void setDirty(bool d = true) { dirty_ = d; }
+  void setDirty(bool d = true) {
+    dirty_ = d;
+    if (d) {
+      revision_ = nextRevision();
+    }
+  }
+
+  /**
+   * Bump the edit revision without requesting a mesh rebuild. Used for
+   * changes drawn outside the static mesh (spawns, creatures).
+   */
+  void bumpRevision() { revision_ = nextRevision(); }
+
+  /**
+   * Get edit revision. Changes whenever a tile, item, spawn or creature in
+   * this chunk changes through Tile's mutators; code editing an Item, Spawn
+   * or Creature in place calls Tile::markDirty() afterwards. Revisions are
+   * unique across chunks, so a cache keyed by chunk position also notices
+   * when the chunk was replaced.
+   */
+  uint32_t getRevision() const { return revision_; }
 
   // GPU mesh handle for static geometry (0 = no cache)
   uint32_t cached_static_mesh_id = 0;
@@ -273,12 +303,15 @@ private:
   // Rebuild the spawn cache if dirty
   void updateSpawnCache() const;
 
+  static uint32_t nextRevision();
+
   // Dense array of tiles - cache-friendly!
   std::array<std::unique_ptr<Tile>, TILE_COUNT> tiles_;
   int non_empty_count_ = 0;
   int spawn_count_ = 0;
   int creature_count_ = 0;
   bool dirty_ = true; // Needs mesh rebuild
+  uint32_t revision_ = nextRevision();
 
   // Spawn Cache
   mutable std::vector<Tile *> spawn_tiles_;
@@ -320,12 +353,34 @@ public:
    */
   Chunk *getOrCreateChunk(int32_t chunk_x, int32_t chunk_y);
 
+  /**
+   * Detach a whole chunk from this floor.
+   * @return The chunk, or nullptr if none exists at these coordinates
+   */
+  std::unique_ptr<Chunk> extractChunk(int32_t chunk_x, int32_t chunk_y);
+
+  /**
+   * Attach a detached chunk at chunk coordinates.
+   * @return nullptr on success, or the chunk back if the slot is occupied
+   */
+  std::unique_ptr<Chunk> insertChunk(int32_t chunk_x, int32_t chunk_y,
+                                     std::unique_ptr<Chunk> chunk);
+
   /**
    * Get all chunks that intersect a world-coordinate bounding box.
    * Appends non-null chunks to the output vector.
+   * @param include_empty Also return allocated chunks without tiles
    */
   void getChunksInRegion(int32_t min_x, int32_t min_y, int32_t max_x,
-                         int32_t max_y, std::vector<Chunk *> &out_result) const;
+                         int32_t max_y, std::vector<Chunk *> &out_result,
+                         bool include_empty = false) const;
+
+  /**
+   * Get layout revision. Changes whenever a chunk is allocated, detached,
+   * attached or the floor is cleared (not on tile edits). Unique map-wide
+   * like chunk revisions, so floors of different maps never match.
+   */
+  uint32_t getLayoutRevision() const { return layout_revision_; }
 
   /**
    * Iterate over all tiles on this floor (const version).
@@ -381,8 +436,22 @@ private:
     local_y = world_y & 0x1F;
   }
 
+  // Super-chunks: SUPER_SIZE x SUPER_SIZE chunks, for rejecting empty
+  // regions (ocean, unmapped areas) with one lookup
+  static constexpr int SUPER_SHIFT = 3;
+  static constexpr int SUPER_SIZE = 1 << SUPER_SHIFT;
+
+  void addChunkToSuper(int32_t chunk_x, int32_t chunk_y);
+  void removeChunkFromSuper(int32_t chunk_x, int32_t chunk_y);
+
+  static uint32_t nextLayoutRevision();
+
   // Sparse chunk storage - most of 60k x 60k map is empty
   std::unordered_map<uint64_t, std::unique_ptr<Chunk>> chunks_;
+
+  // Allocated chunk count per super-chunk (absent = none)
+  std::unordered_map<uint64_t, uint32_t> super_chunks_;
+  uint32_t layout_revision_ = nextLayoutRevision();
 };
 
 /**
@@ -425,7 +494,14 @@ public:
    */
   void getVisibleChunks(int32_t min_x, int32_t min_y, int32_t max_x,
                         int32_t max_y, int16_t floor,
-                        std::vector<Chunk *> &out_result) const;
+                        std::vector<Chunk *> &out_result,
+                        bool include_empty = false) const;
+
+  /**
+   * Get a floor's layout revision (see ChunkedFloor::getLayoutRevision).
+   * Visible chunk sets may be reused while it and the region are unchanged.
+   */
+  uint32_t getLayoutRevision(int16_t floor) const;
 
   /**
    * Get chunk directly from chunk coordinates.
@@ -433,6 +509,19 @@ public:
    */
   const Chunk *getChunk(int32_t chunk_x, int32_t chunk_y, int16_t z) const;
 
+  /**
+   * Detach a whole chunk (bulk region moves).
+   */
+  std::unique_ptr<Chunk> extractChunk(int32_t chunk_x, int32_t chunk_y,
+                                      int16_t z);
+
+  /**
+   * Attach a detached chunk, relocating its tiles to the new coordinates.
+   * @return nullptr on success, or the chunk back if the slot is occupied
+   */
+  std::unique_ptr<Chunk> insertChunk(int32_t chunk_x, int32_t chunk_y,
+                                     int16_t z, std::unique_ptr<Chunk> chunk);
+
   /**
    * Notify map that a spawn was added or removed at position.
    * Updates the corresponding chunk's spawn count.
@@ -4,8 +4,8 @@
 namespace MapEditor::Domain::History {
 
 HistoryBuffer::HistoryBuffer(const HistoryConfig& config)
-    : entries_(config.max_entries)
-    , config_(config) {
+    : config_(config)
+    , spill_file_(config.spill_directory) {
 }
 
 void HistoryBuffer::push(std::unique_ptr<HistoryEntry> entry) {
@@ -13,28 +13,50 @@ void HistoryBuffer::push(std::unique_ptr<HistoryEntry> entry) {
         return;
     }
     
+    // Sample early entries until the LZ4 dictionary is full
+    if (config_.enable_compression && !dictionary_ && config_.dictionary_size > 0) {
+        entry->appendTrainingSample(training_sample_, config_.dictionary_size);
+        if (training_sample_.size() >= config_.dictionary_size) {
+            dictionary_ = std::make_shared<const std::vector<uint8_t>>(std::move(training_sample_));
+            training_sample_ = {};
+            spdlog::debug("[History] Compression dictionary ready ({} bytes)", dictionary_->size());
+        }
+    }
+    
     // Compress the entry
-    entry->compress(config_.enable_compression);
+    entry->compress(config_.enable_compression, dictionary_);
     
     // Clear any redo entries (entries after current position)
     while (entries_.size() > current_index_) {
-        current_memory_ -= entries_.back()->memsize();
+        current_memory_ -= entries_.back().entry->memsize();
+        release(entries_.back());
         entries_.pop_back();
     }
+    hot_end_ = current_index_;
     
     // Track memory
     size_t entry_size = entry->memsize();
     current_memory_ += entry_size;
     
     // Add new entry
-    entries_.push_back(std::move(entry));
+    entries_.push_back(Slot{std::move(entry), {}});
     current_index_ = entries_.size();
+    hot_end_ = entries_.size();
+    
+    // Nothing left on disk - reclaim the scratch file
+    if (hot_begin_ == 0 && spill_file_.size() > 0) {
+        spill_file_.reset();
+        for (Slot& slot : entries_) {
+            slot.record = {};
+        }
+    }
     
     // Trim if over memory limit
-    trimToMemoryLimit();
+    trimToMemoryLimit(current_index_ - 1);
+    compactSpillFile();
     
-    spdlog::debug("[History] Pushed entry, {} entries, {} bytes", 
-                  entries_.size(), current_memory_);
+    spdlog::debug("[History] Pushed entry, {} entries ({} in memory), {} bytes",
+                  entries_.size(), hot_end_ - hot_begin_, current_memory_);
 }
 
 HistoryEntry* HistoryBuffer::moveBack() {
@@ -42,8 +64,18 @@ HistoryEntry* HistoryBuffer::moveBack() {
         return nullptr;
     }
     
+    Slot& slot = entries_[current_index_ - 1];
+    if (slot.entry->isSpilled()) {
+        if (!reload(slot)) {
+            return nullptr;
+        }
+        hot_begin_ = current_index_ - 1;
+    }
+    
     --current_index_;
-    return entries_[current_index_].get();
+    HistoryEntry* entry = slot.entry.get();
+    trimToMemoryLimit(current_index_);
+    return entry;
 }
 
 HistoryEntry* HistoryBuffer::moveForward() {
@@ -51,8 +83,17 @@ HistoryEntry* HistoryBuffer::moveForward() {
         return nullptr;
     }
     
-    HistoryEntry* entry = entries_[current_index_].get();
+    Slot& slot = entries_[current_index_];
+    if (slot.entry->isSpilled()) {
+        if (!reload(slot)) {
+            return nullptr;
+        }
+        hot_end_ = current_index_ + 1;
+    }
+    
+    HistoryEntry* entry = slot.entry.get();
     ++current_index_;
+    trimToMemoryLimit(current_index_ - 1);
     return entry;
 }
 
@@ -60,28 +101,110 @@ std::string HistoryBuffer::getUndoDescription() const {
     if (!canUndo()) {
         return "";
     }
-    return entries_[current_index_ - 1]->getDescription();
+    return entries_[current_index_ - 1].entry->getDescription();
 }
 
 std::string HistoryBuffer::getRedoDescription() const {
     if (!canRedo()) {
         return "";
     }
-    return entries_[current_index_]->getDescription();
+    return entries_[current_index_].entry->getDescription();
 }
 
 void HistoryBuffer::clear() {
     entries_.clear();
     current_index_ = 0;
+    hot_begin_ = 0;
+    hot_end_ = 0;
     current_memory_ = 0;
+    spill_file_.reset();
+    spill_failed_ = false;
+}
+
+bool HistoryBuffer::spill(Slot& slot) {
+    // Written before and reloaded since: the record still holds the payload
+    if (slot.record.size == 0) {
+        auto payload = slot.entry->serializePayload();
+        if (payload.empty()) {
+            return false;
+        }
+        
+        auto record = spill_file_.append(payload);
+        if (!record) {
+            return false;
+        }
+        slot.record = *record;
+    }
+    
+    const size_t resident_size = slot.entry->memsize();
+    slot.entry->dropPayload();
+    current_memory_ -= resident_size - slot.entry->memsize();
+    return true;
+}
+
+bool HistoryBuffer::reload(Slot& slot) {
+    std::vector<uint8_t> payload;
+    const size_t spilled_size = slot.entry->memsize();
+    if (!spill_file_.read(slot.record, payload) || !slot.entry->restorePayload(payload)) {
+        spdlog::error("[History] Could not reload '{}' from disk", slot.entry->getDescription());
+        return false;
+    }
+    current_memory_ += slot.entry->memsize() - spilled_size;
+    return true;
+}
+
+void HistoryBuffer::release(Slot& slot) {
+    if (slot.record.size > 0) {
+        spill_file_.release(slot.record);
+        slot.record = {};
+    }
 }
 
-void HistoryBuffer::trimToMemoryLimit() {
-    // Remove oldest entries if over memory limit
-    while (current_memory_ > config_.max_memory_bytes && !entries_.empty()) {
-        size_t oldest_size = entries_.front()->memsize();
+void HistoryBuffer::compactSpillFile() {
+    const uint64_t dead = spill_file_.deadBytes();
+    if (dead < config_.spill_compact_bytes || dead <= spill_file_.size() - dead) {
+        return;
+    }
+    
+    std::vector<HistorySpillFile::Record*> records;
+    for (Slot& slot : entries_) {
+        if (slot.record.size > 0) {
+            records.push_back(&slot.record);
+        }
+    }
+    if (!spill_file_.compact(records)) {
+        spdlog::warn("[History] Could not compact spill file, keeping {} dead bytes", dead);
+    }
+}
+
+void HistoryBuffer::trimToMemoryLimit(size_t protect) {
+    auto over_limit = [&]() {
+        return current_memory_ > config_.max_memory_bytes ||
+               hot_end_ - hot_begin_ > config_.max_entries;
+    };
+    
+    while (over_limit() && hot_end_ - hot_begin_ > 1) {
+        if (config_.spill_to_disk && !spill_failed_) {
+            // Evict from the end of the window farther from the entry in use
+            const bool front = protect - hot_begin_ >= hot_end_ - 1 - protect;
+            Slot& victim = entries_[front ? hot_begin_ : hot_end_ - 1];
+            if (spill(victim)) {
+                front ? ++hot_begin_ : --hot_end_;
+                continue;
+            }
+            spdlog::warn("[History] Spilling failed, dropping oldest entries instead");
+            spill_failed_ = true;
+        }
+        
+        // Remove oldest entries (only while nothing older is on disk)
+        if (hot_begin_ != 0 || protect == 0) {
+            break;
+        }
+        current_memory_ -= entries_.front().entry->memsize();
+        release(entries_.front());
         entries_.pop_front();
-        current_memory_ -= oldest_size;
+        --hot_end_;
+        --protect;
         
         // Adjust current index
         if (current_index_ > 0) {
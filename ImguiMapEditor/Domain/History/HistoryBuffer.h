@@ -1,14 +1,27 @@
 #pragma once
 #include "HistoryEntry.h"
 #include "HistoryConfig.h"
-#include <boost/circular_buffer.hpp>
+#include "HistorySpillFile.h"
+#include <deque>
 #include <memory>
+#include <vector>
 
 namespace MapEditor::Domain::History {
 
 /**
- * Circular buffer wrapper for history entries.
- * Uses Boost.CircularBuffer for efficient fixed-size undo/redo storage.
+ * Tiered undo/redo storage.
+ *
+ * Entries around the current position stay in memory (hot window), bounded
+ * by max_entries and max_memory_bytes. Entries outside the window have their
+ * payload spilled to an append-only scratch file and are reloaded from the
+ * memory-mapped file when undo/redo reaches them, so depth is unbounded
+ * while undo of recent actions never touches the disk. Payloads never change
+ * once pushed, so a reloaded entry keeps its record and leaving the window
+ * again costs no write. Records of discarded entries are reclaimed by
+ * compacting the file.
+ *
+ * Without spilling (disabled or file unavailable) the oldest entries are
+ * dropped instead.
  */
 class HistoryBuffer {
 public:
@@ -56,6 +69,11 @@ public:
      */
     size_t totalMemory() const { return current_memory_; }
     
+    /**
+     * Get bytes written to the spill file.
+     */
+    uint64_t diskUsage() const { return spill_file_.size(); }
+    
     /**
      * Get number of entries.
      */
@@ -67,13 +85,44 @@ public:
     void clear();
     
 private:
-    void trimToMemoryLimit();
+    struct Slot {
+        std::unique_ptr<HistoryEntry> entry;
+        HistorySpillFile::Record record;  // Payload on disk (size 0 = none)
+    };
+    
+    // Mark the slot's record as dead before the slot is discarded
+    void release(Slot& slot);
+    
+    // Rewrite the spill file once dead records outweigh live ones
+    void compactSpillFile();
+    
+    // Spill (or drop) entries until within limits, never touching protect
+    void trimToMemoryLimit(size_t protect);
     
-    boost::circular_buffer<std::unique_ptr<HistoryEntry>> entries_;
+    // Spill one entry; false if it could not be written
+    bool spill(Slot& slot);
+    
+    // Reload a spilled entry; false if the record could not be read
+    bool reload(Slot& slot);
+    
+    std::deque<Slot> entries_;
     size_t current_index_ = 0;  // Points to next redo position
     
+    // Resident entries are exactly [hot_begin_, hot_end_), which always
+    // contains the entries next to current_index_
+    size_t hot_begin_ = 0;
+    size_t hot_end_ = 0;
+    
     HistoryConfig config_;
     size_t current_memory_ = 0;
+    
+    // LZ4 dictionary built from the first entries' tile data; shared with
+    // every entry compressed against it
+    std::vector<uint8_t> training_sample_;
+    std::shared_ptr<const std::vector<uint8_t>> dictionary_;
+    
+    HistorySpillFile spill_file_;
+    bool spill_failed_ = false;
 };
 
 } // namespace MapEditor::Domain::History
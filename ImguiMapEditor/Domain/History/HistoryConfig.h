@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <filesystem>
 
 namespace MapEditor::Domain::History {
 
@@ -9,17 +10,31 @@ namespace MapEditor::Domain::History {
  * Configuration for the history/undo-redo system.
  */
 struct HistoryConfig {
-    // Maximum number of history entries
+    // Maximum number of history entries kept in memory
     size_t max_entries = 500;
     
     // Maximum memory usage in bytes (256 MB default)
     size_t max_memory_bytes = 256 * 1024 * 1024;
     
+    // Move entries beyond the memory limits to a scratch file instead of
+    // dropping them (unbounded undo depth)
+    bool spill_to_disk = true;
+    
+    // Directory for the scratch file (empty = system temp directory)
+    std::filesystem::path spill_directory;
+    
+    // Rewrite the scratch file once the payloads of dropped entries take up
+    // this many bytes and more than the live ones
+    uint64_t spill_compact_bytes = 64 * 1024 * 1024;
+    
     // Enable LZ4 compression for tile snapshots
     bool enable_compression = true;
     
     // Minimum size to compress (skip compression for tiny data)
     size_t min_compress_size = 64;
+    
+    // LZ4 dictionary sampled from the first entries' tile data (0 = disabled)
+    size_t dictionary_size = 32 * 1024;
 };
 
 } // namespace MapEditor::Domain::History
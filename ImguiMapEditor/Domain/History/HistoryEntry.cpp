@@ -3,92 +3,403 @@
 #include "Services/ClientDataService.h"
 #include "Services/Selection/SelectionService.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
 
 namespace MapEditor::Domain::History {
 
+namespace {
+template<typename T>
+void write(std::vector<uint8_t>& buf, T value) {
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&value);
+    buf.insert(buf.end(), ptr, ptr + sizeof(T));
+}
+
+template<typename T>
+bool read(const uint8_t*& ptr, const uint8_t* end, T& value) {
+    if (end - ptr < static_cast<ptrdiff_t>(sizeof(T))) return false;
+    std::memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+}
+
+void writePosition(std::vector<uint8_t>& buf, const Position& pos) {
+    write(buf, pos.x);
+    write(buf, pos.y);
+    write(buf, pos.z);
+}
+
+bool readPosition(const uint8_t*& ptr, const uint8_t* end, Position& pos) {
+    return read(ptr, end, pos.x) && read(ptr, end, pos.y) && read(ptr, end, pos.z);
+}
+
+// Selection: [present: u8] then [count: u32] x [position][type: u8][local_id: u64][ptr: u64][item_id: u16]
+void writeSelection(std::vector<uint8_t>& buf,
+                    const std::optional<Selection::SelectionSnapshot>& snapshot) {
+    write(buf, static_cast<uint8_t>(snapshot ? 1 : 0));
+    if (!snapshot) return;
+    
+    const auto& bucket = snapshot->getBucket();
+    write(buf, static_cast<uint32_t>(bucket.size()));
+    bucket.forEachChunk([&](const Selection::SelectionChunk& chunk) {
+        for (const auto& entry : chunk.entries) {
+            writePosition(buf, entry.id.position);
+            write(buf, static_cast<uint8_t>(entry.id.type));
+            write(buf, entry.id.local_id);
+            write(buf, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(entry.entity_ptr)));
+            write(buf, entry.item_id);
+        }
+    });
+}
+
+bool readSelection(const uint8_t*& ptr, const uint8_t* end,
+                   std::optional<Selection::SelectionSnapshot>& snapshot) {
+    uint8_t present;
+    if (!read(ptr, end, present)) return false;
+    if (!present) {
+        snapshot.reset();
+        return true;
+    }
+    
+    uint32_t count;
+    if (!read(ptr, end, count)) return false;
+    
+    Selection::SelectionBucket bucket;
+    for (uint32_t i = 0; i < count; ++i) {
+        Selection::SelectionEntry entry;
+        uint8_t type;
+        uint64_t entity_ptr;
+        if (!readPosition(ptr, end, entry.id.position) || !read(ptr, end, type) ||
+            !read(ptr, end, entry.id.local_id) || !read(ptr, end, entity_ptr) ||
+            !read(ptr, end, entry.item_id)) {
+            return false;
+        }
+        entry.id.type = static_cast<Selection::EntityType>(type);
+        entry.entity_ptr = reinterpret_cast<const void*>(static_cast<uintptr_t>(entity_ptr));
+        bucket.add(entry);
+    }
+    snapshot = Selection::SelectionSnapshot::capture(bucket);
+    return true;
+}
+
+// CRITICAL: Resolve ItemTypes for all items in a restored tile
+// Without this, items won't render and ground detection fails
+void resolveItemTypes(Tile* tile, Services::ClientDataService* clientData) {
+    if (!clientData) return;
+    
+    // Resolve ground item type
+    if (tile->hasGround()) {
+        Item* ground = tile->getGround();
+        if (ground && !ground->getType()) {
+            const ItemType* type = clientData->getItemTypeByServerId(ground->getServerId());
+            ground->setType(type);
+        }
+    }
+    
+    // Resolve stacked items types using getItem(index) for non-const access
+    for (size_t j = 0; j < tile->getItemCount(); ++j) {
+        Item* item = tile->getItem(j);
+        if (item && !item->getType()) {
+            const ItemType* type = clientData->getItemTypeByServerId(item->getServerId());
+            item->setType(type);
+        }
+    }
+}
+} // namespace
+
 HistoryEntry::HistoryEntry(const std::string& description, ActionType type)
     : description_(description)
     , type_(type) {
 }
 
-void HistoryEntry::addBeforeSnapshot(TileSnapshot snapshot) {
-    beforeSnapshots_.push_back(std::move(snapshot));
+void HistoryEntry::addTileChange(TileSnapshot before, TileSnapshot after, bool allow_delta) {
+    if (auto delta = allow_delta ? TileDelta::compute(before, after) : std::nullopt) {
+        deltas_.push_back(std::move(*delta));
+        return;
+    }
+    beforeSnapshots_.push_back(std::move(before));
+    afterSnapshots_.push_back(std::move(after));
+}
+
+void HistoryEntry::addBeforeRegion(RegionSnapshot region) {
+    beforeRegions_.push_back(std::move(region));
 }
 
-void HistoryEntry::addAfterSnapshot(TileSnapshot snapshot) {
-    afterSnapshots_.push_back(std::move(snapshot));
+void HistoryEntry::addAfterRegion(RegionSnapshot region) {
+    afterRegions_.push_back(std::move(region));
+}
+
+size_t HistoryEntry::tileCount() const {
+    size_t count = beforeSnapshots_.size() + deltas_.size();
+    for (const auto& region : beforeRegions_) {
+        count += region.tileCount();
+    }
+    return count;
 }
 
-void HistoryEntry::compress(bool enable) {
-    if (!enable || compressed_) return;
+void HistoryEntry::compress(bool enable, std::shared_ptr<const std::vector<uint8_t>> dictionary) {
+    if (compressed_) return;
     
-    // Compress BEFORE snapshots
-    beforeOriginalSizes_.reserve(beforeSnapshots_.size());
-    for (auto& snapshot : beforeSnapshots_) {
-        size_t original_size = snapshot.data().size();
-        beforeOriginalSizes_.push_back(original_size);
-        
-        if (original_size > 64) {  // Only compress if worth it
-            auto compressed = TileSnapshotCodec::compress(snapshot.data());
-            snapshot.setData(std::move(compressed));
+    // Regions compress as one block each
+    if (enable) {
+        for (auto& region : beforeRegions_) {
+            region.compress();
+        }
+        for (auto& region : afterRegions_) {
+            region.compress();
         }
     }
     
-    // Compress AFTER snapshots
-    afterOriginalSizes_.reserve(afterSnapshots_.size());
+    // Pack every per-tile blob into one buffer: tiny snapshots and deltas
+    // barely compress on their own, but neighbouring tiles of one operation
+    // share most of their bytes
+    std::vector<uint8_t> raw;
+    blobSizes_.reserve(beforeSnapshots_.size() + afterSnapshots_.size() + deltas_.size());
+    auto pack = [&](const std::vector<uint8_t>& data) {
+        blobSizes_.push_back(static_cast<uint32_t>(data.size()));
+        raw.insert(raw.end(), data.begin(), data.end());
+    };
+    for (auto& snapshot : beforeSnapshots_) {
+        pack(snapshot.data());
+        snapshot.setData({});
+    }
     for (auto& snapshot : afterSnapshots_) {
-        size_t original_size = snapshot.data().size();
-        afterOriginalSizes_.push_back(original_size);
-        
-        if (original_size > 64) {
-            auto compressed = TileSnapshotCodec::compress(snapshot.data());
-            snapshot.setData(std::move(compressed));
-        }
+        pack(snapshot.data());
+        snapshot.setData({});
+    }
+    for (auto& delta : deltas_) {
+        pack(delta.data());
+        delta.setData({});
+    }
+    
+    packedRawSize_ = raw.size();
+    auto compressed = enable ? TileSnapshotCodec::compress(raw, dictionary.get())
+                             : std::vector<uint8_t>{};
+    if (!compressed.empty() && compressed.size() < raw.size()) {
+        packed_ = std::move(compressed);
+        packedLz4_ = true;
+        dictionary_ = std::move(dictionary);
+    } else {
+        raw.shrink_to_fit();
+        packed_ = std::move(raw);
     }
     
     compressed_ = true;
 }
 
-void HistoryEntry::applySnapshots(ChunkedMap* map, 
-                                   const std::vector<TileSnapshot>& snapshots,
-                                   const std::vector<size_t>& originalSizes,
-                                   Services::ClientDataService* clientData) {
-    for (size_t i = 0; i < snapshots.size(); ++i) {
-        TileSnapshot snapshot = snapshots[i];  // Copy for decompression
+void HistoryEntry::appendTrainingSample(std::vector<uint8_t>& sample, size_t max_bytes) const {
+    if (compressed_) return;
+    
+    auto add = [&](const std::vector<uint8_t>& data) {
+        if (sample.size() >= max_bytes) return;
+        const size_t take = std::min(data.size(), max_bytes - sample.size());
+        sample.insert(sample.end(), data.begin(), data.begin() + take);
+    };
+    for (const auto& snapshot : afterSnapshots_) {
+        add(snapshot.data());
+    }
+    for (const auto& delta : deltas_) {
+        add(delta.data());
+    }
+}
+
+// Payload layout:
+// [pair count: u32][positions][delta count: u32][positions]
+// [blob count: u32][blob sizes: u32...][raw size: u64][lz4: u8][packed size: u64][packed]
+// [region count: u32][before regions][after regions]
+// [selection before][selection after]
+std::vector<uint8_t> HistoryEntry::serializePayload() const {
+    if (spilled_ || !compressed_) return {};
+    
+    std::vector<uint8_t> out;
+    out.reserve(packed_.size() + blobSizes_.size() * sizeof(uint32_t) +
+                (beforeSnapshots_.size() + deltas_.size()) * 10 + 64);
+    
+    write(out, static_cast<uint32_t>(beforeSnapshots_.size()));
+    for (const auto& snapshot : beforeSnapshots_) {
+        writePosition(out, snapshot.getPosition());
+    }
+    write(out, static_cast<uint32_t>(deltas_.size()));
+    for (const auto& delta : deltas_) {
+        writePosition(out, delta.getPosition());
+    }
+    
+    write(out, static_cast<uint32_t>(blobSizes_.size()));
+    for (uint32_t size : blobSizes_) {
+        write(out, size);
+    }
+    write(out, static_cast<uint64_t>(packedRawSize_));
+    write(out, static_cast<uint8_t>(packedLz4_ ? 1 : 0));
+    write(out, static_cast<uint64_t>(packed_.size()));
+    out.insert(out.end(), packed_.begin(), packed_.end());
+    
+    write(out, static_cast<uint32_t>(beforeRegions_.size()));
+    for (const auto& region : beforeRegions_) {
+        region.serialize(out);
+    }
+    for (const auto& region : afterRegions_) {
+        region.serialize(out);
+    }
+    
+    writeSelection(out, selection_before_);
+    writeSelection(out, selection_after_);
+    return out;
+}
+
+void HistoryEntry::dropPayload() {
+    // Drop everything but the description
+    std::vector<TileSnapshot>().swap(beforeSnapshots_);
+    std::vector<TileSnapshot>().swap(afterSnapshots_);
+    std::vector<TileDelta>().swap(deltas_);
+    std::vector<uint32_t>().swap(blobSizes_);
+    std::vector<uint8_t>().swap(packed_);
+    std::vector<RegionSnapshot>().swap(beforeRegions_);
+    std::vector<RegionSnapshot>().swap(afterRegions_);
+    selection_before_.reset();
+    selection_after_.reset();
+    spilled_ = true;
+}
+
+bool HistoryEntry::restorePayload(const std::vector<uint8_t>& payload) {
+    if (!spilled_) return true;
+    
+    const uint8_t* ptr = payload.data();
+    const uint8_t* end = ptr + payload.size();
+    
+    std::vector<TileSnapshot> snapshots;
+    std::vector<TileDelta> deltas;
+    std::vector<uint32_t> blob_sizes;
+    std::vector<uint8_t> packed;
+    std::vector<RegionSnapshot> before_regions, after_regions;
+    std::optional<Selection::SelectionSnapshot> selection_before, selection_after;
+    uint64_t raw_size = 0, packed_size = 0;
+    uint8_t lz4 = 0;
+    
+    uint32_t count;
+    if (!read(ptr, end, count)) return false;
+    snapshots.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        Position pos;
+        if (!readPosition(ptr, end, pos)) return false;
+        snapshots.push_back(TileSnapshot::capture(nullptr, pos));
+    }
+    
+    if (!read(ptr, end, count)) return false;
+    deltas.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        Position pos;
+        if (!readPosition(ptr, end, pos)) return false;
+        deltas.push_back(TileDelta::at(pos));
+    }
+    
+    if (!read(ptr, end, count)) return false;
+    blob_sizes.resize(count);
+    for (auto& size : blob_sizes) {
+        if (!read(ptr, end, size)) return false;
+    }
+    if (!read(ptr, end, raw_size) || !read(ptr, end, lz4) || !read(ptr, end, packed_size) ||
+        static_cast<uint64_t>(end - ptr) < packed_size) {
+        return false;
+    }
+    packed.assign(ptr, ptr + packed_size);
+    ptr += packed_size;
+    
+    if (!read(ptr, end, count)) return false;
+    before_regions.resize(count);
+    after_regions.resize(count);
+    for (auto& region : before_regions) {
+        if (!RegionSnapshot::deserialize(ptr, end, region)) return false;
+    }
+    for (auto& region : after_regions) {
+        if (!RegionSnapshot::deserialize(ptr, end, region)) return false;
+    }
+    
+    if (!readSelection(ptr, end, selection_before) || !readSelection(ptr, end, selection_after)) {
+        return false;
+    }
+    
+    beforeSnapshots_ = snapshots;
+    afterSnapshots_ = std::move(snapshots);
+    deltas_ = std::move(deltas);
+    blobSizes_ = std::move(blob_sizes);
+    packed_ = std::move(packed);
+    packedRawSize_ = static_cast<size_t>(raw_size);
+    packedLz4_ = lz4 != 0;
+    beforeRegions_ = std::move(before_regions);
+    afterRegions_ = std::move(after_regions);
+    selection_before_ = std::move(selection_before);
+    selection_after_ = std::move(selection_after);
+    spilled_ = false;
+    return true;
+}
+
+std::vector<uint8_t> HistoryEntry::unpack() const {
+    if (!packedLz4_) {
+        return packed_;
+    }
+    return TileSnapshotCodec::decompress(packed_, packedRawSize_, dictionary_.get());
+}
+
+bool HistoryEntry::applyTiles(ChunkedMap* map, bool undo,
+                              Services::ClientDataService* clientData) {
+    // Slice blobs back out of the packed block
+    std::vector<uint8_t> raw;
+    std::vector<size_t> offsets;
+    if (compressed_) {
+        raw = unpack();
+        if (raw.size() != packedRawSize_) {
+            spdlog::error("[History] Failed to decompress '{}'", description_);
+            return false;
+        }
+        offsets.reserve(blobSizes_.size());
+        size_t offset = 0;
+        for (uint32_t size : blobSizes_) {
+            offsets.push_back(offset);
+            offset += size;
+        }
+    }
+    auto load = [&](size_t blob, const std::vector<uint8_t>& stored) {
+        if (!compressed_) return stored;
+        auto first = raw.begin() + static_cast<ptrdiff_t>(offsets[blob]);
+        return std::vector<uint8_t>(first, first + blobSizes_[blob]);
+    };
+    
+    // Modified tiles: rebuild from the live tile before changing anything.
+    // Delta tiles never lie inside a region (see addTileChange), so regions
+    // applied below cannot change what they are checked against.
+    const size_t first_delta = beforeSnapshots_.size() + afterSnapshots_.size();
+    std::vector<std::pair<Position, std::unique_ptr<Tile>>> rebuilt;
+    rebuilt.reserve(deltas_.size());
+    for (size_t i = 0; i < deltas_.size(); ++i) {
+        TileDelta delta = deltas_[i];
+        delta.setData(load(first_delta + i, deltas_[i].data()));
+        if (delta.isEmpty()) continue;
         
-        // Decompress if needed
-        if (compressed_ && i < originalSizes.size() && originalSizes[i] > 64) {
-            auto decompressed = TileSnapshotCodec::decompress(
-                snapshot.data(), originalSizes[i]);
-            snapshot.setData(std::move(decompressed));
+        const Position& pos = delta.getPosition();
+        auto tile = delta.apply(map->getTile(pos), undo);
+        if (!tile) {
+            spdlog::error("[History] Tile at ({}, {}, {}) does not match '{}', {} not applied",
+                          pos.x, pos.y, pos.z, description_, undo ? "undo" : "redo");
+            return false;
         }
+        rebuilt.emplace_back(pos, std::move(tile));
+    }
+    
+    applyRegions(map, undo ? beforeRegions_ : afterRegions_, clientData);
+    
+    // Created / removed tiles: full snapshots
+    const auto& snapshots = undo ? beforeSnapshots_ : afterSnapshots_;
+    const size_t first_blob = undo ? 0 : beforeSnapshots_.size();
+    for (size_t i = 0; i < snapshots.size(); ++i) {
+        TileSnapshot snapshot = TileSnapshot::capture(nullptr, snapshots[i].getPosition());
+        snapshot.setData(load(first_blob + i, snapshots[i].data()));
         
         // Restore tile
         auto tile = snapshot.restore();
         const Position& pos = snapshot.getPosition();
         
         if (tile) {
-            // CRITICAL: Resolve ItemTypes for all items in this tile
-            // Without this, items won't render and ground detection fails
-            if (clientData) {
-                // Resolve ground item type
-                if (tile->hasGround()) {
-                    Item* ground = tile->getGround();
-                    if (ground && !ground->getType()) {
-                        const ItemType* type = clientData->getItemTypeByServerId(ground->getServerId());
-                        ground->setType(type);
-                    }
-                }
-                
-                // Resolve stacked items types using getItem(index) for non-const access
-                for (size_t j = 0; j < tile->getItemCount(); ++j) {
-                    Item* item = tile->getItem(j);
-                    if (item && !item->getType()) {
-                        const ItemType* type = clientData->getItemTypeByServerId(item->getServerId());
-                        item->setType(type);
-                    }
-                }
-            }
+            resolveItemTypes(tile.get(), clientData);
             
             // Replace tile in map
             map->setTile(pos, std::move(tile));
@@ -97,28 +408,51 @@ void HistoryEntry::applySnapshots(ChunkedMap* map,
             map->removeTile(pos);
         }
     }
+    
+    for (auto& [pos, tile] : rebuilt) {
+        resolveItemTypes(tile.get(), clientData);
+        map->setTile(pos, std::move(tile));
+    }
+    return true;
+}
+
+void HistoryEntry::applyRegions(ChunkedMap* map, const std::vector<RegionSnapshot>& regions,
+                                Services::ClientDataService* clientData) {
+    for (const auto& region : regions) {
+        region.clearRegion(map);
+        region.forEachTile([&](const Position& pos, std::unique_ptr<Tile> tile) {
+            resolveItemTypes(tile.get(), clientData);
+            map->setTile(pos, std::move(tile));
+        });
+    }
 }
 
-void HistoryEntry::undo(ChunkedMap* map, Services::ClientDataService* clientData,
+bool HistoryEntry::undo(ChunkedMap* map, Services::ClientDataService* clientData,
                         Services::Selection::SelectionService* selection) {
-    // Restore tile states
-    applySnapshots(map, beforeSnapshots_, beforeOriginalSizes_, clientData);
+    // Restore tile states (regions first, per-tile changes override)
+    if (!applyTiles(map, true, clientData)) {
+        return false;
+    }
     
     // Restore selection state if captured
     if (selection && selection_before_.has_value()) {
         selection->restoreSnapshot(*selection_before_);
     }
+    return true;
 }
 
-void HistoryEntry::redo(ChunkedMap* map, Services::ClientDataService* clientData,
+bool HistoryEntry::redo(ChunkedMap* map, Services::ClientDataService* clientData,
                         Services::Selection::SelectionService* selection) {
-    // Restore tile states
-    applySnapshots(map, afterSnapshots_, afterOriginalSizes_, clientData);
+    // Restore tile states (regions first, per-tile changes override)
+    if (!applyTiles(map, false, clientData)) {
+        return false;
+    }
     
     // Restore selection state if captured
     if (selection && selection_after_.has_value()) {
         selection->restoreSnapshot(*selection_after_);
     }
+    return true;
 }
 
 size_t HistoryEntry::memsize() const {
@@ -131,9 +465,18 @@ size_t HistoryEntry::memsize() const {
     for (const auto& s : afterSnapshots_) {
         size += s.memsize();
     }
+    for (const auto& d : deltas_) {
+        size += d.memsize();
+    }
+    for (const auto& r : beforeRegions_) {
+        size += r.memsize();
+    }
+    for (const auto& r : afterRegions_) {
+        size += r.memsize();
+    }
     
-    size += beforeOriginalSizes_.capacity() * sizeof(size_t);
-    size += afterOriginalSizes_.capacity() * sizeof(size_t);
+    size += blobSizes_.capacity() * sizeof(uint32_t);
+    size += packed_.capacity();
     
     return size;
 }
@@ -1,4 +1,6 @@
 #pragma once
+#include "RegionSnapshot.h"
+#include "TileDelta.h"
 #include "TileSnapshot.h"
 #include "TileSnapshotCodec.h"
 #include "HistoryConfig.h"
@@ -8,6 +10,7 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <memory>
 #include <optional>
 
 namespace MapEditor::Services {
@@ -35,44 +38,91 @@ enum class ActionType {
 };
 
 /**
- * One undoable operation containing tile snapshots.
- * Stores BEFORE and AFTER states for all affected tiles.
+ * One undoable operation containing tile changes.
+ * Modified tiles are stored as TileDeltas; created or removed tiles (and
+ * deltas that would not save space) keep full BEFORE/AFTER snapshots.
+ * Bulk operations store region snapshots instead.
+ *
+ * After compress() all per-tile blobs live in one LZ4 block.
  */
 class HistoryEntry {
 public:
     explicit HistoryEntry(const std::string& description, ActionType type = ActionType::Other);
     
     /**
-     * Add a tile snapshot (stores BEFORE state).
+     * Add the BEFORE and AFTER state of one tile.
+     * Stored as a delta when possible, as the snapshot pair otherwise.
+     * @param allow_delta false for tiles also covered by a region, which are
+     *        applied on top of the region's state instead of their own
      */
-    void addBeforeSnapshot(TileSnapshot snapshot);
+    void addTileChange(TileSnapshot before, TileSnapshot after, bool allow_delta = true);
     
     /**
-     * Add AFTER snapshot for a position.
+     * Add BEFORE / AFTER state of a whole region (bulk operations).
+     * Regions are applied before per-tile snapshots on undo/redo.
      */
-    void addAfterSnapshot(TileSnapshot snapshot);
+    void addBeforeRegion(RegionSnapshot region);
+    void addAfterRegion(RegionSnapshot region);
     
     /**
-     * Compress all snapshots (call after all snapshots added).
+     * Compress all tile blobs as one block (call after all changes added).
+     * @param dictionary Optional LZ4 dictionary, kept alive by the entry
      */
-    void compress(bool enable = true);
+    void compress(bool enable = true,
+                  std::shared_ptr<const std::vector<uint8_t>> dictionary = nullptr);
+    
+    /**
+     * Append uncompressed tile blobs to a dictionary training sample.
+     * @param max_bytes Stop once the sample reaches this size
+     */
+    void appendTrainingSample(std::vector<uint8_t>& sample, size_t max_bytes) const;
+    
+    // === Spilling (cold history on disk) ===
+    
+    /**
+     * Serialize the tile and selection payload. Requires compress().
+     * @return Payload bytes, or empty if the entry cannot be spilled
+     */
+    std::vector<uint8_t> serializePayload() const;
+    
+    /**
+     * Drop the payload from memory after it was written elsewhere.
+     * Only description and type stay resident.
+     */
+    void dropPayload();
+    
+    /**
+     * Reload a payload produced by serializePayload().
+     * @return false if the payload is malformed (entry stays spilled)
+     */
+    bool restorePayload(const std::vector<uint8_t>& payload);
+    
+    /**
+     * Check if the payload lives on disk. undo()/redo(), tileCount() and the
+     * selection queries need a resident entry.
+     */
+    bool isSpilled() const { return spilled_; }
     
     /**
      * Apply undo - restore BEFORE states.
+     * The entry applies completely or not at all.
      * @param map The map to apply changes to
      * @param clientData Optional ClientDataService for resolving ItemTypes
      * @param selection Optional SelectionService to restore selection state
+     * @return false if the map no longer matches the entry (nothing changed)
      */
-    void undo(ChunkedMap* map, Services::ClientDataService* clientData = nullptr,
+    bool undo(ChunkedMap* map, Services::ClientDataService* clientData = nullptr,
               Services::Selection::SelectionService* selection = nullptr);
     
     /**
      * Apply redo - restore AFTER states.
+     * The entry applies completely or not at all.
      * @param map The map to apply changes to
      * @param clientData Optional ClientDataService for resolving ItemTypes
      * @param selection Optional SelectionService to restore selection state
+     * @return false if the map no longer matches the entry (nothing changed)
      */
-    void redo(ChunkedMap* map, Services::ClientDataService* clientData = nullptr,
+    bool redo(ChunkedMap* map, Services::ClientDataService* clientData = nullptr,
               Services::Selection::SelectionService* selection = nullptr);
     
     /**
@@ -93,12 +143,14 @@ public:
     /**
      * Check if entry has any changes.
      */
-    bool hasChanges() const { return !beforeSnapshots_.empty(); }
+    bool hasChanges() const {
+        return !beforeSnapshots_.empty() || !deltas_.empty() || !beforeRegions_.empty();
+    }
     
     /**
      * Get number of affected tiles.
      */
-    size_t tileCount() const { return beforeSnapshots_.size(); }
+    size_t tileCount() const;
     
     // === Selection State ===
     
@@ -129,15 +181,34 @@ private:
     std::vector<TileSnapshot> beforeSnapshots_;
     std::vector<TileSnapshot> afterSnapshots_;
     
-    // Compression metadata
-    std::vector<size_t> beforeOriginalSizes_;
-    std::vector<size_t> afterOriginalSizes_;
-    bool compressed_ = false;
-    
-    // Helper to restore snapshots to map and resolve ItemTypes
-    void applySnapshots(ChunkedMap* map, const std::vector<TileSnapshot>& snapshots,
-                        const std::vector<size_t>& originalSizes,
-                        Services::ClientDataService* clientData);
+    // Modified tiles
+    std::vector<TileDelta> deltas_;
+    
+    // Compression: blob sizes in order (before snapshots, after snapshots,
+    // deltas) and the packed block holding their bytes
+    std::vector<uint32_t> blobSizes_;
+    std::vector<uint8_t> packed_;
+    size_t packedRawSize_ = 0;
+    bool packedLz4_ = false;
+    std::shared_ptr<const std::vector<uint8_t>> dictionary_;
+    bool compressed_ = false;  // Blobs moved into packed_ (LZ4 only if packedLz4_)
+    bool spilled_ = false;
+    
+    // Region-level snapshots for bulk operations
+    std::vector<RegionSnapshot> beforeRegions_;
+    std::vector<RegionSnapshot> afterRegions_;
+    
+    // Helper to restore region snapshots (clear region, then re-insert tiles)
+    void applyRegions(ChunkedMap* map, const std::vector<RegionSnapshot>& regions,
+                      Services::ClientDataService* clientData);
+    
+    // Helper to restore regions, then per-tile snapshots and deltas, resolving
+    // ItemTypes. Every delta is rebuilt before the map is touched, so a tile
+    // that does not match fails the whole entry instead of a partial restore.
+    bool applyTiles(ChunkedMap* map, bool undo, Services::ClientDataService* clientData);
+    
+    // Uncompressed bytes of the packed block
+    std::vector<uint8_t> unpack() const;
     
     // Selection state (optional - only set if selection changed during operation)
     std::optional<Domain::Selection::SelectionSnapshot> selection_before_;
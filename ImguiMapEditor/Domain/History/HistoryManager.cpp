@@ -1,6 +1,8 @@
 #include "HistoryManager.h"
 #include "Services/Selection/SelectionService.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <bit>
 
 namespace MapEditor::Domain::History {
 
@@ -19,6 +21,7 @@ void HistoryManager::beginOperation(const std::string& description, ActionType t
     current_description_ = description;
     current_type_ = type;
     before_states_.clear();
+    clearRegions();
     
     // Capture selection state before operation (if provided)
     if (selection) {
@@ -41,9 +44,34 @@ void HistoryManager::recordTileBefore(const Position& pos, const Tile* tile) {
         return;  // Already captured
     }
     
+    // Covered by a region snapshot
+    if (coveredByRegion(pos)) {
+        return;
+    }
+    
     before_states_[pos] = TileSnapshot::capture(tile, pos);
 }
 
+void HistoryManager::recordRegionBefore(const ChunkedMap& map, int32_t min_x, int32_t min_y,
+                                        int32_t max_x, int32_t max_y, int16_t z) {
+    if (!operation_active_) {
+        spdlog::warn("[History] recordRegionBefore called without active operation");
+        return;
+    }
+    
+    const uint32_t region = static_cast<uint32_t>(before_regions_.size());
+    before_regions_.push_back(RegionSnapshot::capture(map, min_x, min_y, max_x, max_y, z));
+    
+    constexpr int SHIFT = std::countr_zero(static_cast<unsigned>(Chunk::SIZE));
+    for (int32_t cy = min_y >> SHIFT; cy <= (max_y >> SHIFT); ++cy) {
+        for (int32_t cx = min_x >> SHIFT; cx <= (max_x >> SHIFT); ++cx) {
+            region_index_[regionKey(cx, cy, z)].push_back(region);
+        }
+    }
+    spdlog::debug("[History] Region ({},{})-({},{}) z={}: {} tiles", min_x, min_y, max_x, max_y, z,
+                  before_regions_.back().tileCount());
+}
+
 void HistoryManager::endOperation(ChunkedMap* map, Services::Selection::SelectionService* selection) {
     if (!operation_active_) {
         spdlog::warn("[History] endOperation called without active operation");
@@ -51,13 +79,14 @@ void HistoryManager::endOperation(ChunkedMap* map, Services::Selection::Selectio
     }
     
     // Check if we have any changes (tiles or selection)
-    bool has_tile_changes = !before_states_.empty();
+    bool has_tile_changes = !before_states_.empty() || !before_regions_.empty();
     bool has_selection_changes = selection_before_.has_value();
     
     if (!has_tile_changes && !has_selection_changes) {
         // No changes recorded
         operation_active_ = false;
         before_states_.clear();
+        clearRegions();
         selection_before_.reset();
         return;
     }
@@ -65,13 +94,25 @@ void HistoryManager::endOperation(ChunkedMap* map, Services::Selection::Selectio
     // Create history entry
     auto entry = std::make_unique<HistoryEntry>(current_description_, current_type_);
     
-    // Add BEFORE and AFTER tile snapshots
+    // Add BEFORE and AFTER tile states (stored as deltas where possible).
+    // A tile recorded before a region covering it is applied after the
+    // region, on top of the region's state rather than its own, so it keeps
+    // full snapshots.
     for (auto& [pos, before_snapshot] : before_states_) {
-        entry->addBeforeSnapshot(std::move(before_snapshot));
-        
         // Capture AFTER state from current map
         const Tile* current_tile = map->getTile(pos);
-        entry->addAfterSnapshot(TileSnapshot::capture(current_tile, pos));
+        TileSnapshot after_snapshot = TileSnapshot::capture(current_tile, pos);
+        entry->addTileChange(std::move(before_snapshot), std::move(after_snapshot),
+                             !coveredByRegion(pos));
+    }
+    
+    // Add BEFORE and AFTER region snapshots
+    for (auto& before_region : before_regions_) {
+        RegionSnapshot after_region = RegionSnapshot::capture(
+            *map, before_region.getMinX(), before_region.getMinY(),
+            before_region.getMaxX(), before_region.getMaxY(), before_region.getFloor());
+        entry->addBeforeRegion(std::move(before_region));
+        entry->addAfterRegion(std::move(after_region));
     }
     
     // Add selection snapshots if captured
@@ -88,14 +129,31 @@ void HistoryManager::endOperation(ChunkedMap* map, Services::Selection::Selectio
     // Reset state
     operation_active_ = false;
     before_states_.clear();
+    clearRegions();
     selection_before_.reset();
     
     spdlog::debug("[History] End operation: {}", current_description_);
 }
 
+bool HistoryManager::coveredByRegion(const Position& pos) const {
+    constexpr int SHIFT = std::countr_zero(static_cast<unsigned>(Chunk::SIZE));
+    auto it = region_index_.find(regionKey(pos.x >> SHIFT, pos.y >> SHIFT, pos.z));
+    if (it == region_index_.end()) {
+        return false;
+    }
+    return std::any_of(it->second.begin(), it->second.end(),
+                       [&](uint32_t region) { return before_regions_[region].contains(pos); });
+}
+
+void HistoryManager::clearRegions() {
+    before_regions_.clear();
+    region_index_.clear();
+}
+
 void HistoryManager::cancelOperation() {
     operation_active_ = false;
     before_states_.clear();
+    clearRegions();
     selection_before_.reset();
     spdlog::debug("[History] Operation canceled");
 }
@@ -131,7 +189,11 @@ std::string HistoryManager::undo(ChunkedMap* map, Services::ClientDataService* c
     }
     
     std::string desc = entry->getDescription();
-    entry->undo(map, clientData, selection);
+    if (!entry->undo(map, clientData, selection)) {
+        // Nothing was applied; keep the entry as the next undo
+        buffer_.moveForward();
+        return "";
+    }
     
     spdlog::debug("[History] Undo: {}", desc);
     return desc;
@@ -145,7 +207,11 @@ std::string HistoryManager::redo(ChunkedMap* map, Services::ClientDataService* c
     }
     
     std::string desc = entry->getDescription();
-    entry->redo(map, clientData, selection);
+    if (!entry->redo(map, clientData, selection)) {
+        // Nothing was applied; keep the entry as the next redo
+        buffer_.moveBack();
+        return "";
+    }
     
     spdlog::debug("[History] Redo: {}", desc);
     return desc;
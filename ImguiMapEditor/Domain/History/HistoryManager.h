@@ -1,6 +1,7 @@
 #pragma once
 #include "HistoryBuffer.h"
 #include "HistoryEntry.h"
+#include "RegionSnapshot.h"
 #include "TileSnapshot.h"
 #include "HistoryConfig.h"
 #include "../ChunkedMap.h"
@@ -45,6 +46,15 @@ public:
      */
     void recordTileBefore(const Position& pos, const Tile* tile);
     
+    /**
+     * Record the BEFORE state of a whole rectangle on one floor.
+     * For bulk operations: stored as one compressed region blob instead of
+     * a TileSnapshot per tile. Later recordTileBefore() calls inside the
+     * region are ignored; call this before modifying the region.
+     */
+    void recordRegionBefore(const ChunkedMap& map, int32_t min_x, int32_t min_y,
+                            int32_t max_x, int32_t max_y, int16_t z);
+    
     /**
      * End operation and push to history.
      * Captures AFTER states for all recorded tiles.
@@ -87,7 +97,8 @@ public:
      * @param map The map to apply changes to
      * @param clientData Optional ClientDataService for resolving ItemTypes
      * @param selection Optional SelectionService to restore selection state
-     * @return Description of undone operation, or empty if nothing to undo
+     * @return Description of undone operation, or empty if nothing to undo or
+     *         the map no longer matches the entry (the map is left unchanged)
      */
     std::string undo(ChunkedMap* map, Services::ClientDataService* clientData = nullptr,
                      Services::Selection::SelectionService* selection = nullptr);
@@ -97,7 +108,8 @@ public:
      * @param map The map to apply changes to
      * @param clientData Optional ClientDataService for resolving ItemTypes
      * @param selection Optional SelectionService to restore selection state
-     * @return Description of redone operation, or empty if nothing to redo
+     * @return Description of redone operation, or empty if nothing to redo or
+     *         the map no longer matches the entry (the map is left unchanged)
      */
     std::string redo(ChunkedMap* map, Services::ClientDataService* clientData = nullptr,
                      Services::Selection::SelectionService* selection = nullptr);
@@ -118,6 +130,14 @@ public:
     void clear() { buffer_.clear(); }
     
 private:
+    static uint64_t regionKey(int32_t chunk_x, int32_t chunk_y, int16_t z) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(chunk_x)) << 32) ^
+               (static_cast<uint64_t>(static_cast<uint32_t>(chunk_y)) << 8) ^
+               static_cast<uint8_t>(z);
+    }
+    bool coveredByRegion(const Position& pos) const;
+    void clearRegions();
+
     // Hash for Position in unordered_map
     struct PositionHash {
         size_t operator()(const Position& p) const {
@@ -136,6 +156,10 @@ private:
     std::string current_description_;
     ActionType current_type_ = ActionType::Other;
     std::unordered_map<Position, TileSnapshot, PositionHash> before_states_;
+    std::vector<RegionSnapshot> before_regions_;
+    // Chunk key -> indices of before_regions_ overlapping that chunk, so a
+    // tile only tests the regions that can contain it
+    std::unordered_map<uint64_t, std::vector<uint32_t>> region_index_;
     
     // Selection state for current operation (optional)
     std::optional<Domain::Selection::SelectionSnapshot> selection_before_;
@@ -0,0 +1,149 @@
+#include "HistorySpillFile.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <spdlog/spdlog.h>
+
+namespace MapEditor::Domain::History {
+
+HistorySpillFile::HistorySpillFile(std::filesystem::path directory)
+    : directory_(std::move(directory)) {
+}
+
+HistorySpillFile::~HistorySpillFile() {
+    reset();
+}
+
+bool HistorySpillFile::open() {
+    std::error_code ec;
+    std::filesystem::path dir = directory_.empty()
+        ? std::filesystem::temp_directory_path(ec)
+        : directory_;
+    if (ec) {
+        spdlog::error("[History] No temp directory for spill file: {}", ec.message());
+        return false;
+    }
+
+    // Unique per buffer and process start, several maps may be open at once
+    static std::atomic<uint32_t> counter{0};
+    const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+    path_ = dir / ("history_" + std::to_string(stamp) + "_" +
+                   std::to_string(counter.fetch_add(1)) + ".spill");
+
+    #ifdef _WIN32
+    file_ = _wfopen(path_.c_str(), L"wb");
+    #else
+    file_ = std::fopen(path_.c_str(), "wb");
+    #endif
+
+    if (!file_) {
+        spdlog::error("[History] Could not create spill file {}", path_.string());
+        path_.clear();
+        return false;
+    }
+
+    spdlog::debug("[History] Spill file {}", path_.string());
+    return true;
+}
+
+std::optional<HistorySpillFile::Record> HistorySpillFile::append(const std::vector<uint8_t>& data) {
+    if (data.empty()) {
+        return std::nullopt;
+    }
+    if (!file_ && !open()) {
+        return std::nullopt;
+    }
+
+    if (std::fwrite(data.data(), 1, data.size(), file_) != data.size()) {
+        spdlog::error("[History] Spill write failed ({} bytes)", data.size());
+        // Partial write: keep size_ consistent with what readers may map
+        std::fseek(file_, static_cast<long>(size_), SEEK_SET);
+        return std::nullopt;
+    }
+
+    Record record{size_, data.size()};
+    size_ += data.size();
+    return record;
+}
+
+bool HistorySpillFile::read(const Record& record, std::vector<uint8_t>& out) {
+    if (!file_ || record.offset + record.size > size_) {
+        return false;
+    }
+
+    // Remap when the record lies beyond the current mapping
+    if (!mapping_.is_open() || record.offset + record.size > mapped_size_) {
+        std::fflush(file_);
+        try {
+            if (mapping_.is_open()) {
+                mapping_.close();
+            }
+            mapping_.open(path_.string(), static_cast<size_t>(size_));
+            mapped_size_ = size_;
+        } catch (const std::exception& e) {
+            spdlog::error("[History] Could not map spill file: {}", e.what());
+            mapped_size_ = 0;
+            return false;
+        }
+    }
+
+    const char* begin = mapping_.data() + record.offset;
+    out.assign(begin, begin + record.size);
+    return true;
+}
+
+bool HistorySpillFile::compact(const std::vector<Record*>& records) {
+    if (records.empty()) {
+        reset();
+        return true;
+    }
+    
+    HistorySpillFile compacted(directory_);
+    std::vector<Record> moved;
+    moved.reserve(records.size());
+    std::vector<uint8_t> data;
+    for (const Record* record : records) {
+        if (!read(*record, data)) {
+            return false;
+        }
+        auto location = compacted.append(data);
+        if (!location) {
+            return false;
+        }
+        moved.push_back(*location);
+    }
+    
+    // Replace this file with the compacted one
+    reset();
+    file_ = std::exchange(compacted.file_, nullptr);
+    path_ = std::exchange(compacted.path_, {});
+    size_ = std::exchange(compacted.size_, 0);
+    for (size_t i = 0; i < records.size(); ++i) {
+        *records[i] = moved[i];
+    }
+    
+    spdlog::debug("[History] Compacted spill file to {} bytes", size_);
+    return true;
+}
+
+void HistorySpillFile::reset() {
+    if (mapping_.is_open()) {
+        mapping_.close();
+    }
+    mapped_size_ = 0;
+
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+    if (!path_.empty()) {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+        path_.clear();
+    }
+    size_ = 0;
+    dead_bytes_ = 0;
+}
+
+} // namespace MapEditor::Domain::History
@@ -0,0 +1,90 @@
+#pragma once
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace MapEditor::Domain::History {
+
+/**
+ * Append-only scratch file holding spilled (cold) history payloads.
+ *
+ * Records are written once and never modified; reads go through a
+ * read-only memory mapping of the file, remapped when it has grown past the
+ * mapped size. Records no longer referenced are released and their bytes
+ * reclaimed by compact(). The file is created lazily on the first append and
+ * deleted on reset() / destruction.
+ */
+class HistorySpillFile {
+public:
+    struct Record {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+    };
+
+    /**
+     * @param directory Directory for the scratch file (empty = system temp)
+     */
+    explicit HistorySpillFile(std::filesystem::path directory = {});
+    ~HistorySpillFile();
+
+    // Non-copyable
+    HistorySpillFile(const HistorySpillFile&) = delete;
+    HistorySpillFile& operator=(const HistorySpillFile&) = delete;
+
+    /**
+     * Append a record to the end of the file.
+     * @return Record location, or nullopt on I/O failure
+     */
+    std::optional<Record> append(const std::vector<uint8_t>& data);
+
+    /**
+     * Copy a record out of the mapped file.
+     * @return false on I/O failure
+     */
+    bool read(const Record& record, std::vector<uint8_t>& out);
+
+    /**
+     * Mark a record as no longer referenced; its bytes count as dead.
+     */
+    void release(const Record& record) { dead_bytes_ += record.size; }
+    
+    /**
+     * Rewrite the file with only the given records, back to back in the
+     * given order, and update them to their new locations.
+     * @param records Every record still referenced
+     * @return false on I/O failure (the old file and records stay valid)
+     */
+    bool compact(const std::vector<Record*>& records);
+    
+    /**
+     * Close and delete the file; all records become invalid.
+     */
+    void reset();
+
+    /**
+     * Bytes written to the file so far.
+     */
+    uint64_t size() const { return size_; }
+    
+    /**
+     * Bytes of released records, reclaimable by compact().
+     */
+    uint64_t deadBytes() const { return dead_bytes_; }
+
+private:
+    bool open();
+
+    std::filesystem::path directory_;
+    std::filesystem::path path_;
+    std::FILE* file_ = nullptr;
+    uint64_t size_ = 0;
+    uint64_t dead_bytes_ = 0;
+
+    boost::iostreams::mapped_file_source mapping_;
+    uint64_t mapped_size_ = 0;
+};
+
+} // namespace MapEditor::Domain::History
@@ -0,0 +1,167 @@
+#include "RegionSnapshot.h"
+#include "TileSnapshot.h"
+#include "TileSnapshotCodec.h"
+#include "../ChunkedMap.h"
+#include <algorithm>
+#include <cstring>
+
+namespace MapEditor::Domain::History {
+
+RegionSnapshot RegionSnapshot::capture(const ChunkedMap& map,
+                                       int32_t min_x, int32_t min_y,
+                                       int32_t max_x, int32_t max_y, int16_t z) {
+    RegionSnapshot snapshot;
+    snapshot.min_x_ = min_x;
+    snapshot.min_y_ = min_y;
+    snapshot.max_x_ = max_x;
+    snapshot.max_y_ = max_y;
+    snapshot.z_ = z;
+
+    if (min_x > max_x || min_y > max_y) {
+        return snapshot;
+    }
+
+    const uint32_t width = static_cast<uint32_t>(max_x - min_x + 1);
+    std::vector<Chunk*> chunks;
+    map.getVisibleChunks(min_x, min_y, max_x, max_y, z, chunks);
+
+    for (const Chunk* chunk : chunks) {
+        const int start_x = std::max(min_x - chunk->world_x, 0);
+        const int start_y = std::max(min_y - chunk->world_y, 0);
+        const int end_x = std::min(max_x - chunk->world_x, Chunk::SIZE - 1);
+        const int end_y = std::min(max_y - chunk->world_y, Chunk::SIZE - 1);
+
+        for (int ly = start_y; ly <= end_y; ++ly) {
+            for (int lx = start_x; lx <= end_x; ++lx) {
+                const Tile* tile = chunk->getTileUnsafe(lx, ly);
+                if (!tile) continue;
+
+                const int32_t x = chunk->world_x + lx;
+                const int32_t y = chunk->world_y + ly;
+                TileSnapshot tile_snapshot = TileSnapshot::capture(tile, Position(x, y, z));
+
+                const uint32_t index = static_cast<uint32_t>(y - min_y) * width +
+                                       static_cast<uint32_t>(x - min_x);
+                const uint32_t length = static_cast<uint32_t>(tile_snapshot.data().size());
+
+                auto& buf = snapshot.data_;
+                const size_t offset = buf.size();
+                buf.resize(offset + 2 * sizeof(uint32_t) + length);
+                std::memcpy(buf.data() + offset, &index, sizeof(uint32_t));
+                std::memcpy(buf.data() + offset + sizeof(uint32_t), &length, sizeof(uint32_t));
+                std::memcpy(buf.data() + offset + 2 * sizeof(uint32_t),
+                            tile_snapshot.data().data(), length);
+                ++snapshot.tile_count_;
+            }
+        }
+    }
+
+    snapshot.raw_size_ = snapshot.data_.size();
+    snapshot.data_.shrink_to_fit();
+    return snapshot;
+}
+
+void RegionSnapshot::clearRegion(ChunkedMap* map) const {
+    if (!map || min_x_ > max_x_ || min_y_ > max_y_) {
+        return;
+    }
+
+    std::vector<Chunk*> chunks;
+    map->getVisibleChunks(min_x_, min_y_, max_x_, max_y_, z_, chunks);
+
+    for (Chunk* chunk : chunks) {
+        const int start_x = std::max(min_x_ - chunk->world_x, 0);
+        const int start_y = std::max(min_y_ - chunk->world_y, 0);
+        const int end_x = std::min(max_x_ - chunk->world_x, Chunk::SIZE - 1);
+        const int end_y = std::min(max_y_ - chunk->world_y, Chunk::SIZE - 1);
+
+        for (int y = start_y; y <= end_y; ++y) {
+            for (int x = start_x; x <= end_x; ++x) {
+                chunk->removeTile(x, y);
+            }
+        }
+    }
+}
+
+void RegionSnapshot::compress() {
+    if (compressed_ || raw_size_ < 64) {
+        return;
+    }
+
+    auto packed = TileSnapshotCodec::compress(data_);
+    if (!packed.empty() && packed.size() < data_.size()) {
+        data_ = std::move(packed);
+        compressed_ = true;
+    }
+}
+
+std::vector<uint8_t> RegionSnapshot::rawData() const {
+    if (!compressed_) {
+        return data_;
+    }
+    return TileSnapshotCodec::decompress(data_, raw_size_);
+}
+
+namespace {
+template<typename T>
+void write(std::vector<uint8_t>& buf, T value) {
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&value);
+    buf.insert(buf.end(), ptr, ptr + sizeof(T));
+}
+
+template<typename T>
+bool read(const uint8_t*& ptr, const uint8_t* end, T& value) {
+    if (end - ptr < static_cast<ptrdiff_t>(sizeof(T))) return false;
+    std::memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+}
+} // anonymous namespace
+
+void RegionSnapshot::serialize(std::vector<uint8_t>& out) const {
+    write(out, min_x_);
+    write(out, min_y_);
+    write(out, max_x_);
+    write(out, max_y_);
+    write(out, z_);
+    write(out, static_cast<uint64_t>(tile_count_));
+    write(out, static_cast<uint64_t>(raw_size_));
+    write(out, static_cast<uint8_t>(compressed_ ? 1 : 0));
+    write(out, static_cast<uint64_t>(data_.size()));
+    out.insert(out.end(), data_.begin(), data_.end());
+}
+
+bool RegionSnapshot::deserialize(const uint8_t*& ptr, const uint8_t* end, RegionSnapshot& out) {
+    uint64_t tile_count, raw_size, data_size;
+    uint8_t compressed;
+    if (!read(ptr, end, out.min_x_) || !read(ptr, end, out.min_y_) ||
+        !read(ptr, end, out.max_x_) || !read(ptr, end, out.max_y_) ||
+        !read(ptr, end, out.z_) || !read(ptr, end, tile_count) ||
+        !read(ptr, end, raw_size) || !read(ptr, end, compressed) ||
+        !read(ptr, end, data_size) ||
+        static_cast<uint64_t>(end - ptr) < data_size) {
+        return false;
+    }
+
+    out.tile_count_ = static_cast<size_t>(tile_count);
+    out.raw_size_ = static_cast<size_t>(raw_size);
+    out.compressed_ = compressed != 0;
+    out.data_.assign(ptr, ptr + data_size);
+    ptr += data_size;
+    return true;
+}
+
+uint32_t RegionSnapshot::readU32(const uint8_t*& ptr) {
+    uint32_t value;
+    std::memcpy(&value, ptr, sizeof(uint32_t));
+    ptr += sizeof(uint32_t);
+    return value;
+}
+
+std::unique_ptr<Tile> RegionSnapshot::deserialize(const uint8_t* ptr, size_t length) {
+    TileSnapshot tile_snapshot;
+    tile_snapshot.setData(std::vector<uint8_t>(ptr, ptr + length));
+    return tile_snapshot.restore();
+}
+
+} // namespace MapEditor::Domain::History
@@ -0,0 +1,113 @@
+#pragma once
+#include "../Position.h"
+#include "../Tile.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MapEditor::Domain {
+    class ChunkedMap;
+}
+
+namespace MapEditor::Domain::History {
+
+/**
+ * Serialized state of every tile inside a rectangle on one floor.
+ * Used instead of per-tile TileSnapshots for bulk operations (large moves,
+ * pastes): all tiles share one buffer and compress as a single LZ4 block,
+ * so there is no per-tile vector/position overhead and redundancy between
+ * neighbouring tiles is actually exploited.
+ *
+ * Buffer layout: repeated [index: u32][length: u32][TileSnapshot bytes],
+ * where index = (y - min_y) * width + (x - min_x). Empty tiles are omitted.
+ */
+class RegionSnapshot {
+public:
+    RegionSnapshot() = default;
+
+    /**
+     * Capture all tiles in the inclusive rectangle on floor z.
+     * Walks existing chunks only, so empty map areas cost nothing.
+     */
+    static RegionSnapshot capture(const ChunkedMap& map,
+                                  int32_t min_x, int32_t min_y,
+                                  int32_t max_x, int32_t max_y, int16_t z);
+
+    /**
+     * Remove every tile in the region from the map.
+     */
+    void clearRegion(ChunkedMap* map) const;
+
+    /**
+     * Deserialize captured tiles.
+     * Callback: void(const Position& pos, std::unique_ptr<Tile> tile)
+     */
+    template <typename Func> void forEachTile(Func&& callback) const {
+        const std::vector<uint8_t> raw = rawData();
+        const uint8_t* ptr = raw.data();
+        const uint8_t* end = ptr + raw.size();
+        const int32_t width = max_x_ - min_x_ + 1;
+
+        while (ptr + 2 * sizeof(uint32_t) <= end) {
+            const uint32_t index = readU32(ptr);
+            const uint32_t length = readU32(ptr);
+            if (ptr + length > end) break;
+
+            auto tile = deserialize(ptr, length);
+            ptr += length;
+            if (tile) {
+                const Position pos(min_x_ + static_cast<int32_t>(index % width),
+                                   min_y_ + static_cast<int32_t>(index / width), z_);
+                callback(pos, std::move(tile));
+            }
+        }
+    }
+
+    /**
+     * Compress the tile buffer as one LZ4 block.
+     */
+    void compress();
+
+    /**
+     * Append the snapshot (bounds, counters and buffer as-is) to out.
+     */
+    void serialize(std::vector<uint8_t>& out) const;
+
+    /**
+     * Read a snapshot written by serialize().
+     * @return false if the input is truncated
+     */
+    static bool deserialize(const uint8_t*& ptr, const uint8_t* end, RegionSnapshot& out);
+
+    bool contains(const Position& pos) const {
+        return pos.z == z_ && pos.x >= min_x_ && pos.x <= max_x_ &&
+               pos.y >= min_y_ && pos.y <= max_y_;
+    }
+
+    int32_t getMinX() const { return min_x_; }
+    int32_t getMinY() const { return min_y_; }
+    int32_t getMaxX() const { return max_x_; }
+    int32_t getMaxY() const { return max_y_; }
+    int16_t getFloor() const { return z_; }
+
+    size_t tileCount() const { return tile_count_; }
+    size_t memsize() const { return sizeof(*this) + data_.capacity(); }
+
+private:
+    int32_t min_x_ = 0;
+    int32_t min_y_ = 0;
+    int32_t max_x_ = -1;
+    int32_t max_y_ = -1;
+    int16_t z_ = 0;
+
+    size_t tile_count_ = 0;
+    size_t raw_size_ = 0;       // Uncompressed size of data_
+    bool compressed_ = false;
+    std::vector<uint8_t> data_;
+
+    std::vector<uint8_t> rawData() const;
+    static uint32_t readU32(const uint8_t*& ptr);
+    static std::unique_ptr<Tile> deserialize(const uint8_t* ptr, size_t length);
+};
+
+} // namespace MapEditor::Domain::History
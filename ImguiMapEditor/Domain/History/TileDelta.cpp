@@ -0,0 +1,236 @@
+#include "TileDelta.h"
+#include <algorithm>
+#include <cstring>
+
+namespace MapEditor::Domain::History {
+
+namespace {
+using Layout = TileSnapshot::Layout;
+constexpr size_t ATTRIBUTES_SIZE = Layout::HEADER_SIZE - Layout::ATTRIBUTES_OFFSET;
+
+// Byte range inside a snapshot or delta buffer
+struct Span {
+    const uint8_t* ptr = nullptr;
+    size_t size = 0;
+
+    bool operator==(const Span& other) const {
+        return size == other.size && std::memcmp(ptr, other.ptr, size) == 0;
+    }
+};
+
+template<typename T>
+void write(std::vector<uint8_t>& buf, T value) {
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&value);
+    buf.insert(buf.end(), ptr, ptr + sizeof(T));
+}
+
+template<typename T>
+T read(const uint8_t*& ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return value;
+}
+
+void append(std::vector<uint8_t>& buf, Span span) {
+    buf.insert(buf.end(), span.ptr, span.ptr + span.size);
+}
+
+void writeSection(std::vector<uint8_t>& buf, Span span) {
+    write(buf, static_cast<uint32_t>(span.size));
+    append(buf, span);
+}
+
+Span readSection(const uint8_t*& ptr) {
+    Span span;
+    span.size = read<uint32_t>(ptr);
+    span.ptr = ptr;
+    ptr += span.size;
+    return span;
+}
+
+Span range(const std::vector<uint8_t>& data, size_t begin, size_t end) {
+    return Span{data.data() + begin, end - begin};
+}
+
+Span itemRange(const std::vector<uint8_t>& data, const Layout& layout, size_t first, size_t last) {
+    return range(data, layout.item_offsets[first], layout.item_offsets[last]);
+}
+} // anonymous namespace
+
+std::optional<TileDelta> TileDelta::compute(const TileSnapshot& before, const TileSnapshot& after) {
+    // Created or removed tiles keep full snapshots
+    if (before.isEmpty() || after.isEmpty()) {
+        return std::nullopt;
+    }
+
+    Layout lb, la;
+    if (!before.parseLayout(lb) || !after.parseLayout(la)) {
+        return std::nullopt;
+    }
+
+    const auto& b = before.data();
+    const auto& a = after.data();
+
+    TileDelta delta;
+    delta.position_ = before.getPosition();
+    auto& out = delta.data_;
+    out.push_back(0);
+    uint8_t ops = 0;
+
+    // Attributes (flags + house id)
+    const Span attrs_b = range(b, Layout::ATTRIBUTES_OFFSET, Layout::HEADER_SIZE);
+    const Span attrs_a = range(a, Layout::ATTRIBUTES_OFFSET, Layout::HEADER_SIZE);
+    if (!(attrs_b == attrs_a)) {
+        ops |= OpAttributes;
+        append(out, attrs_b);
+        append(out, attrs_a);
+    }
+
+    // Ground
+    const Span ground_b = range(b, lb.ground_begin, lb.items_begin);
+    const Span ground_a = range(a, la.ground_begin, la.items_begin);
+    if (!(ground_b == ground_a)) {
+        ops |= OpGround;
+        writeSection(out, ground_b);
+        writeSection(out, ground_a);
+    }
+
+    // Items: one replaced run between the unchanged bottom and top of the stack
+    const size_t count_b = lb.item_offsets.size() - 1;
+    const size_t count_a = la.item_offsets.size() - 1;
+    size_t prefix = 0;
+    while (prefix < count_b && prefix < count_a &&
+           itemRange(b, lb, prefix, prefix + 1) == itemRange(a, la, prefix, prefix + 1)) {
+        ++prefix;
+    }
+    size_t suffix = 0;
+    while (suffix < count_b - prefix && suffix < count_a - prefix &&
+           itemRange(b, lb, count_b - suffix - 1, count_b - suffix) ==
+               itemRange(a, la, count_a - suffix - 1, count_a - suffix)) {
+        ++suffix;
+    }
+    const size_t removed = count_b - prefix - suffix;
+    const size_t inserted = count_a - prefix - suffix;
+    if (removed > 0 || inserted > 0) {
+        ops |= OpItems;
+        write(out, static_cast<uint16_t>(prefix));
+        write(out, static_cast<uint16_t>(removed));
+        write(out, static_cast<uint16_t>(inserted));
+        writeSection(out, itemRange(b, lb, prefix, prefix + removed));
+        writeSection(out, itemRange(a, la, prefix, prefix + inserted));
+    }
+
+    // Spawn + creature
+    const Span trailer_b = range(b, lb.trailer_begin, b.size());
+    const Span trailer_a = range(a, la.trailer_begin, a.size());
+    if (!(trailer_b == trailer_a)) {
+        ops |= OpTrailer;
+        writeSection(out, trailer_b);
+        writeSection(out, trailer_a);
+    }
+
+    out[0] = ops;
+    if (out.size() >= b.size() + a.size()) {
+        return std::nullopt;
+    }
+    out.shrink_to_fit();
+    return delta;
+}
+
+std::unique_ptr<Tile> TileDelta::apply(const Tile* current, bool undo) const {
+    if (!current || data_.empty()) {
+        return nullptr;
+    }
+
+    TileSnapshot snapshot = TileSnapshot::capture(current, position_);
+    Layout layout;
+    if (!snapshot.parseLayout(layout)) {
+        return nullptr;
+    }
+    const auto& cur = snapshot.data();
+
+    // Decode delta sections: the side being restored, and the side the live
+    // tile must currently be on
+    const uint8_t ops = data_[0];
+    const uint8_t* ptr = data_.data() + 1;
+
+    Span attrs, ground, items, trailer;
+    Span attrs_cur, ground_cur, items_cur, trailer_cur;
+    size_t index = 0, replaced = 0, restored = 0;
+
+    if (ops & OpAttributes) {
+        attrs = Span{ptr + (undo ? 0 : ATTRIBUTES_SIZE), ATTRIBUTES_SIZE};
+        attrs_cur = Span{ptr + (undo ? ATTRIBUTES_SIZE : 0), ATTRIBUTES_SIZE};
+        ptr += 2 * ATTRIBUTES_SIZE;
+    }
+    if (ops & OpGround) {
+        const Span before = readSection(ptr);
+        const Span after = readSection(ptr);
+        ground = undo ? before : after;
+        ground_cur = undo ? after : before;
+    }
+    if (ops & OpItems) {
+        index = read<uint16_t>(ptr);
+        const size_t removed = read<uint16_t>(ptr);
+        const size_t inserted = read<uint16_t>(ptr);
+        const Span before = readSection(ptr);
+        const Span after = readSection(ptr);
+        replaced = undo ? inserted : removed;
+        restored = undo ? removed : inserted;
+        items = undo ? before : after;
+        items_cur = undo ? after : before;
+    }
+    if (ops & OpTrailer) {
+        const Span before = readSection(ptr);
+        const Span after = readSection(ptr);
+        trailer = undo ? before : after;
+        trailer_cur = undo ? after : before;
+    }
+
+    // Every changed section must match the live tile byte for byte; otherwise
+    // the map diverged from this entry and rebuilding would corrupt the tile
+    const size_t count = layout.item_offsets.size() - 1;
+    if (index + replaced > count) {
+        return nullptr;
+    }
+    if ((ops & OpAttributes) &&
+        !(range(cur, Layout::ATTRIBUTES_OFFSET, Layout::HEADER_SIZE) == attrs_cur)) {
+        return nullptr;
+    }
+    if ((ops & OpGround) && !(range(cur, layout.ground_begin, layout.items_begin) == ground_cur)) {
+        return nullptr;
+    }
+    if ((ops & OpItems) && !(itemRange(cur, layout, index, index + replaced) == items_cur)) {
+        return nullptr;
+    }
+    if ((ops & OpTrailer) && !(range(cur, layout.trailer_begin, cur.size()) == trailer_cur)) {
+        return nullptr;
+    }
+
+    std::vector<uint8_t> out;
+    out.reserve(cur.size() + items.size + ground.size + trailer.size);
+
+    // Header: marker + position from the live tile, attributes from the delta
+    append(out, range(cur, 0, Layout::ATTRIBUTES_OFFSET));
+    append(out, (ops & OpAttributes) ? attrs : range(cur, Layout::ATTRIBUTES_OFFSET, Layout::HEADER_SIZE));
+
+    append(out, (ops & OpGround) ? ground : range(cur, layout.ground_begin, layout.items_begin));
+
+    if (ops & OpItems) {
+        write(out, static_cast<uint16_t>(count - replaced + restored));
+        append(out, itemRange(cur, layout, 0, index));
+        append(out, items);
+        append(out, itemRange(cur, layout, index + replaced, count));
+    } else {
+        append(out, range(cur, layout.items_begin, layout.trailer_begin));
+    }
+
+    append(out, (ops & OpTrailer) ? trailer : range(cur, layout.trailer_begin, cur.size()));
+
+    TileSnapshot rebuilt = TileSnapshot::capture(nullptr, position_);
+    rebuilt.setData(std::move(out));
+    return rebuilt.restore();
+}
+
+} // namespace MapEditor::Domain::History
@@ -0,0 +1,83 @@
+#pragma once
+#include "TileSnapshot.h"
+#include "../Position.h"
+#include "../Tile.h"
+#include <vector>
+#include <memory>
+#include <optional>
+#include <cstdint>
+
+namespace MapEditor::Domain::History {
+
+/**
+ * Difference between the BEFORE and AFTER state of one tile.
+ *
+ * Instead of two full TileSnapshots, only the sections that changed are
+ * stored: tile attributes (flags, house id), the ground, one contiguous run
+ * of stack items replaced at an index, and the spawn/creature trailer.
+ * Painting an item on a full stack therefore costs one item, not two stacks.
+ *
+ * A delta is applied on top of the live tile: undo expects the AFTER state
+ * on the map and rebuilds BEFORE, redo the other way around.
+ *
+ * Data layout: [ops: u8] followed by the sections flagged in ops
+ *   Attributes: [before: 6 bytes][after: 6 bytes]
+ *   Ground:     [len: u32][before bytes][len: u32][after bytes]
+ *   Items:      [index: u16][removed: u16][inserted: u16]
+ *               [len: u32][removed item bytes][len: u32][inserted item bytes]
+ *   Trailer:    [len: u32][before bytes][len: u32][after bytes]
+ */
+class TileDelta {
+public:
+    TileDelta() = default;
+
+    /**
+     * Diff two snapshots of the same position.
+     * @return Delta, or nullopt if the tile was created/removed or the delta
+     *         would not be smaller than the two snapshots
+     */
+    static std::optional<TileDelta> compute(const TileSnapshot& before, const TileSnapshot& after);
+
+    /**
+     * Rebuild the tile on the other side of this delta.
+     * @param current Live tile (AFTER state for undo, BEFORE state for redo)
+     * @param undo true to rebuild BEFORE, false to rebuild AFTER
+     * @return Rebuilt tile, or nullptr if current does not match the delta
+     */
+    std::unique_ptr<Tile> apply(const Tile* current, bool undo) const;
+
+    /**
+     * Empty delta for a position; data is filled in with setData().
+     */
+    static TileDelta at(const Position& pos) {
+        TileDelta delta;
+        delta.position_ = pos;
+        return delta;
+    }
+
+    const Position& getPosition() const { return position_; }
+
+    /**
+     * Check if nothing changed on the tile.
+     */
+    bool isEmpty() const { return data_.size() <= 1; }
+
+    size_t memsize() const { return sizeof(*this) + data_.capacity(); }
+
+    // Direct access for compression
+    const std::vector<uint8_t>& data() const { return data_; }
+    void setData(std::vector<uint8_t> data) { data_ = std::move(data); }
+
+private:
+    enum Op : uint8_t {
+        OpAttributes = 0x01,
+        OpGround = 0x02,
+        OpItems = 0x04,
+        OpTrailer = 0x08
+    };
+
+    Position position_;
+    std::vector<uint8_t> data_;
+};
+
+} // namespace MapEditor::Domain::History
@@ -144,6 +144,39 @@ std::unique_ptr<Item> deserializeItem(const uint8_t*& ptr) {
     return item;
 }
 
+// Advance past one serialized item without constructing it
+bool skipItem(const uint8_t*& ptr, const uint8_t* end) {
+    // server_id, client_id, action_id, unique_id, count, charges, tier, duration, flags
+    constexpr size_t FIXED_SIZE = 2 + 2 + 2 + 2 + 2 + 1 + 1 + 2 + 1;
+    if (end - ptr < static_cast<ptrdiff_t>(FIXED_SIZE)) return false;
+    ptr += FIXED_SIZE - 1;
+    uint8_t flags = read<uint8_t>(ptr);
+    
+    auto skip = [&](size_t n) {
+        if (end - ptr < static_cast<ptrdiff_t>(n)) return false;
+        ptr += n;
+        return true;
+    };
+    auto skipString = [&]() {
+        if (end - ptr < 2) return false;
+        return skip(read<uint16_t>(ptr));
+    };
+    
+    if ((flags & 0x01) && !skipString()) return false;
+    if ((flags & 0x02) && !skipString()) return false;
+    if ((flags & 0x04) && !skip(4 + 4 + 2)) return false;
+    if ((flags & 0x08) && !skip(4)) return false;
+    if ((flags & 0x10) && !skip(4)) return false;
+    if (flags & 0x20) {
+        if (end - ptr < 2) return false;
+        uint16_t count = read<uint16_t>(ptr);
+        for (uint16_t i = 0; i < count; ++i) {
+            if (!skipItem(ptr, end)) return false;
+        }
+    }
+    return true;
+}
+
 } // anonymous namespace
 
 TileSnapshot TileSnapshot::capture(const Tile* tile, const Position& pos) {
@@ -271,6 +304,36 @@ std::unique_ptr<Tile> TileSnapshot::deserializeTile() const {
     return tile;
 }
 
+bool TileSnapshot::parseLayout(Layout& layout) const {
+    if (data_.size() < Layout::HEADER_SIZE + 1 || data_[0] == 0) {
+        return false;
+    }
+    
+    const uint8_t* begin = data_.data();
+    const uint8_t* end = begin + data_.size();
+    const uint8_t* ptr = begin + Layout::HEADER_SIZE;
+    
+    layout.ground_begin = Layout::HEADER_SIZE;
+    if (read<uint8_t>(ptr) && !skipItem(ptr, end)) {
+        return false;
+    }
+    
+    layout.items_begin = static_cast<size_t>(ptr - begin);
+    if (end - ptr < 2) return false;
+    uint16_t item_count = read<uint16_t>(ptr);
+    
+    layout.item_offsets.clear();
+    layout.item_offsets.reserve(item_count + 1);
+    for (uint16_t i = 0; i < item_count; ++i) {
+        layout.item_offsets.push_back(static_cast<size_t>(ptr - begin));
+        if (!skipItem(ptr, end)) return false;
+    }
+    layout.item_offsets.push_back(static_cast<size_t>(ptr - begin));
+    
+    layout.trailer_begin = static_cast<size_t>(ptr - begin);
+    return true;
+}
+
 size_t TileSnapshot::memsize() const {
     return sizeof(*this) + data_.capacity();
 }
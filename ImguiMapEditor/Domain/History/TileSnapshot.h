@@ -48,6 +48,25 @@ public:
      */
     size_t memsize() const;
     
+    /**
+     * Byte offsets of the sections of a serialized tile.
+     * Sections: header | ground | item_count + items | spawn + creature.
+     */
+    struct Layout {
+        static constexpr size_t HEADER_SIZE = 17;       // marker, position, flags, house
+        static constexpr size_t ATTRIBUTES_OFFSET = 11; // flags + house id
+        size_t ground_begin = HEADER_SIZE;
+        size_t items_begin = 0;                // Offset of item_count
+        std::vector<size_t> item_offsets;      // One per item, plus end offset
+        size_t trailer_begin = 0;              // Spawn + creature
+    };
+    
+    /**
+     * Locate the sections of a non-empty snapshot.
+     * @return false if the snapshot is empty or malformed
+     */
+    bool parseLayout(Layout& layout) const;
+    
     // Direct access for compression
     std::vector<uint8_t>& data() { return data_; }
     const std::vector<uint8_t>& data() const { return data_; }
@@ -54,6 +54,78 @@ std::vector<uint8_t> TileSnapshotCodec::decompress(
     return decompressed;
 }
 
+std::vector<uint8_t> TileSnapshotCodec::compress(
+    const std::vector<uint8_t>& data,
+    const std::vector<uint8_t>* dictionary
+) {
+    if (!dictionary || dictionary->empty()) {
+        return compress(data);
+    }
+    if (data.empty()) {
+        return {};
+    }
+    
+    LZ4_stream_t* stream = LZ4_createStream();
+    if (!stream) {
+        return compress(data);
+    }
+    LZ4_loadDict(stream, reinterpret_cast<const char*>(dictionary->data()),
+                 static_cast<int>(dictionary->size()));
+    
+    int max_compressed = LZ4_compressBound(static_cast<int>(data.size()));
+    std::vector<uint8_t> compressed(max_compressed);
+    
+    int compressed_size = LZ4_compress_fast_continue(
+        stream,
+        reinterpret_cast<const char*>(data.data()),
+        reinterpret_cast<char*>(compressed.data()),
+        static_cast<int>(data.size()),
+        max_compressed,
+        1
+    );
+    LZ4_freeStream(stream);
+    
+    if (compressed_size <= 0) {
+        // Compression failed - return copy of original
+        return data;
+    }
+    
+    compressed.resize(compressed_size);
+    compressed.shrink_to_fit();
+    return compressed;
+}
+
+std::vector<uint8_t> TileSnapshotCodec::decompress(
+    const std::vector<uint8_t>& compressed,
+    size_t original_size,
+    const std::vector<uint8_t>* dictionary
+) {
+    if (!dictionary || dictionary->empty()) {
+        return decompress(compressed, original_size);
+    }
+    if (compressed.empty() || original_size == 0) {
+        return {};
+    }
+    
+    std::vector<uint8_t> decompressed(original_size);
+    
+    int result = LZ4_decompress_safe_usingDict(
+        reinterpret_cast<const char*>(compressed.data()),
+        reinterpret_cast<char*>(decompressed.data()),
+        static_cast<int>(compressed.size()),
+        static_cast<int>(original_size),
+        reinterpret_cast<const char*>(dictionary->data()),
+        static_cast<int>(dictionary->size())
+    );
+    
+    if (result < 0) {
+        // Decompression failed
+        return {};
+    }
+    
+    return decompressed;
+}
+
 bool TileSnapshotCodec::isAvailable() {
     return true;  // LZ4 is always available when linked
 }
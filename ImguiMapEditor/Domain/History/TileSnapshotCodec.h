@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <cstddef>
 #include <cstdint>
 
 namespace MapEditor::Domain::History {
@@ -29,6 +30,26 @@ public:
         size_t original_size
     );
     
+    /**
+     * Compress data using LZ4 primed with a dictionary.
+     * Small blocks of similar tiles compress far better when the encoder can
+     * reference typical tile bytes from the dictionary.
+     * @param dictionary Dictionary bytes, or nullptr for plain compression
+     */
+    static std::vector<uint8_t> compress(
+        const std::vector<uint8_t>& data,
+        const std::vector<uint8_t>* dictionary
+    );
+    
+    /**
+     * Decompress LZ4 data compressed with the same dictionary.
+     */
+    static std::vector<uint8_t> decompress(
+        const std::vector<uint8_t>& compressed,
+        size_t original_size,
+        const std::vector<uint8_t>* dictionary
+    );
+    
     /**
      * Check if compression is available.
      */
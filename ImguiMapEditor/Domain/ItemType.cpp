@@ -0,0 +1,65 @@
+#include "ItemType.h"
+#include <algorithm>
+
+namespace MapEditor {
+namespace Domain {
+
+void ItemType::buildDrawRecipe() {
+  ItemDrawRecipe recipe;
+  if (sprite_ids.empty()) {
+    draw_recipe = std::move(recipe);
+    return;
+  }
+
+  recipe.width = std::max<uint8_t>(1, width);
+  recipe.height = std::max<uint8_t>(1, height);
+  recipe.layers = std::max<uint8_t>(1, layers);
+  recipe.pattern_x = std::max<uint8_t>(1, pattern_x);
+  recipe.pattern_y = std::max<uint8_t>(1, pattern_y);
+  recipe.pattern_z = std::max<uint8_t>(1, pattern_z);
+  recipe.frames = std::max<uint8_t>(1, frames);
+
+  recipe.tile_stride = static_cast<uint32_t>(recipe.width) * recipe.height;
+  recipe.pattern_stride = recipe.tile_stride * recipe.layers;
+
+  const size_t frame_size = static_cast<size_t>(recipe.pattern_stride) *
+                            recipe.pattern_x * recipe.pattern_y *
+                            recipe.pattern_z;
+  if (frame_size * recipe.frames > ItemDrawRecipe::MAX_GRID_SPRITES) {
+    recipe.frames = static_cast<uint8_t>(std::max<size_t>(
+        1, ItemDrawRecipe::MAX_GRID_SPRITES / frame_size));
+  }
+
+  // Wrap short sprite lists the same way the DAT indexing would
+  const size_t count = sprite_ids.size();
+  recipe.sprites.resize(frame_size * recipe.frames);
+  for (size_t i = 0; i < recipe.sprites.size(); ++i) {
+    recipe.sprites[i] = sprite_ids[i < count ? i : i % count];
+  }
+
+  for (size_t i = 0; i < ItemDrawRecipe::STACK_BUCKETS; ++i) {
+    recipe.stack_sprites[i] = i < count ? sprite_ids[i] : sprite_ids[0];
+  }
+
+  recipe.draw_offset_x = static_cast<float>(draw_offset_x);
+  recipe.draw_offset_y = static_cast<float>(draw_offset_y);
+  recipe.elevation = hasElevation() ? static_cast<float>(elevation) : 0.0f;
+
+  if (is_hangable) {
+    recipe.pattern_source = ItemDrawRecipe::PatternSource::Hook;
+  } else if (isFluidContainer() || isSplash()) {
+    recipe.pattern_source = ItemDrawRecipe::PatternSource::Subtype;
+  }
+
+  recipe.is_simple = recipe.width == 1 && recipe.height == 1 &&
+                     recipe.layers == 1 && recipe.frames == 1 &&
+                     recipe.pattern_x == 1 && recipe.pattern_y == 1 &&
+                     recipe.pattern_z == 1;
+  recipe.stack_by_count = is_stackable && recipe.width == 1 &&
+                          recipe.height == 1;
+
+  draw_recipe = std::move(recipe);
+}
+
+} // namespace Domain
+} // namespace MapEditor
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -158,6 +159,73 @@ enum class ItemTypeEnum : uint8_t {
   Podium
 };
 
+/**
+ * Precomputed sprite layout of an item type, built once when client data is
+ * loaded so the renderer resolves sprites with a few table reads instead of
+ * re-deriving dimensions, pattern rules and wrap-around per drawn item.
+ *
+ * sprites holds the full DAT grid in [frame][pattern_z][pattern_y]
+ * [pattern_x][layer][height][width] order; short sprite lists are already
+ * wrapped, so every index inside the grid is valid.
+ */
+struct ItemDrawRecipe {
+  // Where pattern_x/y/z come from when drawing
+  enum class PatternSource : uint8_t {
+    Position, // Tile coordinates modulo pattern counts
+    Hook,     // pattern_x from the wall hooks on the tile
+    Subtype,  // Fluid colour from the item subtype
+  };
+
+  static constexpr size_t STACK_BUCKETS = 8;
+  // Grid size cap for malformed DAT entries (frames are dropped past it)
+  static constexpr size_t MAX_GRID_SPRITES = 1u << 20;
+
+  std::vector<uint32_t> sprites;
+  // Sprite per stack-count bucket, used for 1x1 stackables
+  std::array<uint32_t, STACK_BUCKETS> stack_sprites{};
+
+  // Grid dimensions, all >= 1
+  uint8_t width = 1;
+  uint8_t height = 1;
+  uint8_t layers = 1;
+  uint8_t pattern_x = 1;
+  uint8_t pattern_y = 1;
+  uint8_t pattern_z = 1;
+  uint8_t frames = 1;
+
+  uint32_t tile_stride = 1;    // width * height
+  uint32_t pattern_stride = 1; // Sprites per pattern: layers * tile_stride
+
+  // Unscaled pixel offsets; elevation is 0 unless the type raises items
+  float draw_offset_x = 0.0f;
+  float draw_offset_y = 0.0f;
+  float elevation = 0.0f;
+
+  PatternSource pattern_source = PatternSource::Position;
+  bool is_simple = false;      // 1x1, one layer, one frame, no patterns
+  bool stack_by_count = false; // 1x1 stackable, sprite from stack_sprites
+
+  bool empty() const { return sprites.empty(); }
+
+  // Offset of the first sprite of a (frame, pattern) cell in sprites
+  size_t patternOffset(int frame, int px, int py, int pz) const {
+    return static_cast<size_t>(
+               ((frame * pattern_z + pz) * pattern_y + py) * pattern_x + px) *
+           pattern_stride;
+  }
+
+  // Map a stack count to its stack_sprites bucket
+  static size_t stackBucket(int count) {
+    if (count <= 4)
+      return count <= 1 ? 0 : static_cast<size_t>(count - 1);
+    if (count < 10)
+      return 4;
+    if (count < 25)
+      return 5;
+    return count < 50 ? 6 : 7;
+  }
+};
+
 /**
  * Item type definition - loaded from OTB and DAT files
  * Represents the properties of an item type, not an instance
@@ -212,6 +280,10 @@ public:
   // Translucency (from DAT)
   bool is_translucent = false;
 
+  // Ground sprite fully covers its tile (from DAT, newer clients only);
+  // used to skip drawing lower floors hidden beneath it
+  bool is_full_ground = false;
+
   // Elevation (from DAT) - items on this raise subsequent items visually
   uint16_t elevation = 0;
 
@@ -292,6 +364,9 @@ public:
   // Track if XML was merged
   bool xml_loaded = false;
 
+  // Sprite layout for the renderer, see buildDrawRecipe()
+  ItemDrawRecipe draw_recipe;
+
   // PERFORMANCE: Cached first sprite region (pre-fetched during loading)
   // Eliminates hash lookup in getSpriteRegion() - 30k+ lookups/frame → 0
   const MapEditor::Rendering::AtlasRegion *cached_sprite_region =
@@ -374,6 +449,12 @@ public:
            pattern_y * pattern_z * frames;
   }
 
+  /**
+   * Rebuild draw_recipe from the DAT dimensions, flags and sprite_ids.
+   * Call after the appearance data of the type changes.
+   */
+  void buildDrawRecipe();
+
   /**
    * Check if this item type has valid data for rendering.
    * Returns false for "gap" entries in items.otb that have a server_id
@@ -56,6 +56,21 @@ void MapInstance::selectRegion(int32_t min_x, int32_t min_y, int32_t max_x,
                                   SelectionFilter::all());
 }
 
+void MapInstance::deselectRegion(int32_t min_x, int32_t min_y, int32_t max_x,
+                                 int32_t max_y, int16_t z) {
+  selection_service_.deselectRegion(min_x, min_y, max_x, max_y, z,
+                                    SelectionFilter::all());
+}
+
+void MapInstance::toggleRegion(int32_t min_x, int32_t min_y, int32_t max_x,
+                               int32_t max_y, int16_t z) {
+  if (!map_)
+    return;
+
+  selection_service_.toggleRegion(map_.get(), min_x, min_y, max_x, max_y, z,
+                                  SelectionFilter::all());
+}
+
 void MapInstance::clearSelection() { selection_service_.clear(); }
 
 void MapInstance::deleteSelection() {
@@ -50,6 +50,10 @@ public:
   // Selection Operations
   void selectRegion(int32_t min_x, int32_t min_y, int32_t max_x, int32_t max_y,
                     int16_t z);
+  void deselectRegion(int32_t min_x, int32_t min_y, int32_t max_x,
+                      int32_t max_y, int16_t z);
+  void toggleRegion(int32_t min_x, int32_t min_y, int32_t max_x, int32_t max_y,
+                    int16_t z);
   void clearSelection();
   void deleteSelection();
 
@@ -4,106 +4,351 @@
 
 namespace MapEditor::Domain::Selection {
 
-void SelectionBucket::add(const SelectionEntry &entry) {
-  uint64_t entity_key = entityKey(entry.id);
+bool SelectionBucket::add(const SelectionEntry &entry) {
+  const Position &pos = entry.id.position;
+  SelectionChunk &chunk = chunks_[chunkKeyOf(pos)];
+  if (chunk.entries.empty()) {
+    chunk.chunk_x = pos.x >> SelectionChunk::SHIFT;
+    chunk.chunk_y = pos.y >> SelectionChunk::SHIFT;
+    chunk.z = pos.z;
+  }
+
+  const int index = SelectionChunk::tileIndex(pos);
+  auto insert_at = chunk.entries.end();
 
-  // Check if already exists
-  if (entries_.find(entity_key) != entries_.end()) {
-    return; // Already selected, no-op
+  if (chunk.tiles.test(index)) {
+    auto [first, last] = chunk.entriesAt(index);
+    for (auto it = first; it != last; ++it) {
+      if (it->id == entry.id) {
+        return false; // Already selected, no-op
+      }
+    }
+    insert_at = last;
+  } else if (!chunk.entries.empty() &&
+             SelectionChunk::entryTileIndex(chunk.entries.back()) > index) {
+    // Appending in row-major order (region selection) skips the search
+    insert_at = chunk.entriesAt(index).second;
   }
 
-  // Add to primary storage
-  entries_.emplace(entity_key, entry);
+  chunk.entries.insert(insert_at, entry);
+  chunk.tiles.set(index);
+  if (entry.id.type == EntityType::Creature) {
+    chunk.creatures.set(index);
+  } else if (entry.id.type == EntityType::Spawn) {
+    chunk.spawns.set(index);
+  }
+  ++size_;
+  return true;
+}
 
-  // Add to position index
-  uint64_t pos_key = positionKey(entry.id.position);
-  position_index_[pos_key].insert(entity_key);
+void SelectionBucket::eraseEntryAt(SelectionChunk &chunk,
+                                   std::vector<SelectionEntry>::iterator it) {
+  const int index = SelectionChunk::entryTileIndex(*it);
+  const EntityType type = it->id.type;
+  chunk.entries.erase(it);
+  --size_;
+
+  if (type == EntityType::Creature) {
+    chunk.creatures.reset(index);
+  } else if (type == EntityType::Spawn) {
+    chunk.spawns.reset(index);
+  }
+
+  auto [first, last] = chunk.entriesAt(index);
+  if (first == last) {
+    chunk.tiles.reset(index);
+  }
 }
 
 void SelectionBucket::remove(const EntityId &id) {
-  uint64_t entity_key = entityKey(id);
-
-  auto it = entries_.find(entity_key);
-  if (it == entries_.end()) {
+  auto chunk_it = chunks_.find(chunkKeyOf(id.position));
+  if (chunk_it == chunks_.end()) {
     return; // Not selected, no-op
   }
 
-  // Remove from position index
-  uint64_t pos_key = positionKey(id.position);
-  auto pos_it = position_index_.find(pos_key);
-  if (pos_it != position_index_.end()) {
-    pos_it->second.erase(entity_key);
-    // Clean up empty position entries
-    if (pos_it->second.empty()) {
-      position_index_.erase(pos_it);
-    }
+  SelectionChunk &chunk = chunk_it->second;
+  const int index = SelectionChunk::tileIndex(id.position);
+  if (!chunk.tiles.test(index)) {
+    return;
   }
 
-  // Remove from primary storage
-  entries_.erase(it);
+  auto [first, last] = chunk.entriesAt(index);
+  auto it = std::find_if(first, last, [&](const SelectionEntry &entry) {
+    return entry.id == id;
+  });
+  if (it == last) {
+    return;
+  }
+
+  eraseEntryAt(chunk, it);
+  if (chunk.entries.empty()) {
+    chunks_.erase(chunk_it);
+  }
 }
 
 void SelectionBucket::removeAllAt(const Position &pos) {
-  uint64_t pos_key = positionKey(pos);
-
-  auto pos_it = position_index_.find(pos_key);
-  if (pos_it == position_index_.end()) {
+  auto chunk_it = chunks_.find(chunkKeyOf(pos));
+  if (chunk_it == chunks_.end()) {
     return; // No entries at this position
   }
 
-  // Copy the set of entity keys (we'll modify the map while iterating)
-  std::vector<uint64_t> entity_keys(pos_it->second.begin(),
-                                    pos_it->second.end());
+  SelectionChunk &chunk = chunk_it->second;
+  const int index = SelectionChunk::tileIndex(pos);
+  if (!chunk.tiles.test(index)) {
+    return;
+  }
+
+  auto [first, last] = chunk.entriesAt(index);
+  size_ -= static_cast<size_t>(std::distance(first, last));
+  chunk.entries.erase(first, last);
+  chunk.tiles.reset(index);
+  chunk.creatures.reset(index);
+  chunk.spawns.reset(index);
+
+  if (chunk.entries.empty()) {
+    chunks_.erase(chunk_it);
+  }
+}
+
+size_t SelectionBucket::addChunkEntries(int32_t chunk_x, int32_t chunk_y,
+                                        int16_t z,
+                                        const std::vector<SelectionEntry> &entries,
+                                        std::vector<SelectionEntry> *added) {
+  if (entries.empty()) {
+    return 0;
+  }
+
+  const uint64_t key = chunkKey(chunk_x, chunk_y, z);
+  SelectionChunk &chunk = chunks_[key];
+  if (chunk.entries.empty()) {
+    chunk.chunk_x = chunk_x;
+    chunk.chunk_y = chunk_y;
+    chunk.z = z;
+  }
+
+  // Both runs are sorted by tile index: merge once instead of inserting each
+  // entry into the middle of the vector
+  std::vector<SelectionEntry> merged;
+  merged.reserve(chunk.entries.size() + entries.size());
+  auto old_it = chunk.entries.begin();
+  const auto old_end = chunk.entries.end();
+  size_t inserted = 0;
+
+  for (auto it = entries.begin(); it != entries.end();) {
+    const int index = SelectionChunk::entryTileIndex(*it);
+    while (old_it != old_end &&
+           SelectionChunk::entryTileIndex(*old_it) < index) {
+      merged.push_back(*old_it++);
+    }
+
+    const size_t run_begin = merged.size();
+    while (old_it != old_end &&
+           SelectionChunk::entryTileIndex(*old_it) == index) {
+      merged.push_back(*old_it++);
+    }
+    const size_t run_end = merged.size();
+
+    for (; it != entries.end() && SelectionChunk::entryTileIndex(*it) == index;
+         ++it) {
+      const bool selected =
+          std::any_of(merged.begin() + run_begin, merged.begin() + run_end,
+                      [&](const SelectionEntry &e) { return e.id == it->id; });
+      if (selected) {
+        continue;
+      }
+
+      merged.push_back(*it);
+      chunk.tiles.set(index);
+      if (it->id.type == EntityType::Creature) {
+        chunk.creatures.set(index);
+      } else if (it->id.type == EntityType::Spawn) {
+        chunk.spawns.set(index);
+      }
+      if (added) {
+        added->push_back(*it);
+      }
+      ++inserted;
+    }
+  }
+  merged.insert(merged.end(), old_it, old_end);
+
+  chunk.entries = std::move(merged);
+  size_ += inserted;
+  if (chunk.entries.empty()) {
+    chunks_.erase(key);
+  }
+  return inserted;
+}
+
+size_t SelectionBucket::removeFromChunk(SelectionChunk &chunk,
+                                        const TileMask &mask,
+                                        const SelectionFilter &filter,
+                                        std::vector<SelectionEntry> *removed) {
+  TileMask hit = mask;
+  hit &= chunk.tiles;
+  if (!hit.any()) {
+    return 0;
+  }
+
+  const bool whole_tiles = filter.coversAllTypes();
+  auto keep_end = std::stable_partition(
+      chunk.entries.begin(), chunk.entries.end(),
+      [&](const SelectionEntry &entry) {
+        return !hit.test(SelectionChunk::entryTileIndex(entry)) ||
+               (!whole_tiles && !filter.matches(entry.id));
+      });
+  const size_t count =
+      static_cast<size_t>(std::distance(keep_end, chunk.entries.end()));
+  if (removed) {
+    removed->insert(removed->end(), keep_end, chunk.entries.end());
+  }
+  chunk.entries.erase(keep_end, chunk.entries.end());
+
+  chunk.tiles.clearBits(hit);
+  chunk.creatures.clearBits(hit);
+  chunk.spawns.clearBits(hit);
+  if (!whole_tiles) {
+    // Hit tiles may still hold entries the filter excluded
+    for (const SelectionEntry &entry : chunk.entries) {
+      const int index = SelectionChunk::entryTileIndex(entry);
+      if (!hit.test(index)) {
+        continue;
+      }
+      chunk.tiles.set(index);
+      if (entry.id.type == EntityType::Creature) {
+        chunk.creatures.set(index);
+      } else if (entry.id.type == EntityType::Spawn) {
+        chunk.spawns.set(index);
+      }
+    }
+  }
+
+  size_ -= count;
+  return count;
+}
 
-  // Remove each entry from primary storage
-  for (uint64_t entity_key : entity_keys) {
-    entries_.erase(entity_key);
+size_t SelectionBucket::removeMasked(int32_t chunk_x, int32_t chunk_y,
+                                     int16_t z, const TileMask &mask,
+                                     const SelectionFilter &filter,
+                                     std::vector<SelectionEntry> *removed) {
+  auto chunk_it = chunks_.find(chunkKey(chunk_x, chunk_y, z));
+  if (chunk_it == chunks_.end()) {
+    return 0;
   }
 
-  // Remove position from index
-  position_index_.erase(pos_it);
+  const size_t count = removeFromChunk(chunk_it->second, mask, filter, removed);
+  if (chunk_it->second.entries.empty()) {
+    chunks_.erase(chunk_it);
+  }
+  return count;
+}
+
+size_t SelectionBucket::removeRect(int32_t min_x, int32_t min_y, int32_t max_x,
+                                   int32_t max_y, int16_t z,
+                                   const SelectionFilter &filter,
+                                   std::vector<SelectionEntry> *removed) {
+  if (min_x > max_x || min_y > max_y) {
+    return 0;
+  }
+
+  constexpr int SIZE = SelectionChunk::SIZE;
+  size_t removed_count = 0;
+
+  for (auto chunk_it = chunks_.begin(); chunk_it != chunks_.end();) {
+    SelectionChunk &chunk = chunk_it->second;
+    const int32_t wx = chunk.worldX();
+    const int32_t wy = chunk.worldY();
+    if (chunk.z != z || wx > max_x || wx + SIZE - 1 < min_x || wy > max_y ||
+        wy + SIZE - 1 < min_y) {
+      ++chunk_it;
+      continue;
+    }
+
+    const TileMask rect = TileMask::rect(
+        std::max(min_x - wx, 0), std::max(min_y - wy, 0),
+        std::min(max_x - wx, SIZE - 1), std::min(max_y - wy, SIZE - 1));
+    removed_count += removeFromChunk(chunk, rect, filter, removed);
+
+    if (chunk.entries.empty()) {
+      chunk_it = chunks_.erase(chunk_it);
+    } else {
+      ++chunk_it;
+    }
+  }
+
+  return removed_count;
 }
 
 void SelectionBucket::clear() {
-  entries_.clear();
-  position_index_.clear();
+  chunks_.clear();
+  size_ = 0;
+}
+
+const SelectionChunk *SelectionBucket::findChunk(const Position &pos) const {
+  auto it = chunks_.find(chunkKeyOf(pos));
+  return it != chunks_.end() ? &it->second : nullptr;
+}
+
+const SelectionChunk *SelectionBucket::getChunk(int32_t chunk_x,
+                                                int32_t chunk_y,
+                                                int16_t z) const {
+  auto it = chunks_.find(chunkKey(chunk_x, chunk_y, z));
+  return it != chunks_.end() ? &it->second : nullptr;
 }
 
 bool SelectionBucket::contains(const EntityId &id) const {
-  return entries_.find(entityKey(id)) != entries_.end();
+  const SelectionChunk *chunk = findChunk(id.position);
+  if (!chunk) {
+    return false;
+  }
+
+  const int index = SelectionChunk::tileIndex(id.position);
+  if (!chunk->tiles.test(index)) {
+    return false;
+  }
+
+  auto [first, last] = chunk->entriesAt(index);
+  return std::any_of(first, last,
+                     [&](const SelectionEntry &entry) { return entry.id == id; });
 }
 
 bool SelectionBucket::hasEntriesAt(const Position &pos) const {
-  auto it = position_index_.find(positionKey(pos));
-  return it != position_index_.end() && !it->second.empty();
+  const SelectionChunk *chunk = findChunk(pos);
+  return chunk && chunk->tiles.test(SelectionChunk::tileIndex(pos));
+}
+
+bool SelectionBucket::hasCreatureAt(const Position &pos) const {
+  const SelectionChunk *chunk = findChunk(pos);
+  return chunk && chunk->creatures.test(SelectionChunk::tileIndex(pos));
+}
+
+bool SelectionBucket::hasSpawnAt(const Position &pos) const {
+  const SelectionChunk *chunk = findChunk(pos);
+  return chunk && chunk->spawns.test(SelectionChunk::tileIndex(pos));
 }
 
 std::vector<SelectionEntry>
 SelectionBucket::getEntriesAt(const Position &pos) const {
-  std::vector<SelectionEntry> result;
-
-  auto pos_it = position_index_.find(positionKey(pos));
-  if (pos_it == position_index_.end()) {
-    return result;
+  const SelectionChunk *chunk = findChunk(pos);
+  if (!chunk) {
+    return {};
   }
 
-  result.reserve(pos_it->second.size());
-  for (uint64_t entity_key : pos_it->second) {
-    auto entry_it = entries_.find(entity_key);
-    if (entry_it != entries_.end()) {
-      result.push_back(entry_it->second);
-    }
+  const int index = SelectionChunk::tileIndex(pos);
+  if (!chunk->tiles.test(index)) {
+    return {};
   }
 
-  return result;
+  auto [first, last] = chunk->entriesAt(index);
+  return std::vector<SelectionEntry>(first, last);
 }
 
 std::vector<SelectionEntry> SelectionBucket::getAllEntries() const {
   std::vector<SelectionEntry> result;
-  result.reserve(entries_.size());
+  result.reserve(size_);
 
-  for (const auto &[key, entry] : entries_) {
-    result.push_back(entry);
+  for (const auto &[key, chunk] : chunks_) {
+    result.insert(result.end(), chunk.entries.begin(), chunk.entries.end());
   }
 
   return result;
@@ -111,23 +356,17 @@ std::vector<SelectionEntry> SelectionBucket::getAllEntries() const {
 
 std::vector<Position> SelectionBucket::getPositions() const {
   std::vector<Position> result;
-  result.reserve(position_index_.size());
-
-  for (const auto &[pos_key, entity_keys] : position_index_) {
-    if (!entity_keys.empty()) {
-      // Get position from any entry at this position
-      auto entity_it = entries_.find(*entity_keys.begin());
-      if (entity_it != entries_.end()) {
-        result.push_back(entity_it->second.id.position);
-      }
-    }
+
+  for (const auto &[key, chunk] : chunks_) {
+    chunk.tiles.forEachSetBit(
+        [&](int index) { result.push_back(chunk.tilePosition(index)); });
   }
 
   return result;
 }
 
 Position SelectionBucket::getMinBound() const {
-  if (entries_.empty()) {
+  if (chunks_.empty()) {
     return Position{0, 0, 0};
   }
 
@@ -135,18 +374,20 @@ Position SelectionBucket::getMinBound() const {
   int32_t min_y = std::numeric_limits<int32_t>::max();
   int16_t min_z = std::numeric_limits<int16_t>::max();
 
-  for (const auto &[key, entry] : entries_) {
-    const Position &pos = entry.id.position;
-    min_x = std::min(min_x, pos.x);
-    min_y = std::min(min_y, pos.y);
-    min_z = std::min(min_z, pos.z);
+  for (const auto &[key, chunk] : chunks_) {
+    int lx0, ly0, lx1, ly1;
+    if (chunk.tiles.bounds(lx0, ly0, lx1, ly1)) {
+      min_x = std::min(min_x, chunk.worldX() + lx0);
+      min_y = std::min(min_y, chunk.worldY() + ly0);
+      min_z = std::min(min_z, chunk.z);
+    }
   }
 
   return Position{min_x, min_y, min_z};
 }
 
 Position SelectionBucket::getMaxBound() const {
-  if (entries_.empty()) {
+  if (chunks_.empty()) {
     return Position{0, 0, 0};
   }
 
@@ -154,11 +395,13 @@ Position SelectionBucket::getMaxBound() const {
   int32_t max_y = std::numeric_limits<int32_t>::min();
   int16_t max_z = std::numeric_limits<int16_t>::min();
 
-  for (const auto &[key, entry] : entries_) {
-    const Position &pos = entry.id.position;
-    max_x = std::max(max_x, pos.x);
-    max_y = std::max(max_y, pos.y);
-    max_z = std::max(max_z, pos.z);
+  for (const auto &[key, chunk] : chunks_) {
+    int lx0, ly0, lx1, ly1;
+    if (chunk.tiles.bounds(lx0, ly0, lx1, ly1)) {
+      max_x = std::max(max_x, chunk.worldX() + lx1);
+      max_y = std::max(max_y, chunk.worldY() + ly1);
+      max_z = std::max(max_z, chunk.z);
+    }
   }
 
   return Position{max_x, max_y, max_z};
@@ -168,28 +411,21 @@ std::vector<SelectionEntry>
 SelectionBucket::getEntriesOnFloor(int16_t floor) const {
   std::vector<SelectionEntry> result;
 
-  for (const auto &[key, entry] : entries_) {
-    if (entry.id.position.z == floor) {
-      result.push_back(entry);
-    }
-  }
+  forEachChunkOnFloor(floor, [&](const SelectionChunk &chunk) {
+    result.insert(result.end(), chunk.entries.begin(), chunk.entries.end());
+  });
 
   return result;
 }
 
 std::vector<Position>
 SelectionBucket::getPositionsOnFloor(int16_t floor) const {
-  std::set<uint64_t> seen_positions; // Use set to deduplicate
   std::vector<Position> result;
 
-  for (const auto &[key, entry] : entries_) {
-    if (entry.id.position.z == floor) {
-      uint64_t pos_key = positionKey(entry.id.position);
-      if (seen_positions.insert(pos_key).second) {
-        result.push_back(entry.id.position);
-      }
-    }
-  }
+  forEachChunkOnFloor(floor, [&](const SelectionChunk &chunk) {
+    chunk.tiles.forEachSetBit(
+        [&](int index) { result.push_back(chunk.tilePosition(index)); });
+  });
 
   return result;
 }
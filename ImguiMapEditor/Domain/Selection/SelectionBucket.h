@@ -1,8 +1,8 @@
 #pragma once
+#include "SelectionChunk.h"
 #include "SelectionEntry.h"
-#include <set>
+#include "SelectionFilter.h"
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 namespace MapEditor::Domain::Selection {
@@ -12,9 +12,11 @@ namespace MapEditor::Domain::Selection {
  * No business logic - just storage and basic queries.
  *
  * Design principles:
- * - Single source of truth: entries_ map
- * - position_index_ is a secondary index for O(1) position lookup
- * - Invariant: position_index_ is always consistent with entries_
+ * - Storage is partitioned by map chunk (32x32 tiles per floor)
+ * - Each SelectionChunk keeps tile/creature/spawn bitmasks plus the
+ *   selected entries grouped by tile, so position queries are a bit test
+ *   and region operations work on whole mask words
+ * - Invariant: a tile bit is set iff the chunk has entries on that tile
  *
  * Thread safety: NOT thread-safe. Caller must synchronize access.
  */
@@ -34,8 +36,9 @@ public:
   /**
    * Add an entry to the selection.
    * If the entry already exists (by EntityId), it is not duplicated.
+   * @return true if the entry was inserted
    */
-  void add(const SelectionEntry &entry);
+  bool add(const SelectionEntry &entry);
 
   /**
    * Remove an entry by its EntityId.
@@ -48,6 +51,38 @@ public:
    */
   void removeAllAt(const Position &pos);
 
+  /**
+   * Merge new entries of one chunk in a single pass.
+   * @param entries Entries inside chunk (chunk_x, chunk_y, z), sorted by tile
+   *                index; entries that are already selected are skipped
+   * @param added Optional output for the entries actually inserted
+   * @return Number of entries inserted
+   */
+  size_t addChunkEntries(int32_t chunk_x, int32_t chunk_y, int16_t z,
+                         const std::vector<SelectionEntry> &entries,
+                         std::vector<SelectionEntry> *added = nullptr);
+
+  /**
+   * Remove filter-matching entries on the tiles set in mask of one chunk.
+   * With an all-types filter the masks are cleared word by word.
+   * @param removed Optional output for the removed entries
+   * @return Number of entries removed
+   */
+  size_t removeMasked(int32_t chunk_x, int32_t chunk_y, int16_t z,
+                      const TileMask &mask, const SelectionFilter &filter,
+                      std::vector<SelectionEntry> *removed = nullptr);
+
+  /**
+   * Remove filter-matching entries inside an inclusive rectangle on one
+   * floor. Works on whole mask words per chunk.
+   * @param removed Optional output for the removed entries
+   * @return Number of entries removed
+   */
+  size_t removeRect(int32_t min_x, int32_t min_y, int32_t max_x, int32_t max_y,
+                    int16_t z,
+                    const SelectionFilter &filter = SelectionFilter::all(),
+                    std::vector<SelectionEntry> *removed = nullptr);
+
   /**
    * Clear all entries.
    */
@@ -65,15 +100,21 @@ public:
    */
   bool hasEntriesAt(const Position &pos) const;
 
+  /**
+   * Check if the creature / spawn at a position is selected.
+   */
+  bool hasCreatureAt(const Position &pos) const;
+  bool hasSpawnAt(const Position &pos) const;
+
   /**
    * Get the total number of selected entities.
    */
-  size_t size() const { return entries_.size(); }
+  size_t size() const { return size_; }
 
   /**
    * Check if the selection is empty.
    */
-  bool empty() const { return entries_.empty(); }
+  bool empty() const { return size_ == 0; }
 
   // === Iteration ===
 
@@ -119,18 +160,60 @@ public:
    */
   std::vector<Position> getPositionsOnFloor(int16_t floor) const;
 
-private:
-  // Primary storage: entity hash → entry
-  // Using hash of EntityId as key for O(1) lookup
-  std::unordered_map<uint64_t, SelectionEntry> entries_;
+  // === Chunk-level iteration ===
+
+  /**
+   * Iterate all non-empty selection chunks.
+   * Callback: void(const SelectionChunk &chunk)
+   */
+  template <typename Func> void forEachChunk(Func &&callback) const {
+    for (const auto &[key, chunk] : chunks_) {
+      callback(chunk);
+    }
+  }
 
-  // Secondary index: position pack → set of entity hashes at that position
-  // Enables O(1) lookup of "what's selected at this position?"
-  std::unordered_map<uint64_t, std::unordered_set<uint64_t>> position_index_;
+  /**
+   * Iterate non-empty selection chunks on one floor.
+   */
+  template <typename Func>
+  void forEachChunkOnFloor(int16_t floor, Func &&callback) const {
+    for (const auto &[key, chunk] : chunks_) {
+      if (chunk.z == floor) {
+        callback(chunk);
+      }
+    }
+  }
 
-  // Helpers
-  static uint64_t positionKey(const Position &pos) { return pos.pack(); }
-  static uint64_t entityKey(const EntityId &id) { return id.hash(); }
+  /**
+   * Get selection chunk by chunk coordinates, or nullptr if nothing is
+   * selected there.
+   */
+  const SelectionChunk *getChunk(int32_t chunk_x, int32_t chunk_y,
+                                 int16_t z) const;
+
+  size_t getChunkCount() const { return chunks_.size(); }
+
+private:
+  // Chunk key → per-chunk masks and entries (empty chunks are erased)
+  std::unordered_map<uint64_t, SelectionChunk> chunks_;
+  size_t size_ = 0;
+
+  static uint64_t chunkKey(int32_t chunk_x, int32_t chunk_y, int16_t z) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(chunk_x)) << 36) ^
+           (static_cast<uint64_t>(static_cast<uint32_t>(chunk_y)) << 8) ^
+           static_cast<uint8_t>(z);
+  }
+  static uint64_t chunkKeyOf(const Position &pos) {
+    return chunkKey(pos.x >> SelectionChunk::SHIFT,
+                    pos.y >> SelectionChunk::SHIFT, pos.z);
+  }
+
+  const SelectionChunk *findChunk(const Position &pos) const;
+  void eraseEntryAt(SelectionChunk &chunk,
+                    std::vector<SelectionEntry>::iterator it);
+  size_t removeFromChunk(SelectionChunk &chunk, const TileMask &mask,
+                         const SelectionFilter &filter,
+                         std::vector<SelectionEntry> *removed);
 };
 
 } // namespace MapEditor::Domain::Selection
@@ -0,0 +1,197 @@
+#pragma once
+#include "Core/Config.h"
+#include "SelectionEntry.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace MapEditor::Domain::Selection {
+
+/**
+ * One bit per tile of a map chunk (bit index = local_y * SIZE + local_x).
+ *
+ * With 32x32 chunks this is 16 words, so whole-chunk queries and rectangle
+ * operations run a row pair per word instead of one hash lookup per tile.
+ */
+struct TileMask {
+  static constexpr int SIZE = Config::Performance::CHUNK_SIZE;
+  static constexpr int BIT_COUNT = SIZE * SIZE;
+  static constexpr int WORD_COUNT = BIT_COUNT / 64;
+
+  static_assert(SIZE <= 64 && 64 % SIZE == 0,
+                "TileMask rows must pack evenly into 64-bit words");
+
+  std::array<uint64_t, WORD_COUNT> words{};
+
+  bool test(int index) const {
+    return (words[index >> 6] >> (index & 63)) & 1u;
+  }
+  void set(int index) { words[index >> 6] |= uint64_t{1} << (index & 63); }
+  void reset(int index) { words[index >> 6] &= ~(uint64_t{1} << (index & 63)); }
+
+  bool any() const {
+    for (uint64_t w : words) {
+      if (w)
+        return true;
+    }
+    return false;
+  }
+
+  size_t count() const {
+    size_t total = 0;
+    for (uint64_t w : words) {
+      total += static_cast<size_t>(std::popcount(w));
+    }
+    return total;
+  }
+
+  TileMask &operator|=(const TileMask &other) {
+    for (int i = 0; i < WORD_COUNT; ++i)
+      words[i] |= other.words[i];
+    return *this;
+  }
+
+  TileMask &operator&=(const TileMask &other) {
+    for (int i = 0; i < WORD_COUNT; ++i)
+      words[i] &= other.words[i];
+    return *this;
+  }
+
+  /**
+   * Clear every bit that is set in other.
+   */
+  void clearBits(const TileMask &other) {
+    for (int i = 0; i < WORD_COUNT; ++i)
+      words[i] &= ~other.words[i];
+  }
+
+  /**
+   * Call callback(index) for each set bit in ascending order.
+   */
+  template <typename Func> void forEachSetBit(Func &&callback) const {
+    for (int w = 0; w < WORD_COUNT; ++w) {
+      uint64_t bits = words[w];
+      while (bits) {
+        callback(w * 64 + std::countr_zero(bits));
+        bits &= bits - 1;
+      }
+    }
+  }
+
+  /**
+   * Bits of one row (bit x = local tile x).
+   */
+  uint64_t row(int y) const {
+    constexpr uint64_t ROW_MASK =
+        SIZE >= 64 ? ~uint64_t{0} : (uint64_t{1} << SIZE) - 1;
+    const int bit = y * SIZE;
+    return (words[bit >> 6] >> (bit & 63)) & ROW_MASK;
+  }
+
+  /**
+   * Mask covering an inclusive rectangle in local chunk coordinates.
+   */
+  static TileMask rect(int min_x, int min_y, int max_x, int max_y) {
+    TileMask mask;
+    const int width = max_x - min_x + 1;
+    const uint64_t row_bits =
+        (width >= 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1) << min_x;
+    for (int y = min_y; y <= max_y; ++y) {
+      const int bit = y * SIZE;
+      mask.words[bit >> 6] |= row_bits << (bit & 63);
+    }
+    return mask;
+  }
+
+  /**
+   * Local bounding box of the set bits.
+   * @return false if no bit is set
+   */
+  bool bounds(int &min_x, int &min_y, int &max_x, int &max_y) const {
+    uint64_t columns = 0;
+    min_y = SIZE;
+    max_y = -1;
+    for (int y = 0; y < SIZE; ++y) {
+      const uint64_t bits = row(y);
+      if (bits) {
+        columns |= bits;
+        min_y = std::min(min_y, y);
+        max_y = y;
+      }
+    }
+    if (!columns)
+      return false;
+    min_x = std::countr_zero(columns);
+    max_x = 63 - std::countl_zero(columns);
+    return true;
+  }
+};
+
+/**
+ * Selection state of a single map chunk on one floor.
+ *
+ * Masks answer "is anything / any creature / any spawn selected here" with
+ * a bit test. Entries are only stored for what is actually selected and are
+ * kept grouped by tile index so a tile's entries form one contiguous run.
+ */
+struct SelectionChunk {
+  static constexpr int SIZE = TileMask::SIZE;
+  static constexpr int SHIFT = std::countr_zero(static_cast<unsigned>(SIZE));
+
+  int32_t chunk_x = 0;
+  int32_t chunk_y = 0;
+  int16_t z = 0;
+
+  TileMask tiles;     // Tiles with at least one selected entry
+  TileMask creatures; // Tiles whose creature is selected
+  TileMask spawns;    // Tiles whose spawn is selected
+
+  std::vector<SelectionEntry> entries; // Sorted by tile index
+
+  int32_t worldX() const { return chunk_x * SIZE; }
+  int32_t worldY() const { return chunk_y * SIZE; }
+
+  static int tileIndex(const Position &pos) {
+    return (pos.y & (SIZE - 1)) * SIZE + (pos.x & (SIZE - 1));
+  }
+
+  static int entryTileIndex(const SelectionEntry &entry) {
+    return tileIndex(entry.id.position);
+  }
+
+  Position tilePosition(int index) const {
+    return Position{worldX() + (index & (SIZE - 1)), worldY() + (index >> SHIFT),
+                    z};
+  }
+
+  using EntryIterator = std::vector<SelectionEntry>::iterator;
+  using ConstEntryIterator = std::vector<SelectionEntry>::const_iterator;
+
+  /**
+   * Contiguous run of entries on one tile (empty range if none).
+   */
+  std::pair<ConstEntryIterator, ConstEntryIterator>
+  entriesAt(int index) const {
+    return std::equal_range(entries.begin(), entries.end(), index,
+                            TileIndexLess{});
+  }
+
+  std::pair<EntryIterator, EntryIterator> entriesAt(int index) {
+    return std::equal_range(entries.begin(), entries.end(), index,
+                            TileIndexLess{});
+  }
+
+private:
+  struct TileIndexLess {
+    bool operator()(const SelectionEntry &entry, int index) const {
+      return entryTileIndex(entry) < index;
+    }
+    bool operator()(int index, const SelectionEntry &entry) const {
+      return index < entryTileIndex(entry);
+    }
+  };
+};
+
+} // namespace MapEditor::Domain::Selection
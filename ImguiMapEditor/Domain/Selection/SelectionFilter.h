@@ -52,6 +52,14 @@ struct SelectionFilter {
     return includes(id.type);
   }
 
+  /**
+   * Whether every entity on a tile matches (whole-tile operations).
+   */
+  bool coversAllTypes() const {
+    return !specific_entity.has_value() && include_ground && include_items &&
+           include_creatures && include_spawns;
+  }
+
   /**
    * Create a filter that includes all entity types.
    */
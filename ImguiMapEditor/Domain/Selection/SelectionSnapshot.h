@@ -1,6 +1,5 @@
 #pragma once
 #include "SelectionBucket.h"
-#include <vector>
 
 namespace MapEditor::Domain::Selection {
 
@@ -18,9 +17,9 @@ namespace MapEditor::Domain::Selection {
  *   bucket = snapshot.restore();
  *
  * Design notes:
- * - Stores a copy of all entries (value semantics)
- * - No pointers to avoid dangling after map changes
- * - Lightweight: only stores SelectionEntry structs
+ * - Stores a copy of the bucket (value semantics)
+ * - Copying per-chunk masks and entry vectors is a handful of bulk copies,
+ *   so capture/restore never rebuilds the selection entry by entry
  */
 class SelectionSnapshot {
 public:
@@ -34,7 +33,7 @@ public:
    */
   static SelectionSnapshot capture(const SelectionBucket &bucket) {
     SelectionSnapshot snapshot;
-    snapshot.entries_ = bucket.getAllEntries();
+    snapshot.bucket_ = bucket;
     return snapshot;
   }
 
@@ -42,31 +41,25 @@ public:
    * Restore a SelectionBucket from this snapshot.
    * Creates a new bucket with the captured state.
    */
-  SelectionBucket restore() const {
-    SelectionBucket bucket;
-    for (const auto &entry : entries_) {
-      bucket.add(entry);
-    }
-    return bucket;
-  }
+  SelectionBucket restore() const { return bucket_; }
 
   /**
    * Get the number of entries in this snapshot.
    */
-  size_t size() const { return entries_.size(); }
+  size_t size() const { return bucket_.size(); }
 
   /**
    * Check if this snapshot is empty.
    */
-  bool empty() const { return entries_.empty(); }
+  bool empty() const { return bucket_.empty(); }
 
   /**
-   * Get all entries in this snapshot (for debugging/inspection).
+   * Get the captured bucket (for debugging/inspection).
    */
-  const std::vector<SelectionEntry> &getEntries() const { return entries_; }
+  const SelectionBucket &getBucket() const { return bucket_; }
 
 private:
-  std::vector<SelectionEntry> entries_;
+  SelectionBucket bucket_;
 };
 
 } // namespace MapEditor::Domain::Selection
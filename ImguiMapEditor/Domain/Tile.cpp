@@ -121,9 +121,23 @@ void Tile::addItemDirect(std::unique_ptr<Item> item) {
   markDirty();
 }
 
+void Tile::setFlags(TileFlag flags) {
+  if (flags_ != flags) {
+    flags_ = flags;
+    markDirty();
+  }
+}
+
 void Tile::removeFlag(TileFlag flag) {
-  flags_ = static_cast<TileFlag>(static_cast<uint16_t>(flags_) &
-                                 ~static_cast<uint16_t>(flag));
+  setFlags(static_cast<TileFlag>(static_cast<uint16_t>(flags_) &
+                                 ~static_cast<uint16_t>(flag)));
+}
+
+void Tile::setHouseId(uint32_t id) {
+  if (house_id_ != id) {
+    house_id_ = id;
+    markDirty();
+  }
 }
 
 void Tile::markDirty() {
@@ -197,6 +211,7 @@ void Tile::setSpawn(std::unique_ptr<Spawn> spawn) {
 
   if (parent_chunk_) {
     parent_chunk_->invalidateSpawns();
+    parent_chunk_->bumpRevision();
     // Only update count if existence changed
     if (had_spawn && !has_spawn) {
       parent_chunk_->updateSpawnCount(-1);
@@ -210,6 +225,7 @@ std::unique_ptr<Spawn> Tile::removeSpawn() {
   if (spawn_ && parent_chunk_) {
     parent_chunk_->invalidateSpawns();
     parent_chunk_->updateSpawnCount(-1);
+    parent_chunk_->bumpRevision();
   }
   return std::move(spawn_);
 }
@@ -225,9 +241,18 @@ void Tile::setCreature(std::unique_ptr<Creature> creature) {
       parent_chunk_->updateCreatureCount(-1);
     } else if (!had_creature && has_creature) {
       parent_chunk_->updateCreatureCount(1);
+    } else if (has_creature) {
+      parent_chunk_->bumpRevision(); // Replaced in place
     }
   }
 }
 
+std::unique_ptr<Creature> Tile::removeCreature() {
+  if (creature_ && parent_chunk_) {
+    parent_chunk_->updateCreatureCount(-1);
+  }
+  return std::move(creature_);
+}
+
 } // namespace Domain
 } // namespace MapEditor
@@ -121,18 +121,19 @@ public:
 
   // Flags
   TileFlag getFlags() const { return flags_; }
-  void setFlags(TileFlag flags) { flags_ = flags; }
-  void setFlags(uint32_t flags) { flags_ = static_cast<TileFlag>(flags); }
+  void setFlags(TileFlag flags);
+  void setFlags(uint32_t flags) { setFlags(static_cast<TileFlag>(flags)); }
   bool hasFlag(TileFlag flag) const { return Domain::hasFlag(flags_, flag); }
-  void addFlag(TileFlag flag) { flags_ |= flag; }
+  void addFlag(TileFlag flag) { setFlags(flags_ | flag); }
   void removeFlag(TileFlag flag);
 
-  // Helper to mark parent chunk dirty
+  // Helper to mark parent chunk dirty. Call after editing an Item, Spawn or
+  // Creature of this tile in place, so revision-keyed caches notice.
   void markDirty();
 
   // House association
   uint32_t getHouseId() const { return house_id_; }
-  void setHouseId(uint32_t id) { house_id_ = id; }
+  void setHouseId(uint32_t id);
   bool isHouseTile() const { return house_id_ != 0; }
 
   // Spawn association
@@ -147,7 +148,7 @@ public:
   const Creature *getCreature() const { return creature_.get(); }
   Creature *getCreature() { return creature_.get(); }
   void setCreature(std::unique_ptr<Creature> creature); // Defined in Tile.cpp
-  std::unique_ptr<Creature> removeCreature() { return std::move(creature_); }
+  std::unique_ptr<Creature> removeCreature(); // Defined in Tile.cpp
   bool hasCreature() const { return creature_ != nullptr; }
 
   // Clone the tile
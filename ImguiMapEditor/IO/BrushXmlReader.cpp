@@ -5,6 +5,7 @@
 
 #include "BrushXmlReader.h"
 
+#include "../Brushes/Behaviors/AutoBorderer.h"
 #include "../Brushes/BrushRegistry.h"
 #include "../Brushes/Data/BorderBlock.h"
 #include "../Brushes/Data/DoodadAlternative.h"
@@ -15,6 +16,7 @@
 #include "../Services/Brushes/TableLookupService.h"
 #include "../Services/Brushes/WallLookupService.h"
 #include "XmlUtils.h"
+#include <array>
 #include <spdlog/spdlog.h>
 
 
@@ -86,7 +88,10 @@ void BrushXmlReader::parseBrushesRoot(const pugi::xml_node &root,
       parseBrush(child);
     }
     // RME also supports ground, wall, doodad, table, carpet as direct children
-    else if (nodeName == "ground" || nodeName == "wall" ||
+    // Shared border definitions (borders.xml) referenced by ground brushes
+    else if (nodeName == "border") {
+      parseBorderDefinition(child);
+    } else if (nodeName == "ground" || nodeName == "wall" ||
              nodeName == "doodad" || nodeName == "table" ||
              nodeName == "carpet") {
       parseBrush(child);
@@ -152,24 +157,37 @@ void BrushXmlReader::parseGroundBrush(const pugi::xml_node &node,
     }
   }
 
-  // Parse borders
+  // Parse borders: either inline borderitems or a reference to a shared
+  // definition from borders.xml. The engine only resolves outer borders
+  // against any lower ground, so inner and targeted borders are skipped.
   BorderBlock borders;
   for (pugi::xml_node borderNode : node.children("border")) {
+    std::string align = borderNode.attribute("align").as_string();
     std::string toName = borderNode.attribute("to").as_string();
+    if (align == "inner" || (!toName.empty() && toName != "all")) {
+      continue;
+    }
     uint32_t groundEquiv = borderNode.attribute("ground_equivalent").as_uint(0);
     borders.setGroundEquivalent(groundEquiv);
 
-    // Parse border items
-    for (pugi::xml_node borderItem : borderNode.children("borderitem")) {
-      std::string edgeName = borderItem.attribute("edge").as_string();
-      uint32_t itemId = borderItem.attribute("id").as_uint(0);
-      uint32_t chance = borderItem.attribute("chance").as_uint(1);
-
-      EdgeType edge = parseEdgeName(edgeName);
-      if (edge != EdgeType::None && itemId != 0) {
-        borders.addItem(edge, itemId, chance);
+    if (!borderNode.child("borderitem")) {
+      uint32_t refId = borderNode.attribute("id").as_uint(0);
+      auto it = borderDefs_.find(refId);
+      if (it == borderDefs_.end()) {
+        spdlog::debug("[BrushXmlReader] Ground brush '{}' references unknown "
+                      "border {}",
+                      name, refId);
+        continue;
+      }
+      for (const auto &[edge, items] : it->second) {
+        for (const auto &[itemId, chance] : items) {
+          borders.addItem(edge, itemId, chance);
+        }
       }
+      continue;
     }
+
+    addBorderItems(borderNode, borders);
   }
 
   // Parse friends/enemies
@@ -186,13 +204,65 @@ void BrushXmlReader::parseGroundBrush(const pugi::xml_node &node,
       "[BrushXmlReader] Parsed ground brush '{}' with {} items, z-order {}",
       name, groundItems.size(), zOrder);
 
+  // Feed the auto-border engine even before GroundBrush exists
+  if (deps_.autoBorder && !groundItems.empty()) {
+    std::vector<uint32_t> groundIds;
+    groundIds.reserve(groundItems.size());
+    for (const auto &[id, chance] : groundItems) {
+      groundIds.push_back(id);
+    }
+    borders.setOwnerBrush(name);
+    deps_.autoBorder->registerGround(groundIds, zOrder, std::move(borders));
+  }
+
   // TODO: Create GroundBrush and register with BrushRegistry
   // This will be implemented in Phase 5 when GroundBrush class exists
 }
 
+void BrushXmlReader::parseBorderDefinition(const pugi::xml_node &node) {
+  uint32_t id = node.attribute("id").as_uint(0);
+  if (id == 0) {
+    spdlog::warn("[BrushXmlReader] Skipping border with no id");
+    return;
+  }
+
+  BorderDefinition &def = borderDefs_[id];
+  def.clear();
+  for (pugi::xml_node borderItem : node.children("borderitem")) {
+    EdgeType edge = parseEdgeName(borderItem.attribute("edge").as_string());
+    uint32_t itemId = borderItem.attribute("item").as_uint(0);
+    if (itemId == 0) {
+      itemId = borderItem.attribute("id").as_uint(0);
+    }
+    if (edge != EdgeType::None && itemId != 0) {
+      def[edge].emplace_back(itemId,
+                             borderItem.attribute("chance").as_uint(1));
+    }
+  }
+}
+
+void BrushXmlReader::addBorderItems(const pugi::xml_node &borderNode,
+                                    BorderBlock &borders) {
+  for (pugi::xml_node borderItem : borderNode.children("borderitem")) {
+    std::string edgeName = borderItem.attribute("edge").as_string();
+    uint32_t itemId = borderItem.attribute("id").as_uint(0);
+    if (itemId == 0) {
+      itemId = borderItem.attribute("item").as_uint(0);
+    }
+    uint32_t chance = borderItem.attribute("chance").as_uint(1);
+
+    EdgeType edge = parseEdgeName(edgeName);
+    if (edge != EdgeType::None && itemId != 0) {
+      borders.addItem(edge, itemId, chance);
+    }
+  }
+}
+
 void BrushXmlReader::parseWallBrush(const pugi::xml_node &node,
                                     const std::string &name, uint32_t lookId) {
   // Parse wall segments by type
+  std::array<WallNode, 16> wallNodes;
+  bool hasWallItems = false;
   for (pugi::xml_node wallNode : node.children("wall")) {
     std::string typeStr = wallNode.attribute("type").as_string();
     WallAlign align = parseWallType(typeStr);
@@ -201,6 +271,10 @@ void BrushXmlReader::parseWallBrush(const pugi::xml_node &node,
     for (pugi::xml_node itemNode : wallNode.children("item")) {
       uint32_t id = itemNode.attribute("id").as_uint(0);
       uint32_t chance = itemNode.attribute("chance").as_uint(1);
+      if (id != 0) {
+        wallNodes[static_cast<uint8_t>(align)].addItem(id, chance);
+        hasWallItems = true;
+      }
       if (id != 0 && lookId == 0) {
         lookId = id;
       }
@@ -220,6 +294,10 @@ void BrushXmlReader::parseWallBrush(const pugi::xml_node &node,
 
   spdlog::debug("[BrushXmlReader] Parsed wall brush '{}'", name);
 
+  if (deps_.autoBorder && hasWallItems) {
+    deps_.autoBorder->registerWall(std::move(wallNodes));
+  }
+
   // TODO: Create WallBrush and register with BrushRegistry
   // This will be implemented in Phase 4 when WallBrush class exists
 }
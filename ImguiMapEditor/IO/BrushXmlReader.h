@@ -7,13 +7,20 @@
  * from the standard RME brushes.xml format.
  */
 
+#include "../Brushes/Enums/BrushEnums.h"
+#include <cstdint>
 #include <filesystem>
 #include <pugixml.hpp>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace MapEditor::Brushes {
 class BrushRegistry;
+class AutoBorderer;
+class BorderBlock;
 }
 
 namespace MapEditor::Services {
@@ -41,6 +48,10 @@ namespace MapEditor::IO {
  *       ...
  *     </border>
  *   </brush>
+ *   <brush name="grass open stone pile" type="ground" z-order="3000">
+ *     <item id="469"/>
+ *     <border align="outer" id="38"/>   <!-- defined in borders.xml -->
+ *   </brush>
  *   <brush name="stone_wall" type="wall" server_lookid="1">
  *     <wall type="horizontal">
  *       <item id="100"/>
@@ -58,6 +69,7 @@ public:
     Services::Brushes::TableLookupService *tableLookup = nullptr;
     Services::Brushes::CarpetLookupService *carpetLookup = nullptr;
     Services::ClientDataService *clientData = nullptr;
+    MapEditor::Brushes::AutoBorderer *autoBorder = nullptr;
   };
 
   explicit BrushXmlReader(Dependencies deps);
@@ -71,6 +83,8 @@ public:
 
   /**
    * Load all XML files from a directory.
+   * Shared <border id> definitions must be loaded (e.g. borders.xml) before
+   * the brush files that reference them.
    * @param dir Directory containing brush XML files
    * @return Number of files loaded successfully
    */
@@ -82,9 +96,17 @@ public:
   size_t getLastLoadCount() const { return lastLoadCount_; }
 
 private:
+  // Edge -> (item id, chance) list of a shared <border id> definition
+  using BorderDefinition =
+      std::unordered_map<MapEditor::Brushes::EdgeType,
+                         std::vector<std::pair<uint32_t, uint32_t>>>;
+
   void parseBrushesRoot(const pugi::xml_node &root,
                         const std::filesystem::path &sourceFile);
   void parseBrush(const pugi::xml_node &node);
+  void parseBorderDefinition(const pugi::xml_node &node);
+  void addBorderItems(const pugi::xml_node &borderNode,
+                      MapEditor::Brushes::BorderBlock &borders);
 
   // Type-specific parsers
   void parseGroundBrush(const pugi::xml_node &node, const std::string &name,
@@ -100,6 +122,7 @@ private:
 
   Dependencies deps_;
   std::unordered_set<std::string> loadedFiles_;
+  std::unordered_map<uint32_t, BorderDefinition> borderDefs_;
   size_t lastLoadCount_ = 0;
 };
 
@@ -20,16 +20,26 @@ MainWindow::MainWindow(Services::ViewSettings &view_settings,
   open_sec_dialog_.initialize(&version_registry_);
 }
 
-void MainWindow::openPropertiesDialog(Domain::Item *item) {
+void MainWindow::onPropertiesSaved(const Domain::Position &pos) {
+  if (!tab_manager_ || !tab_manager_->getActiveSession()) {
+    return;
+  }
+  auto *session = tab_manager_->getActiveSession();
+  session->setModified(true);
+  // Dialogs edit in place; let revision-keyed caches see the change
+  if (auto *map = session->getMap()) {
+    if (Domain::Tile *tile = map->getTile(pos)) {
+      tile->markDirty();
+    }
+  }
+}
+
+void MainWindow::openPropertiesDialog(Domain::Item *item,
+                                      const Domain::Position &pos) {
   if (!item)
     return;
 
-  properties_dialog_.open(item, [this]() {
-    // Mark session as modified when properties change
-    if (tab_manager_ && tab_manager_->getActiveSession()) {
-      tab_manager_->getActiveSession()->setModified(true);
-    }
-  });
+  properties_dialog_.open(item, [this, pos]() { onPropertiesSaved(pos); });
 }
 
 void MainWindow::openSpawnPropertiesDialog(Domain::Spawn *spawn,
@@ -37,12 +47,8 @@ void MainWindow::openSpawnPropertiesDialog(Domain::Spawn *spawn,
   if (!spawn)
     return;
 
-  spawn_properties_dialog_.open(spawn, pos, [this]() {
-    // Mark session as modified when spawn properties change
-    if (tab_manager_ && tab_manager_->getActiveSession()) {
-      tab_manager_->getActiveSession()->setModified(true);
-    }
-  });
+  spawn_properties_dialog_.open(spawn, pos,
+                                [this, pos]() { onPropertiesSaved(pos); });
 }
 
 void MainWindow::openCreaturePropertiesDialog(
@@ -51,12 +57,9 @@ void MainWindow::openCreaturePropertiesDialog(
   if (!creature)
     return;
 
-  creature_properties_dialog_.open(creature, name, creature_pos, [this]() {
-    // Mark session as modified when creature properties change
-    if (tab_manager_ && tab_manager_->getActiveSession()) {
-      tab_manager_->getActiveSession()->setModified(true);
-    }
-  });
+  creature_properties_dialog_.open(
+      creature, name, creature_pos,
+      [this, creature_pos]() { onPropertiesSaved(creature_pos); });
 }
 
 void MainWindow::renderEditor(Domain::ChunkedMap *current_map,
@@ -164,14 +167,9 @@ void MainWindow::renderEditor(Domain::ChunkedMap *current_map,
           // Render context menu (call each frame)
           context_menu_.render(
               session, clipboard_,
-              [this](Domain::Item *item) {
+              [this](Domain::Item *item, const Domain::Position &pos) {
                 // Properties callback - open dialog
-                properties_dialog_.open(item, [this]() {
-                  // Mark session as modified when properties change
-                  if (tab_manager_ && tab_manager_->getActiveSession()) {
-                    tab_manager_->getActiveSession()->setModified(true);
-                  }
-                });
+                openPropertiesDialog(item, pos);
               },
               [this](const Domain::Position &dest) {
                 map_panel_.setCameraCenter(dest);
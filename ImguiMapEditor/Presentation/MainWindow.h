@@ -67,8 +67,9 @@ public:
 
   /**
    * Open the properties dialog for a specific item.
+   * @param pos Position of the tile holding the item
    */
-  void openPropertiesDialog(Domain::Item *item);
+  void openPropertiesDialog(Domain::Item *item, const Domain::Position &pos);
   void openSpawnPropertiesDialog(Domain::Spawn *spawn,
                                  const Domain::Position &pos);
   void openCreaturePropertiesDialog(Domain::Creature *creature,
@@ -96,6 +97,9 @@ public:
   }
 
 private:
+  // Mark the session modified and the edited tile's chunk dirty
+  void onPropertiesSaved(const Domain::Position &pos);
+
   std::function<void(int)> on_close_requested_;
 
   Services::ViewSettings &view_settings_;
@@ -3,6 +3,7 @@
 #include "Rendering/Resources/SpriteAtlasLUT.h"
 #include "Services/SpriteManager.h"
 #include <array>
+#include <cstddef>
 #include <cstring>
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
@@ -123,24 +124,18 @@ bool SpriteBatch::initialize() {
   glEnableVertexAttribArray(2);
   glVertexAttribDivisor(2, 1); // Per-instance
 
-  // Location 3: uv (vec4) - u_min, v_min, u_max, v_max
-  glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
-                        (void *)(4 * sizeof(float)));
+  // Location 3: atlas slot (uint) - resolved to layer and UVs in the shader
+  glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(SpriteInstance),
+                         (void *)offsetof(SpriteInstance, slot));
   glEnableVertexAttribArray(3);
   glVertexAttribDivisor(3, 1); // Per-instance
 
-  // Location 4: tint (vec4) - r, g, b, a
-  glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
-                        (void *)(8 * sizeof(float)));
+  // Location 4: tint (RGBA8) - normalized to vec4
+  glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteInstance),
+                        (void *)offsetof(SpriteInstance, tint));
   glEnableVertexAttribArray(4);
   glVertexAttribDivisor(4, 1); // Per-instance
 
-  // Location 5: atlas layer (float) - for texture array sampling
-  glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
-                        (void *)(12 * sizeof(float)));
-  glEnableVertexAttribArray(5);
-  glVertexAttribDivisor(5, 1); // Per-instance
-
   glBindVertexArray(0);
 
   // Initialize multi-draw indirect if GL 4.3+ available
@@ -227,16 +222,8 @@ void SpriteBatch::draw(float x, float y, float w, float h,
   inst.y = y;
   inst.w = w;
   inst.h = h;
-  inst.u_min = region.u_min;
-  inst.v_min = region.v_min;
-  inst.u_max = region.u_max;
-  inst.v_max = region.v_max;
-  inst.r = r;
-  inst.g = g;
-  inst.b = b;
-  inst.a = a;
-  inst.atlas_layer = static_cast<float>(region.atlas_index);
-  inst._pad1 = inst._pad2 = inst._pad3 = 0.0f;
+  inst.slot = region.slot;
+  inst.tint = packTint(r, g, b, a);
 }
 
 void SpriteBatch::flush(const AtlasManager &atlas_manager) {
@@ -276,12 +263,12 @@ void SpriteBatch::flush(const AtlasManager &atlas_manager) {
     // ideal but safe. For static drawing we do this anyway.
     glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
                           (void *)(section_offset + 0));
-    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
-                          (void *)(section_offset + 16));
-    glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
-                          (void *)(section_offset + 32));
-    glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
-                          (void *)(section_offset + 48));
+    glVertexAttribIPointer(
+        3, 1, GL_UNSIGNED_INT, sizeof(SpriteInstance),
+        (void *)(section_offset + offsetof(SpriteInstance, slot)));
+    glVertexAttribPointer(
+        4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteInstance),
+        (void *)(section_offset + offsetof(SpriteInstance, tint)));
 
     glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0,
                             static_cast<GLsizei>(batch_size));
@@ -311,7 +298,8 @@ void SpriteBatch::end(const AtlasManager &atlas_manager) {
   glDisable(GL_BLEND);
 }
 
-void SpriteBatch::drawTileInstances(GLuint vbo, size_t count,
+void SpriteBatch::drawTileInstances(GLuint vbo, size_t count, float origin_x,
+                                    float origin_y,
                                     const AtlasManager &atlas_manager,
                                     SpriteAtlasLUT &lut) {
   if (!in_batch_)
@@ -358,19 +346,21 @@ void SpriteBatch::drawTileInstances(GLuint vbo, size_t count,
     last_bound_vao_ = tile_vao_.get();
   }
 
+  // Instance positions are relative to the chunk origin
+  tile_shader_->setVec2("uOrigin", glm::vec2(origin_x, origin_y));
+
   // Bind instance VBO and set up vertex attributes
   glBindBuffer(GL_ARRAY_BUFFER, vbo);
 
-  // TileInstance layout: x,y,w,h (16), sprite_id (4), flags (4), rgba (16), pad
-  // (8) = 48
-  glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(TileInstance),
-                        (void *)0);
+  // TileInstance layout: x,y,size (6), flags (2), sprite_id (4), rgba8 (4) = 16
+  glVertexAttribPointer(2, 3, GL_SHORT, GL_FALSE, sizeof(TileInstance),
+                        (void *)offsetof(TileInstance, x));
+  glVertexAttribIPointer(5, 1, GL_UNSIGNED_SHORT, sizeof(TileInstance),
+                         (void *)offsetof(TileInstance, flags));
   glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(TileInstance),
-                         (void *)(4 * sizeof(float)));
-  glVertexAttribIPointer(5, 1, GL_UNSIGNED_INT, sizeof(TileInstance),
-                         (void *)(4 * sizeof(float) + sizeof(uint32_t)));
-  glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(TileInstance),
-                        (void *)(4 * sizeof(float) + 2 * sizeof(uint32_t)));
+                         (void *)offsetof(TileInstance, sprite_id));
+  glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(TileInstance),
+                        (void *)offsetof(TileInstance, tint));
 
   glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0,
                           static_cast<GLsizei>(count));
@@ -23,26 +23,26 @@ namespace Rendering {
 class SpriteAtlasLUT;
 
 /**
- * Per-sprite instance data for instanced rendering.
- * Each sprite needs position, size, UV coordinates, color tint, and atlas
- * layer.
+ * Per-sprite instance data for instanced rendering (24 bytes).
+ * Each sprite needs position, size, atlas slot and color tint. UVs and the
+ * texture array layer are derived from the slot in the shader, since every
+ * atlas region is one fixed-size cell of the atlas grid.
  *
  * Layout matches vertex attributes:
  *   location 2: aRect (x, y, w, h)
- *   location 3: aUV (u_min, v_min, u_max, v_max)
- *   location 4: aTint (r, g, b, a)
- *   location 5: aLayer (atlas_layer as float for compatibility)
+ *   location 3: aSlot (uint32, AtlasRegion::slot)
+ *   location 4: aTint (RGBA8, normalized)
  */
 struct SpriteInstance {
-  float x, y;                // Screen position (top-left)
-  float w, h;                // Size in pixels
-  float u_min, v_min;        // UV top-left in atlas
-  float u_max, v_max;        // UV bottom-right in atlas
-  float r, g, b, a;          // Color tint/alpha (1,1,1,1 = no tint)
-  float atlas_layer;         // Which layer in the texture array
-  float _pad1, _pad2, _pad3; // Padding to 64 bytes for alignment
+  float x, y;    // Screen position (top-left)
+  float w, h;    // Size in pixels
+  uint32_t slot; // Atlas slot (layer * SPRITES_PER_LAYER + cell)
+  uint32_t tint; // Color tint/alpha, see packTint()
 };
 
+static_assert(sizeof(SpriteInstance) == 24,
+              "SpriteInstance must be 24 bytes to match the GPU vertex layout");
+
 enum class BatchMode {
   Sprites, // Default mode: Dynamic sprites (UV-based)
   Tiles    // Cached mode: Static tiles (ID-based, VBOs)
@@ -71,8 +71,8 @@ enum class BatchMode {
  */
 class SpriteBatch {
 public:
-  // 64MB buffer = ~1.4M sprites (48 bytes each with tint) - enough for extreme
-  // zoomed-out views
+  // ~34MB per ring section = 1.4M sprites (24 bytes each) - enough for
+  // extreme zoomed-out views
   static constexpr size_t MAX_SPRITES_PER_BATCH =
       Config::Performance::MAX_SPRITES_PER_BATCH;
   static constexpr size_t MAX_ATLASES = Config::Performance::MAX_ATLASES;
@@ -142,11 +142,12 @@ public:
    *
    * @param vbo The VBO containing TileInstance data
    * @param count Number of instances to draw
+   * @param origin_x/origin_y Position the instance offsets are relative to
    * @param atlas_manager Atlas manager for texture binding
    * @param lut Sprite lookup table for ID → UV resolution
    */
-  void drawTileInstances(GLuint vbo, size_t count,
-                         const AtlasManager &atlas_manager,
+  void drawTileInstances(GLuint vbo, size_t count, float origin_x,
+                         float origin_y, const AtlasManager &atlas_manager,
                          SpriteAtlasLUT &lut);
 
   /**
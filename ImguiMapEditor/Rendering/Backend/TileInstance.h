@@ -1,60 +1,97 @@
 #pragma once
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 
 namespace MapEditor {
 namespace Rendering {
 
 /**
- * Per-tile instance data for ID-based GPU caching.
+ * Pack a 0-1 float color into RGBA8 (red in the lowest byte), the byte order
+ * GL reads as a normalized GL_UNSIGNED_BYTE vec4.
+ */
+inline uint32_t packTint(float r, float g, float b, float a) {
+  auto channel = [](float v) {
+    return static_cast<uint32_t>(std::lround(std::clamp(v, 0.0f, 1.0f) * 255.0f));
+  };
+  return channel(r) | (channel(g) << 8) | (channel(b) << 16) |
+         (channel(a) << 24);
+}
+
+/**
+ * Get one 0-1 channel of a packed RGBA8 tint (0 = red ... 3 = alpha).
+ */
+inline float unpackTintChannel(uint32_t tint, int channel) {
+  return static_cast<float>((tint >> (channel * 8)) & 0xFF) / 255.0f;
+}
+
+/**
+ * Per-tile instance data for ID-based GPU caching (16 bytes).
  *
  * CRITICAL ARCHITECTURE PRINCIPLE:
  * This struct stores ONLY stable data that doesn't depend on async sprite
  * loading state. The sprite_id is resolved to UV coordinates in the GPU
  * shader via SpriteAtlasLUT, eliminating cache invalidation on sprite loads.
  *
+ * Cached chunks are generated at zoom 1, so positions are whole pixels. They
+ * are stored relative to the chunk origin, which the shader adds back
+ * (uOrigin), keeping them inside int16 range anywhere on the map.
+ *
  * GPU vertex layout:
- *   location 2: aRect (x, y, w, h)
+ *   location 2: aRect (x, y, size) - int16, converted to float
+ *   location 5: aFlags (uint16)
  *   location 3: aSpriteId (uint32)
- *   location 4: aTint (r, g, b, a)
- *   location 5: aFlags (uint32)
+ *   location 4: aTint (RGBA8, normalized)
  */
 struct TileInstance {
-  // Screen position (top-left corner)
-  float x = 0.0f;
-  float y = 0.0f;
+  // Top-left corner relative to the chunk origin, in pixels
+  int16_t x = 0;
+  int16_t y = 0;
 
-  // Size in pixels
-  float w = 0.0f;
-  float h = 0.0f;
-
-  // Sprite ID - resolved to UV in shader via SpriteAtlasLUT
-  // This is the KEY change: we store the ID, not the resolved UV
-  uint32_t sprite_id = 0;
+  // Quad size in pixels (sprites are square)
+  int16_t size = 0;
 
   // Flags for shader-side decisions
   // Bit 0-7: Animation frame index
   // Bit 8: Is selected
   // Bit 9: Is highlighted
   // Bit 10-15: Reserved
-  uint32_t flags = 0;
+  uint16_t flags = 0;
 
-  // Color tint (lighting, selection highlight, etc.)
-  float r = 1.0f;
-  float g = 1.0f;
-  float b = 1.0f;
-  float a = 1.0f;
+  // Sprite ID - resolved to UV in shader via SpriteAtlasLUT
+  uint32_t sprite_id = 0;
 
-  // Padding to align to 48 bytes (GPU cache line friendly)
-  float _pad[2] = {0.0f, 0.0f};
+  // Color tint (lighting, selection highlight, etc.), see packTint()
+  uint32_t tint = 0xFFFFFFFF;
 
   // Flag bit positions
-  static constexpr uint32_t FLAG_SELECTED = 1 << 8;
-  static constexpr uint32_t FLAG_HIGHLIGHTED = 1 << 9;
-  static constexpr uint32_t FLAG_ANIMATION_MASK = 0xFF;
+  static constexpr uint16_t FLAG_SELECTED = 1 << 8;
+  static constexpr uint16_t FLAG_HIGHLIGHTED = 1 << 9;
+  static constexpr uint16_t FLAG_ANIMATION_MASK = 0xFF;
+
+  /**
+   * Quantize a sprite draw into the compact layout.
+   * @param x,y Top-left corner relative to the chunk origin
+   */
+  static TileInstance pack(float x, float y, float size, uint32_t sprite_id,
+                           float r, float g, float b, float a) {
+    auto coord = [](float v) {
+      return static_cast<int16_t>(
+          std::clamp<long>(std::lround(v), INT16_MIN, INT16_MAX));
+    };
+    TileInstance instance;
+    instance.x = coord(x);
+    instance.y = coord(y);
+    instance.size = static_cast<int16_t>(
+        std::clamp<long>(std::lround(size), 0, INT16_MAX));
+    instance.sprite_id = sprite_id;
+    instance.tint = packTint(r, g, b, a);
+    return instance;
+  }
 };
 
-static_assert(sizeof(TileInstance) == 48,
-              "TileInstance must be 48 bytes for GPU alignment");
+static_assert(sizeof(TileInstance) == 16,
+              "TileInstance must be 16 bytes to match the GPU vertex layout");
 
 } // namespace Rendering
 } // namespace MapEditor
@@ -211,6 +211,8 @@ private:
 
 using DeferredVAOHandle = DeferredGLHandle<VAOTraits>;
 using DeferredVBOHandle = DeferredGLHandle<BufferTraits>;
+using DeferredFBOHandle = DeferredGLHandle<FBOTraits>;
+using DeferredTextureHandle = DeferredGLHandle<TextureTraits>;
 
 } // namespace Rendering
 } // namespace MapEditor
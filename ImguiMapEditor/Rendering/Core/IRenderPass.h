@@ -16,6 +16,7 @@ namespace Rendering {
 
 class SpriteBatch;
 class IRenderPass;
+class FramePreparer;
 
 /**
  * Context containing all necessary state for a render pass.
@@ -44,6 +45,9 @@ struct RenderContext {
 
   // View settings (optional, can be nullptr)
   const Services::ViewSettings *view_settings;
+
+  // Per-floor visibility/overlay data prepared before the passes (optional)
+  const FramePreparer *frame_prep = nullptr;
 };
 
 /**
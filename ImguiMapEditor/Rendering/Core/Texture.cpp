@@ -74,6 +74,19 @@ void Texture::update(const uint8_t* rgba_data) {
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+void Texture::updateRegion(uint32_t x, uint32_t y, uint32_t width,
+                           uint32_t height, const uint8_t* rgba_data) {
+    if (id_ == 0) return;
+
+    glBindTexture(GL_TEXTURE_2D, id_);
+    glTexSubImage2D(GL_TEXTURE_2D, 0,
+                    static_cast<GLint>(x), static_cast<GLint>(y),
+                    static_cast<GLsizei>(width),
+                    static_cast<GLsizei>(height),
+                    GL_RGBA, GL_UNSIGNED_BYTE, rgba_data);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 Texture Texture::fromId(GLuint id, uint32_t width, uint32_t height) {
     Texture tex;
     tex.id_ = id;
@@ -42,6 +42,10 @@ public:
     
     // Update texture data (must be same size)
     void update(const uint8_t* rgba_data);
+
+    // Update a sub-rectangle (data is width*height RGBA, tightly packed)
+    void updateRegion(uint32_t x, uint32_t y, uint32_t width, uint32_t height,
+                      const uint8_t* rgba_data);
     
     // Create from existing OpenGL texture ID (takes ownership)
     static Texture fromId(GLuint id, uint32_t width, uint32_t height);
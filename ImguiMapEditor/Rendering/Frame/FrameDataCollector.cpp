@@ -24,8 +24,10 @@ void FrameDataCollector::collectWaypoints(
     const Domain::ChunkedMap &map, int floor_z, const VisibleBounds &bounds,
     OverlayCollector &collector, const Services::ViewSettings &settings,
     float floor_offset) {
+  waypoint_index_.refresh(map);
   WaypointOverlay::collectVisibleWaypoints(map, floor_z, bounds, collector,
-                                           settings, floor_offset);
+                                           settings, floor_offset,
+                                           &waypoint_index_);
 }
 
 void FrameDataCollector::endFrame(Services::SpriteManager *sprites) {
@@ -1,5 +1,6 @@
 #pragma once
 #include "Domain/ChunkedMap.h"
+#include "Rendering/Overlays/OverlayChunkIndex.h"
 #include "Rendering/Overlays/OverlayCollector.h"
 #include "Rendering/Visibility/ChunkVisibilityManager.h"
 #include "Services/ViewSettings.h"
@@ -69,6 +70,7 @@ public:
 private:
   std::vector<uint32_t> missing_sprites_;
   std::vector<Domain::Chunk *> chunk_buffer_; // Reusable for spawn queries
+  OverlayChunkIndex waypoint_index_;
 };
 
 } // namespace Rendering
@@ -0,0 +1,55 @@
+#include "Rendering/Frame/FrameJobGraph.h"
+#include "Core/WorkerPool.h"
+#include <algorithm>
+#include <cassert>
+
+namespace MapEditor {
+namespace Rendering {
+
+FrameJobGraph::JobId
+FrameJobGraph::add(Job job, std::initializer_list<JobId> dependencies) {
+  const JobId id = static_cast<JobId>(jobs_.size());
+
+  uint32_t wave = 0;
+  for (JobId dependency : dependencies) {
+    assert(dependency < id && "Jobs may only depend on earlier jobs");
+    wave = std::max(wave, job_waves_[dependency] + 1);
+  }
+
+  jobs_.push_back(std::move(job));
+  job_waves_.push_back(wave);
+  if (waves_.size() <= wave) {
+    waves_.resize(wave + 1);
+  }
+  waves_[wave].push_back(id);
+  return id;
+}
+
+void FrameJobGraph::run(WorkerPool *pool) {
+  for (const std::vector<JobId> &wave : waves_) {
+    if (wave.empty()) {
+      continue;
+    }
+    if (pool && wave.size() > 1) {
+      pool->run(wave.size(), [&](size_t index, size_t worker) {
+        jobs_[wave[index]](worker);
+      });
+    } else {
+      for (JobId id : wave) {
+        jobs_[id](0);
+      }
+    }
+  }
+}
+
+void FrameJobGraph::clear() {
+  jobs_.clear();
+  job_waves_.clear();
+  for (auto &wave : waves_) {
+    wave.clear();
+  }
+  waves_.clear();
+}
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+namespace MapEditor {
+
+class WorkerPool;
+
+namespace Rendering {
+
+/**
+ * Small dependency graph of per-frame CPU jobs.
+ *
+ * Jobs may only depend on jobs added before them, so the graph is acyclic by
+ * construction. run() executes it in waves: every job whose dependencies
+ * finished in an earlier wave runs in parallel on the worker pool. Jobs must
+ * not touch GL; the calling (GL) thread consumes their results afterwards.
+ *
+ * Usage per frame:
+ *   graph.clear();
+ *   auto a = graph.add(job_a);
+ *   graph.add(job_b, {a});
+ *   graph.run(&pool);
+ */
+class FrameJobGraph {
+public:
+  using JobId = uint32_t;
+  // Receives the worker slot (0 = calling thread) for per-thread buffers
+  using Job = std::function<void(size_t worker)>;
+
+  /**
+   * Add a job that runs after all of its dependencies.
+   * @return Id to pass as a dependency of later jobs
+   */
+  JobId add(Job job, std::initializer_list<JobId> dependencies = {});
+
+  /**
+   * Execute all jobs and wait for them.
+   * @param pool Worker pool, or nullptr to run everything inline
+   */
+  void run(WorkerPool *pool);
+
+  /**
+   * Remove all jobs (keeps allocations for the next frame).
+   */
+  void clear();
+
+  size_t size() const { return jobs_.size(); }
+  size_t getWaveCount() const { return waves_.size(); }
+
+private:
+  std::vector<Job> jobs_;
+  std::vector<uint32_t> job_waves_;        // Wave index per job
+  std::vector<std::vector<JobId>> waves_;  // Jobs per wave
+};
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -0,0 +1,132 @@
+#include "Rendering/Frame/FramePreparer.h"
+#include "Core/WorkerPool.h"
+#include "Domain/ChunkedMap.h"
+#include "Rendering/Overlays/WaypointOverlay.h"
+#include "Rendering/Passes/SpawnTintPass.h"
+#include "Rendering/Visibility/FloorIterator.h"
+#include "Services/ViewSettings.h"
+
+namespace MapEditor {
+namespace Rendering {
+
+FramePreparer::FramePreparer() = default;
+FramePreparer::~FramePreparer() = default;
+
+void FramePreparer::prepare(const Domain::ChunkedMap &map,
+                            const VisibleBounds &base_bounds, int current_floor,
+                            const Services::ViewSettings *settings) {
+  for (PreparedFloor &floor : floors_) {
+    floor.prepared = false;
+  }
+  for (PreparedFloor &floor : ghost_floors_) {
+    floor.prepared = false;
+  }
+  if (!settings) {
+    return;
+  }
+
+  // Same floor walk as TerrainPass::render
+  const FloorRange range = FloorIterator::calculateRangeWithToggle(
+      current_floor, settings->show_all_floors);
+
+  waypoint_index_.refresh(map);
+
+  graph_.clear();
+  size_t floor_count = 0;
+  for (int z = range.start_z; z >= range.super_end_z; --z) {
+    if (!FloorIterator::shouldRenderFloor(z, range) ||
+        z < Config::Map::MIN_FLOOR || z > Config::Map::MAX_FLOOR) {
+      continue;
+    }
+
+    PreparedFloor &floor = floors_[z - Config::Map::MIN_FLOOR];
+    floor.floor_z = z;
+    floor.floor_offset = FloorIterator::getFloorOffset(current_floor, z);
+    floor.bounds = base_bounds.withFloorOffset(range.start_z - z);
+    floor.spawns.clear();
+    floor.waypoints.clear();
+    floor.prepared = true;
+    ++floor_count;
+
+    // Jobs of one floor only touch that floor's buffers and chunks
+    PreparedFloor *target = &floor;
+    graph_.add([&map, target](size_t) {
+      target->visibility.update(map, target->bounds,
+                                static_cast<int8_t>(target->floor_z),
+                                target->floor_offset);
+    });
+    // Both read Chunk::getSpawnTiles(), which rebuilds lazily: keep them in
+    // one job so the floor's spawn list is never built concurrently
+    graph_.add([&map, target, settings](size_t) {
+      SpawnTintPass::collectVisibleSpawns(map, target->floor_z, target->bounds,
+                                          target->spawns, *settings,
+                                          target->spawn_buffer);
+      if (settings->show_spawns && settings->show_spawn_radius) {
+        target->spawn_tint.update(map, target->floor_z, target->bounds);
+      }
+    });
+    graph_.add([this, &map, target, settings](size_t) {
+      WaypointOverlay::collectVisibleWaypoints(
+          map, target->floor_z, target->bounds, target->waypoints, *settings,
+          target->floor_offset, &waypoint_index_);
+    });
+  }
+
+  // Ghost floors, same selection as GhostFloorRenderer
+  const int ghost_z[2] = {
+      FloorIterator::getGhostHigherFloor(current_floor,
+                                         settings->ghost_higher_floors),
+      FloorIterator::getGhostLowerFloor(current_floor,
+                                        settings->ghost_lower_floors)};
+  for (size_t i = 0; i < ghost_floors_.size(); ++i) {
+    const int z = ghost_z[i];
+    if (z < Config::Map::MIN_FLOOR || z > Config::Map::MAX_FLOOR) {
+      continue;
+    }
+
+    PreparedFloor &floor = ghost_floors_[i];
+    floor.floor_z = z;
+    floor.floor_offset = FloorIterator::getFloorOffset(current_floor, z);
+    floor.bounds = base_bounds;
+    floor.prepared = true;
+    ++floor_count;
+
+    PreparedFloor *target = &floor;
+    graph_.add([&map, target](size_t) {
+      target->visibility.update(map, target->bounds,
+                                static_cast<int8_t>(target->floor_z),
+                                target->floor_offset);
+    });
+  }
+
+  // A single floor is cheaper inline than waking the workers
+  WorkerPool *pool = nullptr;
+  if (floor_count >= Config::Performance::FRAME_PREP_MIN_FLOORS) {
+    if (!workers_) {
+      workers_ = std::make_unique<WorkerPool>(
+          Config::Performance::FRAME_PREP_THREADS);
+    }
+    pool = workers_.get();
+  }
+  graph_.run(pool);
+}
+
+const PreparedFloor *FramePreparer::getFloor(int floor_z) const {
+  if (floor_z < Config::Map::MIN_FLOOR || floor_z > Config::Map::MAX_FLOOR) {
+    return nullptr;
+  }
+  const PreparedFloor &floor = floors_[floor_z - Config::Map::MIN_FLOOR];
+  return floor.prepared ? &floor : nullptr;
+}
+
+const PreparedFloor *FramePreparer::getGhostFloor(int floor_z) const {
+  for (const PreparedFloor &floor : ghost_floors_) {
+    if (floor.prepared && floor.floor_z == floor_z) {
+      return &floor;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -0,0 +1,98 @@
+#pragma once
+#include "Core/Config.h"
+#include "Rendering/Frame/FrameJobGraph.h"
+#include "Rendering/Overlays/OverlayChunkIndex.h"
+#include "Rendering/Overlays/OverlayCollector.h"
+#include "Rendering/Passes/SpawnTintCache.h"
+#include "Rendering/Visibility/ChunkVisibilityManager.h"
+#include "Rendering/Visibility/VisibleBounds.h"
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace MapEditor {
+
+class WorkerPool;
+
+namespace Domain {
+class ChunkedMap;
+class Chunk;
+} // namespace Domain
+
+namespace Services {
+struct ViewSettings;
+}
+
+namespace Rendering {
+
+/**
+ * Per-floor data gathered before any pass draws.
+ */
+struct PreparedFloor {
+  int floor_z = 0;
+  float floor_offset = 0.0f;
+  VisibleBounds bounds;
+  ChunkVisibilityManager visibility; // Kept across frames (incremental)
+  OverlayCollector spawns;    // Spawn radii, merged before tile rendering
+  OverlayCollector waypoints; // Waypoint markers/tooltips, merged after
+  SpawnTintCache spawn_tint;  // Radius tint masks, kept across frames
+  bool prepared = false;
+
+  // Scratch buffer reused between frames
+  std::vector<Domain::Chunk *> spawn_buffer;
+};
+
+/**
+ * Builds the read-only part of a frame (chunk visibility, spawn and
+ * waypoint collection, spawn tint masks) for every drawn floor and the
+ * ghost floors as a FrameJobGraph, running floors in parallel on a
+ * persistent worker pool.
+ *
+ * Tile emission stays on the GL thread: resolving sprites touches the atlas
+ * LRU and async loader, and creature rendering advances simulation state.
+ * The map must not be modified while prepare() runs, which holds because
+ * edits happen on the same (GL) thread between frames.
+ */
+class FramePreparer {
+public:
+  FramePreparer();
+  ~FramePreparer();
+
+  // Non-copyable (owns worker threads)
+  FramePreparer(const FramePreparer &) = delete;
+  FramePreparer &operator=(const FramePreparer &) = delete;
+
+  /**
+   * Prepare all floors TerrainPass will draw this frame.
+   * @param base_bounds Visible bounds of the current floor
+   * @param settings View settings; nothing is prepared when null
+   */
+  void prepare(const Domain::ChunkedMap &map, const VisibleBounds &base_bounds,
+               int current_floor, const Services::ViewSettings *settings);
+
+  /**
+   * Get a floor prepared by the last prepare() call.
+   * @return Prepared floor, or nullptr if the floor was not prepared
+   */
+  const PreparedFloor *getFloor(int floor_z) const;
+
+  /**
+   * Get a ghost floor prepared by the last prepare() call. Only visibility
+   * is gathered for ghost floors; they use the current floor's bounds.
+   * @return Prepared ghost floor, or nullptr if it was not prepared
+   */
+  const PreparedFloor *getGhostFloor(int floor_z) const;
+
+private:
+  static constexpr int FLOOR_COUNT =
+      Config::Map::MAX_FLOOR - Config::Map::MIN_FLOOR + 1;
+
+  std::array<PreparedFloor, FLOOR_COUNT> floors_;
+  std::array<PreparedFloor, 2> ghost_floors_; // Higher, lower
+  FrameJobGraph graph_;
+  OverlayChunkIndex waypoint_index_; // Refreshed before the jobs read it
+  std::unique_ptr<WorkerPool> workers_; // Created on first parallel frame
+};
+
+} // namespace Rendering
+} // namespace MapEditor
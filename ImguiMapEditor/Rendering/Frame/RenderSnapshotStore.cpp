@@ -0,0 +1,103 @@
+#include "Rendering/Frame/RenderSnapshotStore.h"
+#include "Domain/ChunkedMap.h"
+#include <algorithm>
+
+namespace MapEditor {
+namespace Rendering {
+
+RenderSnapshotStore::RenderSnapshotStore() { clear(); }
+
+RenderSnapshotStore::~RenderSnapshotStore() = default;
+
+RenderSnapshotStore::SnapshotPtr
+RenderSnapshotStore::update(const Domain::Chunk &chunk, int8_t z) {
+  const int32_t chunk_x = chunk.world_x / Domain::Chunk::SIZE;
+  const int32_t chunk_y = chunk.world_y / Domain::Chunk::SIZE;
+  const uint64_t key = makeKey(chunk_x, chunk_y, z);
+  const size_t shard = shardOf(key);
+
+  auto [it, inserted] = entries_[shard].try_emplace(key);
+  Entry &entry = it->second;
+  entry.last_used = publish_count_;
+  entry_count_ += inserted ? 1 : 0;
+
+  // Revisions are unique map-wide, so a replaced chunk never matches
+  if (!entry.snapshot || entry.snapshot->revision != chunk.getRevision()) {
+    entry.snapshot = ChunkRenderSnapshot::build(chunk, z);
+    dirty_shards_ |= uint64_t{1} << shard;
+  }
+  return entry.snapshot;
+}
+
+void RenderSnapshotStore::publish() {
+  ++publish_count_;
+  if (entry_count_ > Config::Performance::RENDER_SNAPSHOT_LIMIT) {
+    // Trim an eighth below the limit so eviction runs every few hundred
+    // new chunks instead of on every publish
+    evictOldest(entry_count_ - Config::Performance::RENDER_SNAPSHOT_LIMIT +
+                Config::Performance::RENDER_SNAPSHOT_LIMIT / 8);
+  }
+  if (dirty_shards_ == 0) {
+    return;
+  }
+
+  // Copy-on-publish per shard: unchanged shards are shared with the
+  // previous index, and readers holding it are unaffected
+  auto index = std::make_shared<Index>(*published_.load());
+  for (size_t shard = 0; shard < SHARD_COUNT; ++shard) {
+    if (!(dirty_shards_ & (uint64_t{1} << shard))) {
+      continue;
+    }
+    auto copy = std::make_shared<Shard>();
+    copy->reserve(entries_[shard].size());
+    for (const auto &[key, entry] : entries_[shard]) {
+      copy->emplace(key, entry.snapshot);
+    }
+    index->shards[shard] = std::move(copy);
+  }
+  published_.store(std::move(index), std::memory_order_release);
+  dirty_shards_ = 0;
+}
+
+void RenderSnapshotStore::clear() {
+  for (auto &shard : entries_) {
+    shard.clear();
+  }
+  entry_count_ = 0;
+  dirty_shards_ = 0;
+
+  auto index = std::make_shared<Index>();
+  auto empty = std::make_shared<const Shard>();
+  index->shards.fill(empty);
+  published_.store(std::move(index), std::memory_order_release);
+}
+
+RenderSnapshotStore::SnapshotPtr
+RenderSnapshotStore::find(const Index &index, int32_t chunk_x, int32_t chunk_y,
+                          int8_t z) {
+  const uint64_t key = makeKey(chunk_x, chunk_y, z);
+  const Shard &shard = *index.shards[shardOf(key)];
+  auto it = shard.find(key);
+  return it != shard.end() ? it->second : nullptr;
+}
+
+void RenderSnapshotStore::evictOldest(size_t count) {
+  std::vector<std::pair<uint32_t, uint64_t>> ages;
+  ages.reserve(entry_count_);
+  for (const auto &shard : entries_) {
+    for (const auto &[key, entry] : shard) {
+      ages.emplace_back(entry.last_used, key);
+    }
+  }
+  count = std::min(count, ages.size());
+  std::nth_element(ages.begin(), ages.begin() + count, ages.end());
+  for (size_t i = 0; i < count; ++i) {
+    const size_t shard = shardOf(ages[i].second);
+    entries_[shard].erase(ages[i].second);
+    dirty_shards_ |= uint64_t{1} << shard;
+  }
+  entry_count_ -= count;
+}
+
+} // namespace Rendering
+} // namespace MapEditor
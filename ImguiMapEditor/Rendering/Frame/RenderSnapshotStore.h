@@ -0,0 +1,128 @@
+#pragma once
+#include "Core/Config.h"
+#include "Domain/ChunkSnapshot.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MapEditor {
+
+namespace Domain {
+class Chunk;
+}
+
+namespace Rendering {
+
+// Snapshots are a domain type so non-rendering readers (map search) can use
+// them without depending on the renderer
+using ChunkRenderSnapshot = Domain::ChunkSnapshot;
+
+/**
+ * Versioned per-chunk render snapshots, double-buffered between the editor
+ * (writer) and readers on any thread.
+ *
+ * The owning (GL/editor) thread refreshes snapshots with update(), which
+ * rebuilds one only when its chunk revision changed, and makes the new set
+ * visible with publish(). Readers take the published index with acquire()
+ * and keep using it, and every snapshot in it, for as long as they hold the
+ * pointer, while the live map keeps changing. Neither side locks.
+ *
+ * The index is split into SHARD_COUNT immutable shards. publish() copies
+ * only the shards that changed and shares the rest with the previous index,
+ * so an edit costs one shard rebuild rather than a copy of every entry.
+ *
+ * Usage:
+ *   // Editor thread
+ *   auto snapshot = store.update(chunk, z);
+ *   store.publish();
+ *   // Any thread
+ *   auto index = store.acquire();
+ *   auto snapshot = RenderSnapshotStore::find(*index, chunk_x, chunk_y, z);
+ */
+class RenderSnapshotStore {
+public:
+  using SnapshotPtr = std::shared_ptr<const ChunkRenderSnapshot>;
+
+  static constexpr size_t SHARD_COUNT = 64;
+  using Shard = std::unordered_map<uint64_t, SnapshotPtr>;
+  struct Index {
+    std::array<std::shared_ptr<const Shard>, SHARD_COUNT> shards;
+  };
+
+  RenderSnapshotStore();
+  ~RenderSnapshotStore();
+
+  // Non-copyable, non-movable (atomic published index)
+  RenderSnapshotStore(const RenderSnapshotStore &) = delete;
+  RenderSnapshotStore &operator=(const RenderSnapshotStore &) = delete;
+
+  // === Writer (owning thread only) ===
+
+  /**
+   * Get the chunk's snapshot, rebuilding it if the chunk was edited since.
+   * The result is usable immediately; other threads see it after publish().
+   */
+  SnapshotPtr update(const Domain::Chunk &chunk, int8_t z);
+
+  /**
+   * Make all updates since the last publish visible to readers.
+   * Also drops the least recently updated snapshots once beyond the limit.
+   */
+  void publish();
+
+  /**
+   * Drop all snapshots (published readers keep theirs).
+   */
+  void clear();
+
+  // === Readers (any thread) ===
+
+  /**
+   * Get the last published index. Never null.
+   */
+  std::shared_ptr<const Index> acquire() const {
+    return published_.load(std::memory_order_acquire);
+  }
+
+  static SnapshotPtr find(const Index &index, int32_t chunk_x,
+                          int32_t chunk_y, int8_t z);
+
+  size_t getSnapshotCount() const { return entry_count_; }
+
+private:
+  struct Entry {
+    SnapshotPtr snapshot;
+    uint32_t last_used = 0;
+  };
+
+  static uint64_t makeKey(int32_t chunk_x, int32_t chunk_y, int8_t floor) {
+    // Same packing as ChunkSpriteCache: 24 bits x, 24 bits y, 8 bits floor
+    uint64_t key = 0;
+    key |= (static_cast<uint64_t>(chunk_x + 0x800000) & 0xFFFFFF) << 32;
+    key |= (static_cast<uint64_t>(chunk_y + 0x800000) & 0xFFFFFF) << 8;
+    key |= static_cast<uint64_t>(floor & 0xFF);
+    return key;
+  }
+
+  static size_t shardOf(uint64_t key) {
+    // Fibonacci hash; neighbouring chunks land in different shards
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 58);
+  }
+
+  void evictOldest(size_t count);
+
+  // Writer's working set, sharded like the published index
+  std::array<std::unordered_map<uint64_t, Entry>, SHARD_COUNT> entries_;
+  size_t entry_count_ = 0;
+  uint64_t dirty_shards_ = 0; // Bit per shard changed since publish()
+
+  std::atomic<std::shared_ptr<const Index>> published_;
+  uint32_t publish_count_ = 1;
+};
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -3,7 +3,8 @@
 
 namespace MapEditor::Rendering {
 
-RenderState::RenderState(Services::ClientDataService* client_data) {
+RenderState::RenderState(Services::ClientDataService* client_data)
+    : snapshots(std::make_unique<RenderSnapshotStore>()) {
     light_manager = std::make_unique<LightManager>(client_data);
     if (!light_manager->initialize()) {
         spdlog::warn("Failed to initialize LightManager for RenderState");
@@ -14,6 +15,9 @@ RenderState::~RenderState() = default;
 
 void RenderState::invalidateAll() {
     chunk_cache.invalidateAll();
+    if (snapshots) {
+        snapshots->clear();
+    }
     if (light_manager) {
         light_manager->invalidateAll();
     }
@@ -22,6 +26,7 @@ void RenderState::invalidateAll() {
 
 void RenderState::invalidateChunk(int32_t chunk_x, int32_t chunk_y, int8_t floor) {
     chunk_cache.invalidate(chunk_x, chunk_y, floor);
+    impostor_cache.invalidate(chunk_x, chunk_y, floor);
 }
 
 void RenderState::invalidateLight(int32_t x, int32_t y) {
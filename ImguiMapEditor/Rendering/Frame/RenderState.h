@@ -1,6 +1,8 @@
 #pragma once
+#include "Rendering/Frame/RenderSnapshotStore.h"
 #include "Rendering/Light/LightManager.h"
 #include "Rendering/Overlays/OverlayCollector.h"
+#include "Rendering/Tile/ChunkImpostorCache.h"
 #include "Rendering/Tile/ChunkSpriteCache.h"
 #include <memory>
 
@@ -36,6 +38,12 @@ public:
   // === Per-session chunk cache ===
   ChunkSpriteCache chunk_cache;
 
+  // === Per-session far-zoom chunk impostors ===
+  ChunkImpostorCache impostor_cache;
+
+  // === Per-session immutable chunk snapshots (readable off-thread) ===
+  std::unique_ptr<RenderSnapshotStore> snapshots;
+
   // === Per-session lighting ===
   std::unique_ptr<LightManager> light_manager;
 
@@ -10,13 +10,21 @@ namespace Services {
     class ClientDataService;
 }
 
+namespace Domain {
+    struct ChunkSnapshot;
+}
+
 namespace Rendering {
 
+class RenderSnapshotStore;
+using ChunkRenderSnapshot = Domain::ChunkSnapshot;
+
 /**
  * Collects light sources from visible tiles.
  * 
  * Single responsibility: iterate chunks/tiles and extract
  * light data from items that have light properties.
+ * Tiles are read from the chunks' render snapshots, not the live map.
  */
 class LightGatherer {
 public:
@@ -31,6 +39,7 @@ public:
      */
     void gatherForChunk(
         const MapEditor::Domain::ChunkedMap& map,
+        RenderSnapshotStore& snapshots,
         int32_t chunk_x, int32_t chunk_y,
         Services::ClientDataService* client_data,
         int16_t floor);
@@ -40,6 +49,7 @@ public:
      * Applies isometric offset to light positions based on floor difference.
      * 
      * @param map The map to gather lights from
+     * @param snapshots Render snapshots, refreshed for the chunks read
      * @param chunk_x Chunk X coordinate
      * @param chunk_y Chunk Y coordinate
      * @param client_data Client data service for item type lookup
@@ -48,6 +58,7 @@ public:
      */
     void gatherForChunkMultiFloor(
         const MapEditor::Domain::ChunkedMap& map,
+        RenderSnapshotStore& snapshots,
         int32_t chunk_x, int32_t chunk_y,
         Services::ClientDataService* client_data,
         int16_t start_floor,
@@ -69,10 +80,19 @@ private:
      */
     void gatherLightsFromNeighborChunk(
         const MapEditor::Domain::ChunkedMap& map,
+        RenderSnapshotStore& snapshots,
         int32_t target_cx, int32_t target_cy,
         Services::ClientDataService* client_data,
         int16_t floor, int32_t floor_offset);
 
+    /**
+     * Add the lights of one snapshot, shifted by floor_offset tiles.
+     */
+    void gatherFromSnapshot(
+        const ChunkRenderSnapshot& snapshot,
+        Services::ClientDataService* client_data,
+        int32_t floor_offset);
+
     std::vector<MapEditor::Domain::LightSource> lights_;
 };
 
@@ -63,6 +63,7 @@ void LightManager::invalidateAll() {
 }
 
 void LightManager::render(const Domain::ChunkedMap& map,
+                          RenderSnapshotStore& snapshots,
                           int viewport_width, int viewport_height,
                           float camera_x, float camera_y, 
                           float zoom, int current_floor,
@@ -153,12 +154,12 @@ void LightManager::render(const Domain::ChunkedMap& map,
                 // Use multi-floor gathering if we have a floor range
                 if (start_floor != end_floor) {
                     gatherer_->gatherForChunkMultiFloor(
-                        map, cx, cy, client_data_,
+                        map, snapshots, cx, cy, client_data_,
                         static_cast<int16_t>(start_floor),
                         static_cast<int16_t>(end_floor));
                 } else {
                     // Single floor mode
-                    gatherer_->gatherForChunk(map, cx, cy, client_data_, static_cast<int16_t>(current_floor));
+                    gatherer_->gatherForChunk(map, snapshots, cx, cy, client_data_, static_cast<int16_t>(current_floor));
                 }
                 
                 computeChunkLight(grid, gatherer_->getLights(), config, cx, cy);
@@ -29,11 +29,13 @@ public:
     /**
      * Render the light overlay for the current viewport.
      * 
+     * @param snapshots Render snapshots lights are gathered from
      * @param start_floor First floor to gather lights from (highest Z)
      * @param end_floor Last floor to gather lights from (lowest Z)
      *                  When start_floor == end_floor, only that floor is used
      */
     void render(const MapEditor::Domain::ChunkedMap& map,
+                RenderSnapshotStore& snapshots,
                 int viewport_width, int viewport_height,
                 float camera_x, float camera_y, 
                 float zoom, int current_floor,
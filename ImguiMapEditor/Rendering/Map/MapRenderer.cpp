@@ -109,6 +109,9 @@ void MapRenderer::render(const Domain::ChunkedMap &map, RenderState &state,
   frame_data_collector_.beginFrame();
   state.overlay_collector.clear();
 
+  // Gather per-floor visibility and overlays on the worker pool
+  frame_preparer_.prepare(map, base_bounds, camera_.getFloor(), view_settings_);
+
   // Calculate MVP matrix
   const glm::mat4 &view_matrix = camera_.getViewMatrix();
   glm::mat4 mvp = render_target_.getProjection() * view_matrix;
@@ -131,7 +134,8 @@ void MapRenderer::render(const Domain::ChunkedMap &map, RenderState &state,
       base_bounds,                                    // Visible bounds
       camera_.getFloor(),                             // Current floor
       frame_data_collector_.getMissingSpriteBuffer(), // Missing sprites buffer
-      view_settings_};                                // View settings
+      view_settings_,                                 // View settings
+      &frame_preparer_};                              // Prepared floors
 
   // Execute Pipeline
   render_pipeline_.render(context);
@@ -139,6 +143,11 @@ void MapRenderer::render(const Domain::ChunkedMap &map, RenderState &state,
   // End frame and cleanup
   frame_data_collector_.endFrame(sprite_manager_);
 
+  // Hand this frame's chunk snapshots to off-thread readers
+  if (state.snapshots) {
+    state.snapshots->publish();
+  }
+
   // Note: sprite_batch_->end() called by individual passes if they used it.
 
   last_draw_calls_ = sprite_batch_->getDrawCallCount();
@@ -10,6 +10,7 @@
 #include "Rendering/Core/RenderTarget.h"
 #include "Rendering/Core/Shader.h"
 #include "Rendering/Frame/FrameDataCollector.h"
+#include "Rendering/Frame/FramePreparer.h"
 #include "Rendering/Frame/RenderState.h"
 #include "Rendering/Map/TileRenderer.h"
 #include "Rendering/Overlays/OverlayCollector.h"
@@ -165,6 +166,7 @@ private:
   // Reusable buffer for missing sprites (avoids per-frame allocation)
   // Frame data collection (manages missing sprites and overlay collection)
   FrameDataCollector frame_data_collector_;
+  FramePreparer frame_preparer_;
 
   // Chunk visibility manager (handles culling and screen position calculation)
   // Shared with TerrainPass and GhostFloorPass
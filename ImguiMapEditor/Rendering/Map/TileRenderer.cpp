@@ -345,11 +345,12 @@ void TileRenderer::queueTileToTileCache(const Domain::Tile &tile,
                                         const AnimationTicks &anim_ticks,
                                         std::vector<uint32_t> &missing_sprites,
                                         std::vector<TileInstance> &output_tiles,
+                                        float origin_x, float origin_y,
                                         float alpha) {
   // Delegate to explicit coordinate version
   queueTileToTileCache(tile, tile.getX(), tile.getY(), tile.getZ(), screen_x,
                        screen_y, anim_ticks, missing_sprites, output_tiles,
-                       alpha);
+                       origin_x, origin_y, alpha);
 }
 
 void TileRenderer::queueTileToTileCache(const Domain::Tile &tile, int tile_x,
@@ -358,9 +359,10 @@ void TileRenderer::queueTileToTileCache(const Domain::Tile &tile, int tile_x,
                                         const AnimationTicks &anim_ticks,
                                         std::vector<uint32_t> &missing_sprites,
                                         std::vector<TileInstance> &output_tiles,
+                                        float origin_x, float origin_y,
                                         float alpha) {
   // Set output redirection to TileInstance vectors
-  emitter_.setTileCache(&output_tiles);
+  emitter_.setTileCache(&output_tiles, origin_x, origin_y);
 
   // Always use full rendering (no LOD - caching replaces LOD)
   queueTile(tile, tile_x, tile_y, tile_z, screen_x, screen_y, 1.0f, anim_ticks,
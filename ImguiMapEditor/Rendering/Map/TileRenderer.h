@@ -130,11 +130,14 @@ public:
   /**
    * ID-based cache generation (new architecture).
    * Outputs TileInstance with sprite_id for GPU-side UV lookup.
+   * Instance positions are stored relative to origin_x/origin_y (the chunk
+   * origin), which must be passed back when drawing.
    */
   void queueTileToTileCache(const Domain::Tile &tile, float screen_x,
                             float screen_y, const AnimationTicks &anim_ticks,
                             std::vector<uint32_t> &missing_sprites,
                             std::vector<TileInstance> &output_tiles,
+                            float origin_x, float origin_y,
                             float alpha = 1.0f);
 
   void queueTileToTileCache(const Domain::Tile &tile, int tile_x, int tile_y,
@@ -142,6 +145,7 @@ public:
                             const AnimationTicks &anim_ticks,
                             std::vector<uint32_t> &missing_sprites,
                             std::vector<TileInstance> &output_tiles,
+                            float origin_x, float origin_y,
                             float alpha = 1.0f);
 
   /**
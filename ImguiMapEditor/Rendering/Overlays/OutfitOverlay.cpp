@@ -136,7 +136,7 @@ bool OutfitOverlay::render(ImDrawList *draw_list, const Domain::Outfit &outfit,
 
 void OutfitOverlay::renderName(ImDrawList *draw_list, const std::string &name,
                                const glm::vec2 &center, float sprite_height,
-                               float zoom) {
+                               float zoom, OverlayTextCache *text_cache) {
   if (!draw_list || name.empty())
     return;
 
@@ -145,7 +145,11 @@ void OutfitOverlay::renderName(ImDrawList *draw_list, const std::string &name,
 
   // Zoom check removed - controlled by caller (SpawnLabelOverlay + LOD Policy)
 
-  ImVec2 text_size = ImGui::CalcTextSize(name.c_str());
+  OverlayTextCache::Label *label =
+      text_cache ? &text_cache->get(nullptr, ImGui::GetFontSize(), name,
+                                    Config::Colors::SPAWN_TEXT)
+                 : nullptr;
+  ImVec2 text_size = label ? label->size : ImGui::CalcTextSize(name.c_str());
 
   // Position above the sprite
   ImVec2 text_pos(center.x - text_size.x / 2.0f,
@@ -161,7 +165,11 @@ void OutfitOverlay::renderName(ImDrawList *draw_list, const std::string &name,
   );
 
   // Draw text
-  draw_list->AddText(text_pos, Config::Colors::SPAWN_TEXT, name.c_str());
+  if (label) {
+    text_cache->draw(draw_list, *label, text_pos);
+  } else {
+    draw_list->AddText(text_pos, Config::Colors::SPAWN_TEXT, name.c_str());
+  }
 }
 
 } // namespace Rendering
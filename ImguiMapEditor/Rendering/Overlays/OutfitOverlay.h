@@ -2,6 +2,7 @@
 #include "../../Core/Config.h"
 #include "Domain/Outfit.h"
 #include "OverlaySpriteCache.h"
+#include "OverlayTextCache.h"
 #include "Services/ClientDataService.h"
 #include "Services/SpriteManager.h"
 #include "Utils/SpriteUtils.h"
@@ -47,9 +48,11 @@ public:
 
   /**
    * Render creature name label above sprite.
+   * @param text_cache Reuses the laid-out name when given
    */
   void renderName(ImDrawList *draw_list, const std::string &name,
-                  const glm::vec2 &center, float sprite_height, float zoom);
+                  const glm::vec2 &center, float sprite_height, float zoom,
+                  OverlayTextCache *text_cache = nullptr);
 
 private:
   static constexpr float TILE_SIZE = Config::Rendering::TILE_SIZE;
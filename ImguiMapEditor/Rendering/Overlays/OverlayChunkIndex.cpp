@@ -0,0 +1,26 @@
+#include "OverlayChunkIndex.h"
+
+namespace MapEditor {
+namespace Rendering {
+
+void OverlayChunkIndex::refresh(const Domain::ChunkedMap &map) {
+  const auto &waypoints = map.getWaypoints();
+  if (map_ == &map && map_revision_ == map.getRevision() &&
+      waypoint_count_ == waypoints.size()) {
+    return;
+  }
+  map_ = &map;
+  map_revision_ = map.getRevision();
+  waypoint_count_ = waypoints.size();
+
+  waypoint_chunks_.clear();
+  for (size_t i = 0; i < waypoints.size(); ++i) {
+    const Domain::Position &pos = waypoints[i].position;
+    waypoint_chunks_[makeKey(pos.x >> CHUNK_SHIFT, pos.y >> CHUNK_SHIFT,
+                             pos.z)]
+        .push_back(static_cast<uint32_t>(i));
+  }
+}
+
+} // namespace Rendering
+} // namespace MapEditor
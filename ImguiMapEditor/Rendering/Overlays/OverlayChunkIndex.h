@@ -0,0 +1,95 @@
+#pragma once
+#include "Domain/ChunkedMap.h"
+#include "Rendering/Visibility/VisibleBounds.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace MapEditor {
+namespace Rendering {
+
+/**
+ * Per-chunk index of map-level overlay entities (waypoints).
+ *
+ * Waypoints live in one map-wide list, so collecting the visible ones used
+ * to scan every waypoint for every floor each frame. The index buckets them
+ * by (chunk, floor) and is rebuilt only when the map, its metadata revision
+ * or the waypoint count changes.
+ *
+ * refresh() must run before worker threads read the index; lookups are
+ * const and safe to run concurrently.
+ */
+class OverlayChunkIndex {
+public:
+  /**
+   * Rebuild the index if the map's waypoints may have changed.
+   */
+  void refresh(const Domain::ChunkedMap &map);
+
+  /**
+   * Call fn(const Waypoint &) for each waypoint on floor_z within bounds.
+   */
+  template <typename Fn>
+  void forEachWaypoint(const Domain::ChunkedMap &map, int floor_z,
+                       const VisibleBounds &bounds, Fn &&fn) const {
+    const auto &waypoints = map.getWaypoints();
+    auto visit = [&](const std::vector<uint32_t> &indices) {
+      for (uint32_t index : indices) {
+        if (index >= waypoints.size()) {
+          continue;
+        }
+        const auto &wp = waypoints[index];
+        if (wp.position.z == floor_z && wp.position.x >= bounds.start_x &&
+            wp.position.x < bounds.end_x && wp.position.y >= bounds.start_y &&
+            wp.position.y < bounds.end_y) {
+          fn(wp);
+        }
+      }
+    };
+
+    const int32_t chunk_x0 = bounds.start_x >> CHUNK_SHIFT;
+    const int32_t chunk_y0 = bounds.start_y >> CHUNK_SHIFT;
+    const int32_t chunk_x1 = (bounds.end_x - 1) >> CHUNK_SHIFT;
+    const int32_t chunk_y1 = (bounds.end_y - 1) >> CHUNK_SHIFT;
+    const int64_t area = static_cast<int64_t>(chunk_x1 - chunk_x0 + 1) *
+                         (chunk_y1 - chunk_y0 + 1);
+
+    // Zoomed far out, walking the populated buckets is cheaper
+    if (area > static_cast<int64_t>(waypoint_chunks_.size())) {
+      for (const auto &[key, indices] : waypoint_chunks_) {
+        visit(indices);
+      }
+      return;
+    }
+    for (int32_t cy = chunk_y0; cy <= chunk_y1; ++cy) {
+      for (int32_t cx = chunk_x0; cx <= chunk_x1; ++cx) {
+        auto it = waypoint_chunks_.find(makeKey(cx, cy, floor_z));
+        if (it != waypoint_chunks_.end()) {
+          visit(it->second);
+        }
+      }
+    }
+  }
+
+private:
+  static constexpr int CHUNK_SHIFT = 5; // Domain::Chunk::SIZE == 32
+
+  static uint64_t makeKey(int32_t chunk_x, int32_t chunk_y, int floor) {
+    // Same packing as ChunkSpriteCache: 24 bits x, 24 bits y, 8 bits floor
+    uint64_t key = 0;
+    key |= (static_cast<uint64_t>(chunk_x + 0x800000) & 0xFFFFFF) << 32;
+    key |= (static_cast<uint64_t>(chunk_y + 0x800000) & 0xFFFFFF) << 8;
+    key |= static_cast<uint64_t>(floor & 0xFF);
+    return key;
+  }
+
+  // Indices into ChunkedMap::getWaypoints() per (chunk, floor)
+  std::unordered_map<uint64_t, std::vector<uint32_t>> waypoint_chunks_;
+
+  const Domain::ChunkedMap *map_ = nullptr;
+  uint32_t map_revision_ = 0;
+  size_t waypoint_count_ = 0;
+};
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -57,6 +57,22 @@ struct OverlayCollector {
     spatial_grid.clear();
   }
 
+  /**
+   * Append another collector's entries (e.g. one filled on a worker thread).
+   * Spawn radii are re-added so the spatial grid indices stay valid.
+   */
+  void merge(const OverlayCollector &other) {
+    tooltips.insert(tooltips.end(), other.tooltips.begin(),
+                    other.tooltips.end());
+    spawns.insert(spawns.end(), other.spawns.begin(), other.spawns.end());
+    waypoints.insert(waypoints.end(), other.waypoints.begin(),
+                     other.waypoints.end());
+    for (const SpawnRadiusEntry &spawn : other.spawn_radii) {
+      addSpawnRadius(spawn.center_x, spawn.center_y, spawn.floor, spawn.radius,
+                     spawn.creature_count);
+    }
+  }
+
   /**
    * Check if a tile position is within any spawn's radius.
    * OPTIMIZED: Uses spatial grid to check only nearby spawns.
@@ -68,6 +68,11 @@ void OverlayManager::bindSelectionService(
 
   bound_selection_service_ = service;
 
+  // Cached selection geometry belongs to the previous service
+  if (selection_overlay_) {
+    selection_overlay_->onSelectionCleared();
+  }
+
   // Register with new service
   if (service && selection_overlay_) {
     service->addObserver(selection_overlay_.get());
@@ -30,6 +30,8 @@ void OverlayRenderer::render(
   bool skip_detailed_overlays =
       (zoom <= Config::Performance::OVERLAY_ZOOM_THRESHOLD);
 
+  text_cache_.beginFrame();
+
   ImDrawList *draw_list = ImGui::GetWindowDrawList();
   draw_list->PushClipRect(ImVec2(viewport_pos.x, viewport_pos.y),
                           ImVec2(viewport_pos.x + viewport_size.x,
@@ -45,19 +47,20 @@ void OverlayRenderer::render(
       spawn_renderer_.renderFromCollector(
           draw_list, collector, map, client_data, sprite_manager, overlay_cache,
           simulator, settings, settings.show_spawns, settings.show_creatures,
-          camera_pos, viewport_pos, viewport_size, current_floor, zoom);
+          camera_pos, viewport_pos, viewport_size, current_floor, zoom,
+          text_cache_);
     }
 
     if (settings.show_waypoints && !skip_detailed_overlays) {
       waypoint_renderer_.renderFromCollector(draw_list, collector->waypoints,
                                              camera_pos, viewport_pos,
-                                             viewport_size, zoom);
+                                             viewport_size, zoom, text_cache_);
     }
 
     if (settings.show_tooltips && !skip_detailed_overlays) {
       tooltip_renderer_.renderFromCollector(draw_list, collector->tooltips,
-                                            camera_pos, viewport_pos,
-                                            viewport_size, zoom);
+                                            map, camera_pos, viewport_pos,
+                                            viewport_size, zoom, text_cache_);
     }
 
     // NOTE: Invalid items are now rendered inline in TileRenderer for proper
@@ -4,6 +4,7 @@
 #include "IOverlayRenderer.h"
 #include "OverlayCollector.h"
 #include "OverlaySpriteCache.h"
+#include "OverlayTextCache.h"
 #include "Services/ClientDataService.h"
 #include "Services/CreatureSimulator.h"
 #include "Services/SpriteManager.h"
@@ -61,6 +62,7 @@ private:
   SpawnLabelOverlay spawn_renderer_;
   WaypointOverlay waypoint_renderer_;
   TooltipOverlay tooltip_renderer_;
+  OverlayTextCache text_cache_; // Laid-out labels shared by sub-renderers
   // ItemPreviewRenderer removed - now using unified PreviewRenderer
 
   // Cached state for coordinate transforms
@@ -0,0 +1,90 @@
+#include "OverlayTextCache.h"
+#include <bit>
+#include <cfloat>
+#include <functional>
+
+namespace MapEditor {
+namespace Rendering {
+
+void OverlayTextCache::beginFrame() {
+  ++frame_;
+
+  if (labels_.size() > Config::Performance::OVERLAY_TEXT_CACHE_LIMIT) {
+    for (auto it = labels_.begin(); it != labels_.end();) {
+      // Keep labels drawn last frame; they are likely needed again
+      if (frame_ - it->second.last_used > 1) {
+        it = labels_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+OverlayTextCache::Label &OverlayTextCache::get(ImFont *font, float font_size,
+                                               std::string_view text,
+                                               ImU32 color, float wrap_width) {
+  if (!font) {
+    font = ImGui::GetFont();
+  }
+  if (font_size <= 0.0f) {
+    font_size = ImGui::GetFontSize();
+  }
+
+  Label &label =
+      labels_[makeKey(font, font_size, text, color, wrap_width)];
+  label.last_used = frame_;
+  if (label.font == font && label.font_size == font_size &&
+      label.wrap_width == wrap_width && label.color == color &&
+      label.text == text) {
+    return label;
+  }
+
+  // New label (or a hash collision): measure again
+  label.text.assign(text);
+  label.font = font;
+  label.font_size = font_size;
+  label.wrap_width = wrap_width;
+  label.color = color;
+  const char *begin = label.text.data();
+  label.size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, begin,
+                                   begin + label.text.size());
+  // Round width up like ImGui::CalcTextSize
+  label.size.x = std::floor(label.size.x + 0.99999f);
+  return label;
+}
+
+void OverlayTextCache::draw(ImDrawList *draw_list, const Label &label,
+                            const ImVec2 &pos) {
+  if (!draw_list || label.text.empty()) {
+    return;
+  }
+
+  const ImVec2 clip_min = draw_list->GetClipRectMin();
+  const ImVec2 clip_max = draw_list->GetClipRectMax();
+  if (pos.x + label.size.x < clip_min.x || pos.y + label.size.y < clip_min.y ||
+      pos.x > clip_max.x || pos.y > clip_max.y) {
+    return;
+  }
+
+  const char *begin = label.text.data();
+  draw_list->AddText(label.font, label.font_size, pos, label.color, begin,
+                     begin + label.text.size(), label.wrap_width);
+}
+
+uint64_t OverlayTextCache::makeKey(const ImFont *font, float font_size,
+                                   std::string_view text, ImU32 color,
+                                   float wrap_width) {
+  uint64_t key = std::hash<std::string_view>{}(text);
+  auto mix = [&key](uint64_t value) {
+    key ^= value + 0x9E3779B97F4A7C15ull + (key << 6) + (key >> 2);
+  };
+  mix(reinterpret_cast<uintptr_t>(font));
+  mix(std::bit_cast<uint32_t>(font_size));
+  mix(std::bit_cast<uint32_t>(wrap_width));
+  mix(color);
+  return key;
+}
+
+} // namespace Rendering
+} // namespace MapEditor
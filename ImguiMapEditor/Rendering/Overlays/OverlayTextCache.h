@@ -0,0 +1,81 @@
+#pragma once
+#include "../../Core/Config.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <imgui.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace MapEditor {
+namespace Rendering {
+
+/**
+ * Measured text for map overlay labels.
+ *
+ * A label is measured once per (text, font, size, wrap width, color), so
+ * placing its background no longer calls CalcTextSize every frame. Drawing
+ * goes through AddText, which keeps glyph baking and atlas bookkeeping in
+ * ImGui's hands; labels outside the clip rect are skipped.
+ *
+ * Labels not used for a while are trimmed above OVERLAY_TEXT_CACHE_LIMIT.
+ *
+ * Usage per frame:
+ *   cache.beginFrame();
+ *   Label &label = cache.get(font, size, text, color);
+ *   ... place background using label.size ...
+ *   cache.draw(draw_list, label, pos);
+ */
+class OverlayTextCache {
+public:
+  struct Label {
+    std::string text;
+    ImFont *font = nullptr;
+    float font_size = 0.0f;
+    float wrap_width = 0.0f;
+    ImU32 color = 0;
+    ImVec2 size;
+    uint32_t last_used = 0;
+  };
+
+  /**
+   * Snap a font scale to the cache's zoom buckets, so smooth zooming reuses
+   * labels instead of laying them out at every intermediate scale.
+   */
+  static float bucketScale(float scale) {
+    constexpr float steps = Config::Performance::OVERLAY_TEXT_SCALE_STEPS;
+    return std::max(1.0f, std::round(scale * steps)) / steps;
+  }
+
+  /**
+   * Advance the frame counter and trim unused labels over the limit.
+   */
+  void beginFrame();
+
+  /**
+   * Get a measured label, creating it on first use.
+   * @param font_size Pixel size (0 = current font size)
+   * @param wrap_width Wrap width in pixels (0 = no wrapping)
+   */
+  Label &get(ImFont *font, float font_size, std::string_view text,
+             ImU32 color, float wrap_width = 0.0f);
+
+  /**
+   * Draw a label with its top-left corner at pos.
+   */
+  void draw(ImDrawList *draw_list, const Label &label, const ImVec2 &pos);
+
+  size_t getLabelCount() const { return labels_.size(); }
+
+private:
+  static uint64_t makeKey(const ImFont *font, float font_size,
+                          std::string_view text, ImU32 color,
+                          float wrap_width);
+
+  std::unordered_map<uint64_t, Label> labels_;
+  uint32_t frame_ = 0;
+};
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -1,11 +1,12 @@
 #include "SelectionOverlay.h"
 #include "Core/Config.h"
+#include "Domain/Selection/SelectionChunk.h"
 #include "Domain/Selection/SelectionEntry.h"
 #include "Rendering/Selection/ISelectionDataProvider.h"
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <string>
-#include <unordered_set>
 
 namespace MapEditor {
 namespace Rendering {
@@ -20,22 +21,8 @@ void SelectionOverlay::render(ImDrawList *draw_list,
   int current_floor = camera.getCurrentFloor();
   float tile_screen_size = Config::Rendering::TILE_SIZE * camera.getZoom();
 
-  // Heuristic: Choose the iteration strategy with fewer steps.
-  // 1. Iterative: Costs O(SelectionSize) to filter by floor.
-  // 2. Viewport: Costs O(VisibleTiles) to query the hash map.
-  // We calculate visible tiles dynamically to handle zoom levels correctly.
-  glm::vec2 vp_size = camera.getViewportSize();
-  float cols = vp_size.x / tile_screen_size;
-  float rows = vp_size.y / tile_screen_size;
-  size_t visible_tiles_count = static_cast<size_t>(cols * rows);
-
-  if (provider->getSelectionCount() > visible_tiles_count) {
-    renderSelectionViewport(draw_list, camera, provider, current_floor,
-                            tile_screen_size);
-  } else {
-    renderSelectionIterative(draw_list, camera, provider, current_floor,
-                             tile_screen_size);
-  }
+  renderSelectionChunks(draw_list, camera, provider, current_floor,
+                        tile_screen_size);
 }
 
 void SelectionOverlay::renderDragBox(ImDrawList *draw_list,
@@ -117,90 +104,98 @@ void SelectionOverlay::renderDragDimensions(ImDrawList *draw_list,
                      IM_COL32(255, 255, 255, 255), dim_text.c_str());
 }
 
-void SelectionOverlay::renderSelectionIterative(
+void SelectionOverlay::renderSelectionChunks(
     ImDrawList *draw_list, const UI::MapViewCamera &camera,
     const ISelectionDataProvider *provider, int floor, float tile_screen_size) {
+  using Domain::Selection::SelectionChunk;
+  using Domain::Selection::TileMask;
+
+  // Visible tile range, extended slightly to avoid clipping at edges
+  glm::vec2 vp_pos = camera.getViewportPos();
+  glm::vec2 vp_size = camera.getViewportSize();
+  Domain::Position top_left = camera.screenToTile(vp_pos);
+  Domain::Position bottom_right = camera.screenToTile(vp_pos + vp_size);
+
+  const int32_t start_x = top_left.x - 1;
+  const int32_t end_x = bottom_right.x + 1;
+  const int32_t start_y = top_left.y - 1;
+  const int32_t end_y = bottom_right.y + 1;
+
+  // Cost is O(selected chunks on floor) + O(visible selected spawns),
+  // independent of how many tiles the selection covers
+  provider->forEachChunkOnFloor(
+      static_cast<int16_t>(floor), [&](const SelectionChunk &chunk) {
+        const int32_t wx = chunk.worldX();
+        const int32_t wy = chunk.worldY();
+        if (wx > end_x || wx + SelectionChunk::SIZE - 1 < start_x ||
+            wy > end_y || wy + SelectionChunk::SIZE - 1 < start_y) {
+          return; // Chunk off-screen
+        }
 
-  // Check bounds for culling optimization
-  glm::vec2 vp_pos_vec = camera.getViewportPos();
-  glm::vec2 vp_size_vec = camera.getViewportSize();
-  ImVec2 viewport_pos(vp_pos_vec.x, vp_pos_vec.y);
-  ImVec2 viewport_size(vp_size_vec.x, vp_size_vec.y);
-
-  // Use interface callback to iterate entries on floor
-  provider->forEachEntryOnFloor(
-      static_cast<int16_t>(floor),
-      [&](const Domain::Position &pos, Domain::Selection::EntityType type) {
-        glm::vec2 screen_pos = camera.tileToScreen(pos);
-
-        // Simple Culling
-        if (screen_pos.x + tile_screen_size < viewport_pos.x ||
-            screen_pos.x > viewport_pos.x + viewport_size.x ||
-            screen_pos.y + tile_screen_size < viewport_pos.y ||
-            screen_pos.y > viewport_pos.y + viewport_size.y) {
-          return; // Skip off-screen entries
+        // Item and Ground tinting handled in TileRenderer - only spawns
+        // get an overlay rect
+        const std::vector<SpawnRun> &runs = getSpawnRuns(chunk);
+        if (runs.empty()) {
+          return;
         }
 
-        // Render based on entity type
-        if (type == Domain::Selection::EntityType::Spawn) {
-          // Cyan highlight for spawn
-          draw_list->AddRectFilled(ImVec2(screen_pos.x + 2, screen_pos.y + 2),
-                                   ImVec2(screen_pos.x + tile_screen_size - 2,
-                                          screen_pos.y + tile_screen_size - 2),
+        const int min_x = std::max(start_x - wx, 0);
+        const int max_x = std::min(end_x - wx, SelectionChunk::SIZE - 1);
+        const int min_y = std::max(start_y - wy, 0);
+        const int max_y = std::min(end_y - wy, SelectionChunk::SIZE - 1);
+        const glm::vec2 origin = camera.tileToScreen(
+            Domain::Position{wx, wy, static_cast<int16_t>(floor)});
+
+        for (const SpawnRun &run : runs) {
+          if (run.y < min_y || run.y > max_y || run.last_x < min_x ||
+              run.first_x > max_x) {
+            continue;
+          }
+          const int first_x = std::max<int>(run.first_x, min_x);
+          const int last_x = std::min<int>(run.last_x, max_x);
+
+          // Cyan highlight spanning the run
+          const float left = origin.x + first_x * tile_screen_size;
+          const float right = origin.x + (last_x + 1) * tile_screen_size;
+          const float top = origin.y + run.y * tile_screen_size;
+          const float bottom = top + tile_screen_size;
+          draw_list->AddRectFilled(ImVec2(left + 2, top + 2),
+                                   ImVec2(right - 2, bottom - 2),
                                    Config::Colors::TILE_SELECT_FILL);
-          draw_list->AddRect(ImVec2(screen_pos.x + 1, screen_pos.y + 1),
-                             ImVec2(screen_pos.x + tile_screen_size - 1,
-                                    screen_pos.y + tile_screen_size - 1),
+          draw_list->AddRect(ImVec2(left + 1, top + 1),
+                             ImVec2(right - 1, bottom - 1),
                              Config::Colors::TILE_SELECT_BORDER, 0.0f, 0, 2.0f);
         }
-        // Item and Ground tinting handled in TileRenderer - no overlay needed
       });
 }
 
-void SelectionOverlay::renderSelectionViewport(
-    ImDrawList *draw_list, const UI::MapViewCamera &camera,
-    const ISelectionDataProvider *provider, int floor, float tile_screen_size) {
+const std::vector<SelectionOverlay::SpawnRun> &SelectionOverlay::getSpawnRuns(
+    const Domain::Selection::SelectionChunk &chunk) {
+  auto [it, inserted] = spawn_runs_.try_emplace(
+      makeKey(chunk.chunk_x, chunk.chunk_y, chunk.z));
+  std::vector<SpawnRun> &runs = it->second;
+  if (!inserted) {
+    return runs;
+  }
 
-  // Calculate visible tile range
-  glm::vec2 vp_pos_vec = camera.getViewportPos();
-  glm::vec2 vp_size_vec = camera.getViewportSize();
-  ImVec2 viewport_pos(vp_pos_vec.x, vp_pos_vec.y);
-  ImVec2 viewport_size(vp_size_vec.x, vp_size_vec.y);
-
-  // Extend slightly to avoid clipping at edges
-  Domain::Position top_left =
-      camera.screenToTile(glm::vec2(viewport_pos.x, viewport_pos.y));
-  Domain::Position bottom_right = camera.screenToTile(glm::vec2(
-      viewport_pos.x + viewport_size.x, viewport_pos.y + viewport_size.y));
-
-  int start_x = top_left.x - 1;
-  int end_x = bottom_right.x + 1;
-  int start_y = top_left.y - 1;
-  int end_y = bottom_right.y + 1;
-
-  // Iterate visible tiles
-  for (int y = start_y; y <= end_y; ++y) {
-    for (int x = start_x; x <= end_x; ++x) {
-      Domain::Position pos(x, y, static_cast<int16_t>(floor));
-
-      // Fast O(1) check via interface
-      if (provider->hasSelectionAt(pos)) {
-        // Check for Spawn selection at this position
-        if (provider->hasSpawnSelectionAt(pos)) {
-          glm::vec2 screen_pos = camera.tileToScreen(pos);
-          draw_list->AddRectFilled(ImVec2(screen_pos.x + 2, screen_pos.y + 2),
-                                   ImVec2(screen_pos.x + tile_screen_size - 2,
-                                          screen_pos.y + tile_screen_size - 2),
-                                   Config::Colors::TILE_SELECT_FILL);
-          draw_list->AddRect(ImVec2(screen_pos.x + 1, screen_pos.y + 1),
-                             ImVec2(screen_pos.x + tile_screen_size - 1,
-                                    screen_pos.y + tile_screen_size - 1),
-                             Config::Colors::TILE_SELECT_BORDER, 0.0f, 0, 2.0f);
-        }
-        // Item/Ground tinting handled in TileRenderer
-      }
+  for (int y = 0; y < Domain::Selection::SelectionChunk::SIZE; ++y) {
+    uint64_t row = chunk.spawns.row(y);
+    while (row) {
+      const int first = std::countr_zero(row);
+      const int length = std::countr_one(row >> first);
+      runs.push_back({static_cast<uint8_t>(y), static_cast<uint8_t>(first),
+                      static_cast<uint8_t>(first + length - 1)});
+      // Clear the run (length may be 64 for a full 64-wide row)
+      row &= length >= 64 ? 0 : ~(((uint64_t{1} << length) - 1) << first);
     }
   }
+  return runs;
+}
+
+void SelectionOverlay::invalidateChunkAt(const Domain::Position &pos) {
+  using Domain::Selection::SelectionChunk;
+  spawn_runs_.erase(makeKey(pos.x >> SelectionChunk::SHIFT,
+                            pos.y >> SelectionChunk::SHIFT, pos.z));
 }
 
 // === ISelectionObserver implementation ===
@@ -208,13 +203,19 @@ void SelectionOverlay::renderSelectionViewport(
 void SelectionOverlay::onSelectionChanged(
     const std::vector<Domain::Selection::SelectionEntry> &added,
     const std::vector<Domain::Selection::SelectionEntry> &removed) {
-  // Mark as dirty when selection changes
-  // Could use added/removed for incremental updates in the future
+  // Mark as dirty when selection changes and drop the touched chunks' runs
+  for (const auto &entry : added) {
+    invalidateChunkAt(entry.getPosition());
+  }
+  for (const auto &entry : removed) {
+    invalidateChunkAt(entry.getPosition());
+  }
   dirty_ = true;
 }
 
 void SelectionOverlay::onSelectionCleared() {
   // Mark as dirty when selection is cleared
+  spawn_runs_.clear();
   dirty_ = true;
 }
 
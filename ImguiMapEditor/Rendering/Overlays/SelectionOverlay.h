@@ -3,7 +3,9 @@
 #include "Services/Selection/ISelectionObserver.h"
 #include "UI/Map/MapViewCamera.h"
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <imgui.h>
+#include <unordered_map>
 #include <vector>
 
 namespace MapEditor {
@@ -11,6 +13,10 @@ namespace AppLogic {
 class EditorSession;
 }
 
+namespace Domain::Selection {
+struct SelectionChunk;
+}
+
 namespace Rendering {
 
 // Forward declaration
@@ -64,14 +70,15 @@ public:
   // === ISelectionObserver interface ===
 
   /**
-   * Called when selection changes. Sets dirty flag for potential optimization.
+   * Called when selection changes. Drops the cached runs of the chunks the
+   * added/removed entries fall in.
    */
   void onSelectionChanged(
       const std::vector<Domain::Selection::SelectionEntry> &added,
       const std::vector<Domain::Selection::SelectionEntry> &removed) override;
 
   /**
-   * Called when selection is cleared.
+   * Called when selection is cleared (or replaced). Drops all cached runs.
    */
   void onSelectionCleared() override;
 
@@ -87,22 +94,43 @@ public:
 
 private:
   /**
-   * Renders selection by iterating through selected entries.
-   * Efficient for small selections.
+   * Horizontal run of selected spawn tiles, local chunk coordinates.
+   */
+  struct SpawnRun {
+    uint8_t y;
+    uint8_t first_x;
+    uint8_t last_x; // Inclusive
+  };
+
+  /**
+   * Renders selection highlights chunk by chunk.
+   * Off-screen chunks are culled with one bounds check; visible chunks draw
+   * their cached spawn runs clipped to the viewport, one rect pair per run.
    */
-  void renderSelectionIterative(ImDrawList *draw_list,
-                                const UI::MapViewCamera &camera,
-                                const ISelectionDataProvider *provider,
-                                int floor, float tile_screen_size);
+  void renderSelectionChunks(ImDrawList *draw_list,
+                             const UI::MapViewCamera &camera,
+                             const ISelectionDataProvider *provider, int floor,
+                             float tile_screen_size);
 
   /**
-   * Renders selection by iterating through visible viewport tiles.
-   * Efficient for large selections (avoids O(N) iteration of selection set).
+   * Cached spawn runs of a chunk, built from its spawn mask on first use.
    */
-  void renderSelectionViewport(ImDrawList *draw_list,
-                               const UI::MapViewCamera &camera,
-                               const ISelectionDataProvider *provider,
-                               int floor, float tile_screen_size);
+  const std::vector<SpawnRun> &
+  getSpawnRuns(const Domain::Selection::SelectionChunk &chunk);
+
+  static uint64_t makeKey(int32_t chunk_x, int32_t chunk_y, int16_t z) {
+    // Same packing as ChunkSpriteCache: 24 bits x, 24 bits y, 8 bits floor
+    uint64_t key = 0;
+    key |= (static_cast<uint64_t>(chunk_x + 0x800000) & 0xFFFFFF) << 32;
+    key |= (static_cast<uint64_t>(chunk_y + 0x800000) & 0xFFFFFF) << 8;
+    key |= static_cast<uint64_t>(z & 0xFF);
+    return key;
+  }
+
+  void invalidateChunkAt(const Domain::Position &pos);
+
+  // Spawn runs per selected chunk; entries are erased when the chunk changes
+  std::unordered_map<uint64_t, std::vector<SpawnRun>> spawn_runs_;
 
   // Dirty flag - set by observer callbacks, cleared after render
   bool dirty_ = false;
@@ -21,7 +21,7 @@ void SpawnLabelOverlay::renderFromCollector(
     const Services::ViewSettings &settings, bool show_spawns,
     bool show_creatures, const glm::vec2 &camera_pos,
     const glm::vec2 &viewport_pos, const glm::vec2 &viewport_size, int floor,
-    float zoom) {
+    float zoom, OverlayTextCache &text_cache) {
   if (!map || !collector)
     return;
 
@@ -46,7 +46,8 @@ void SpawnLabelOverlay::renderFromCollector(
       // Render SPAWN indicator on spawn tile
       glm::vec2 screen_pos = Utils::tileToScreen(
           spawn_pos, camera_pos, viewport_pos, viewport_size, zoom);
-      renderSpawnIndicator(draw_list, screen_pos, tile_size_px, zoom);
+      renderSpawnIndicator(draw_list, screen_pos, tile_size_px, zoom,
+                           text_cache);
 
       // Selection highlight: yellow border when spawn is selected
       if (spawn->isSelected()) {
@@ -69,7 +70,7 @@ void SpawnLabelOverlay::renderFromCollector(
 
       // Render solid border around spawn radius + Creature Count Badge
       renderRadiusBorder(draw_list, spawn_pos, spawn_entry.radius, camera_pos,
-                         viewport_pos, viewport_size, zoom,
+                         viewport_pos, viewport_size, zoom, text_cache,
                          spawn_entry.creature_count);
     }
   }
@@ -89,58 +90,70 @@ void SpawnLabelOverlay::renderFromCollector(
   bool simulate = simulator && simulator->isEnabled();
 
   if (show_creatures && client_data) {
-    for (int y = start_y; y < end_y; ++y) {
-      for (int x = start_x; x < end_x; ++x) {
-        Domain::Position pos(x, y, floor);
-        auto *tile = map->getTile(pos);
-        if (!tile || !tile->hasCreature())
+    // Walk only visible chunks that hold creatures instead of every tile
+    const int32_t chunk_x0 = start_x >> 5;
+    const int32_t chunk_y0 = start_y >> 5;
+    const int32_t chunk_x1 = (end_x - 1) >> 5;
+    const int32_t chunk_y1 = (end_y - 1) >> 5;
+    const int16_t chunk_z = static_cast<int16_t>(floor);
+
+    for (int32_t cy = chunk_y0; cy <= chunk_y1; ++cy) {
+      for (int32_t cx = chunk_x0; cx <= chunk_x1; ++cx) {
+        const Domain::Chunk *chunk = map->getChunk(cx, cy, chunk_z);
+        if (!chunk || chunk->getCreatureCount() == 0)
           continue;
 
-        Domain::Creature *creature = tile->getCreature();
-        if (!creature)
-          continue;
-
-        // Get creature position - may be different from tile position if
-        // simulating
-        Domain::Position creature_pos = pos;
-        uint8_t direction = static_cast<uint8_t>(creature->direction);
-        int animation_frame = 0;
-        float walk_offset_x = 0.0f;
-        float walk_offset_y = 0.0f;
-
-        if (simulate) {
-          auto *state = simulator->getOrCreateState(creature, pos, map);
-          if (state) {
-            creature_pos = state->current_pos;
-            direction = state->direction;
-            animation_frame = state->animation_frame;
-            walk_offset_x = state->walk_offset_x * tile_size_px;
-            walk_offset_y = state->walk_offset_y * tile_size_px;
-          }
-        }
-
-        // Calculate screen position from simulated position
-        glm::vec2 screen_pos = Utils::tileToScreen(
-            creature_pos, camera_pos, viewport_pos, viewport_size, zoom);
-        screen_pos.x += walk_offset_x;
-        screen_pos.y += walk_offset_y;
-
-        // NOTE: Creature SPRITES are now rendered via GPU pipeline in
-        // TileRenderer with per-floor two-pass rendering for proper floor
-        // occlusion. SpawnRenderer ONLY handles name labels (which are ImGui
-        // overlay).
-
-        // Render name label (controlled by LOD Policy)
-        // If LOD is active, we check the policy. If inactive, show by default.
-        bool should_show_name =
-            !is_lod_active_ || LODPolicy::SHOW_CREATURE_NAMES;
-
-        if (should_show_name) {
-          glm::vec2 center(screen_pos.x + tile_size_px / 2.0f,
-                           screen_pos.y + tile_size_px / 2.0f);
-          s_outfit_renderer.renderName(draw_list, creature->name, center,
-                                       tile_size_px, zoom);
-        }
+        chunk->forEachTileInRegion(
+            start_x - chunk->world_x, start_y - chunk->world_y,
+            end_x - chunk->world_x, end_y - chunk->world_y,
+            [&](const Domain::Tile *tile) {
+              if (!tile->hasCreature())
+                return;
+
+              const Domain::Creature *creature = tile->getCreature();
+              if (!creature)
+                return;
+
+              // Get creature position - may be different from tile position
+              // if simulating
+              const Domain::Position &pos = tile->getPosition();
+              Domain::Position creature_pos = pos;
+              float walk_offset_x = 0.0f;
+              float walk_offset_y = 0.0f;
+
+              if (simulate) {
+                auto *state = simulator->getOrCreateState(creature, pos, map);
+                if (state) {
+                  creature_pos = state->current_pos;
+                  walk_offset_x = state->walk_offset_x * tile_size_px;
+                  walk_offset_y = state->walk_offset_y * tile_size_px;
+                }
+              }
+
+              // Calculate screen position from simulated position
+              glm::vec2 screen_pos = Utils::tileToScreen(
+                  creature_pos, camera_pos, viewport_pos, viewport_size, zoom);
+              screen_pos.x += walk_offset_x;
+              screen_pos.y += walk_offset_y;
+
+              // NOTE: Creature SPRITES are rendered via GPU pipeline in
+              // TileRenderer with per-floor two-pass rendering for proper
+              // floor occlusion. SpawnRenderer ONLY handles name labels
+              // (which are ImGui overlay).
+
+              // Render name label (controlled by LOD Policy)
+              // If LOD is active, we check the policy. If inactive, show by
+              // default.
+              bool should_show_name =
+                  !is_lod_active_ || LODPolicy::SHOW_CREATURE_NAMES;
+
+              if (should_show_name) {
+                glm::vec2 center(screen_pos.x + tile_size_px / 2.0f,
+                                 screen_pos.y + tile_size_px / 2.0f);
+                s_outfit_renderer.renderName(draw_list, creature->name, center,
+                                             tile_size_px, zoom, &text_cache);
+              }
+            });
       }
     }
   }
@@ -148,7 +161,8 @@ void SpawnLabelOverlay::renderFromCollector(
 
 void SpawnLabelOverlay::renderSpawnIndicator(ImDrawList *draw_list,
                                              const glm::vec2 &screen_pos,
-                                             float size, float zoom) {
+                                             float size, float zoom,
+                                             OverlayTextCache &text_cache) {
   // Option B: Gray Transparent Box with Light Gray Border
   draw_list->AddRectFilled(ImVec2(screen_pos.x, screen_pos.y),
                            ImVec2(screen_pos.x + size, screen_pos.y + size),
@@ -163,19 +177,19 @@ void SpawnLabelOverlay::renderSpawnIndicator(ImDrawList *draw_list,
   bool should_show_text = !is_lod_active_ || LODPolicy::SHOW_SPAWN_LABELS;
 
   if (should_show_text) {
-    const char *text = "SPAWN";
-    ImVec2 textSize = ImGui::CalcTextSize(text);
+    auto &label = text_cache.get(nullptr, ImGui::GetFontSize(), "SPAWN",
+                                 Config::Colors::SPAWN_INDICATOR_TEXT);
     glm::vec2 center(screen_pos.x + size / 2.0f, screen_pos.y + size / 2.0f);
-    draw_list->AddText(
-        ImVec2(center.x - textSize.x / 2, center.y - textSize.y / 2),
-        Config::Colors::SPAWN_INDICATOR_TEXT, text);
+    text_cache.draw(draw_list, label,
+                    ImVec2(center.x - label.size.x / 2,
+                           center.y - label.size.y / 2));
   }
 }
 
 void SpawnLabelOverlay::renderRadiusBorder(
     ImDrawList *draw_list, const Domain::Position &spawn_pos, int radius,
     const glm::vec2 &camera_pos, const glm::vec2 &viewport_pos,
-    const glm::vec2 &viewport_size, float zoom,
+    const glm::vec2 &viewport_size, float zoom, OverlayTextCache &text_cache,
     int creature_count) { // Added creature_count param
   if (radius <= 0)
     return;
@@ -202,14 +216,17 @@ void SpawnLabelOverlay::renderRadiusBorder(
 
   // Render Creature Count Badge if count > 0
   if (creature_count > 0 && (!is_lod_active_ || LODPolicy::SHOW_SPAWN_LABELS)) {
-    std::string count_str = std::format("{}", creature_count);
-    const char *text = count_str.c_str();
+    // Format into a stack buffer; the cache only allocates for new counts
+    char count_buf[16];
+    auto result = std::format_to_n(count_buf, sizeof(count_buf), "{}",
+                                   creature_count);
+    std::string_view text(count_buf, result.out - count_buf);
 
     // Use larger font for visibility
     float font_size = Config::Colors::SPAWN_BADGE_FONT_SIZE;
-    ImFont *font = ImGui::GetFont();
-    // Calculate text size with specific font size
-    ImVec2 textSize = font->CalcTextSizeA(font_size, FLT_MAX, 0.0f, text);
+    auto &label = text_cache.get(ImGui::GetFont(), font_size, text,
+                                 Config::Colors::SPAWN_BADGE_TEXT);
+    ImVec2 textSize = label.size;
 
     float badge_pad_x = Config::Colors::SPAWN_BADGE_PADDING_X;
     float badge_pad_y = Config::Colors::SPAWN_BADGE_PADDING_Y;
@@ -228,10 +245,8 @@ void SpawnLabelOverlay::renderRadiusBorder(
     draw_list->AddRectFilled(badge_min, badge_max,
                              Config::Colors::SPAWN_BADGE_BG);
 
-    // Use font-specific AddText overload
-    draw_list->AddText(font, font_size,
-                       ImVec2(badge_x + badge_pad_x, badge_y + badge_pad_y),
-                       Config::Colors::SPAWN_BADGE_TEXT, text);
+    text_cache.draw(draw_list, label,
+                    ImVec2(badge_x + badge_pad_x, badge_y + badge_pad_y));
   }
 }
 
@@ -3,6 +3,7 @@
 #include "Domain/ChunkedMap.h"
 #include "OverlayCollector.h"
 #include "OverlaySpriteCache.h"
+#include "OverlayTextCache.h"
 #include "Services/ClientDataService.h"
 #include "Services/CreatureSimulator.h"
 #include "Services/SpriteManager.h"
@@ -23,7 +24,7 @@ public:
 
   /**
    * Optimized rendering using pre-collected overlay entries.
-   * Now scans ALL visible tiles for creatures (stored per-tile).
+   * Scans visible chunks holding creatures for name labels.
    * Uses spawn_radii from collector for proper border rendering.
    */
   void renderFromCollector(
@@ -34,7 +35,7 @@ public:
       const Services::ViewSettings &settings, bool show_spawns,
       bool show_creatures, const glm::vec2 &camera_pos,
       const glm::vec2 &viewport_pos, const glm::vec2 &viewport_size, int floor,
-      float zoom);
+      float zoom, OverlayTextCache &text_cache);
 
   /**
    * Set LOD mode to enable/disable simplified rendering.
@@ -48,7 +49,8 @@ private:
    * Render indicator for spawn tile (orange square with "SPAWN" text).
    */
   void renderSpawnIndicator(ImDrawList *draw_list, const glm::vec2 &screen_pos,
-                            float size, float zoom);
+                            float size, float zoom,
+                            OverlayTextCache &text_cache);
 
   /**
    * Render solid border around spawn radius area.
@@ -58,6 +60,7 @@ private:
                           const glm::vec2 &camera_pos,
                           const glm::vec2 &viewport_pos,
                           const glm::vec2 &viewport_size, float zoom,
+                          OverlayTextCache &text_cache,
                           int creature_count = 0);
 
   static constexpr float TILE_SIZE = Config::Rendering::TILE_SIZE;
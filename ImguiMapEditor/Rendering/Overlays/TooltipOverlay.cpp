@@ -11,10 +11,9 @@ namespace Rendering {
 
 void TooltipOverlay::renderFromCollector(
     ImDrawList *draw_list, const std::vector<OverlayEntry> &entries,
-    const glm::vec2 &camera_pos, const glm::vec2 &viewport_pos,
-    const glm::vec2 &viewport_size, float zoom) {
-  if (entries.empty())
-    return;
+    const Domain::ChunkedMap *map, const glm::vec2 &camera_pos,
+    const glm::vec2 &viewport_pos, const glm::vec2 &viewport_size, float zoom,
+    OverlayTextCache &text_cache) {
   if (entries.empty())
     return;
 
@@ -24,8 +23,21 @@ void TooltipOverlay::renderFromCollector(
   if (!should_show)
     return;
 
-  float scale = std::min(1.0f, std::max(0.4f, zoom));
-  ImGui::SetWindowFontScale(scale);
+  ++frame_;
+  if (tooltips_.size() > Config::Performance::TOOLTIP_TEXT_CACHE_LIMIT) {
+    for (auto it = tooltips_.begin(); it != tooltips_.end();) {
+      // Keep tooltips shown last frame; they are likely needed again
+      if (frame_ - it->second.last_used > 1) {
+        it = tooltips_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  // Snap to zoom buckets so the laid-out bubble texts are reused
+  float scale =
+      OverlayTextCache::bucketScale(std::min(1.0f, std::max(0.4f, zoom)));
 
   for (const auto &entry : entries) {
     const auto *tile = entry.tile; // Use const Tile* from OverlayEntry
@@ -34,99 +46,98 @@ void TooltipOverlay::renderFromCollector(
 
     const auto &tile_pos = tile->getPosition();
 
-    bool has_content = false;
-    bool is_waypoint = false;
+    // Tile mutators bump the chunk revision, and in-place attribute edits
+    // (property panel and dialogs) follow up with Tile::markDirty()
+    const Domain::Chunk *chunk =
+        map ? map->getChunk(tile_pos.x >> 5, tile_pos.y >> 5, tile_pos.z)
+            : nullptr;
+    const uint32_t revision = chunk ? chunk->getRevision() : 0;
+
+    CachedTooltip &cached = tooltips_[makeKey(tile_pos)];
+    cached.last_used = frame_;
+    if (revision == 0 || cached.revision != revision ||
+        cached.tile != tile || cached.waypoint_name != entry.waypoint_name) {
+      cached.tile = tile;
+      cached.waypoint_name = entry.waypoint_name;
+      cached.revision = revision;
+      cached.has_content = formatTooltip(*tile, entry.waypoint_name,
+                                         cached.text, cached.is_waypoint);
+    }
+
+    if (cached.has_content) {
+      // OverlayEntry.screen_pos is world space; tileToScreen applies camera,
+      // zoom and parallax like the old renderer did.
+      glm::vec2 screen_pos = Utils::tileToScreen(
+          tile_pos, camera_pos, viewport_pos, viewport_size, zoom);
+      drawSpeechBubble(draw_list, screen_pos, cached.text, cached.is_waypoint,
+                       zoom, scale, text_cache);
+    }
+  }
+}
+
+bool TooltipOverlay::formatTooltip(const Domain::Tile &tile,
+                                   const std::string *waypoint_name,
+                                   std::string &tooltip_text,
+                                   bool &is_waypoint) {
+  bool has_content = false;
+  is_waypoint = false;
+
+  tooltip_text.clear();
+  tooltip_text.reserve(128);
 
-    std::string tooltip_text;
-    tooltip_text.reserve(128);
+  if (waypoint_name) {
+    has_content = true;
+    is_waypoint = true;
+    tooltip_text += "wp: ";
+    tooltip_text += *waypoint_name;
+    tooltip_text += "\n";
+  }
 
-    if (entry.waypoint_name) {
+  // Ground Attributes
+  if (tile.getGround()) {
+    const auto *ground = tile.getGround();
+    if (ground->getActionId() > 0 || ground->getUniqueId() > 0) {
+      tooltip_text += "id: " + std::to_string(ground->getServerId()) + "\n";
+      if (ground->getActionId() > 0)
+        tooltip_text += "aid: " + std::to_string(ground->getActionId()) + "\n";
+      if (ground->getUniqueId() > 0)
+        tooltip_text += "uid: " + std::to_string(ground->getUniqueId()) + "\n";
       has_content = true;
-      is_waypoint = true;
-      tooltip_text += "wp: ";
-      tooltip_text += *entry.waypoint_name;
-      tooltip_text += "\n";
     }
+  }
 
-    // Ground Attributes
-    if (tile->getGround()) {
-      const auto *ground = tile->getGround();
-      if (ground->getActionId() > 0 || ground->getUniqueId() > 0) {
-        tooltip_text += "id: " + std::to_string(ground->getServerId()) + "\n";
-        if (ground->getActionId() > 0)
-          tooltip_text +=
-              "aid: " + std::to_string(ground->getActionId()) + "\n";
-        if (ground->getUniqueId() > 0)
-          tooltip_text +=
-              "uid: " + std::to_string(ground->getUniqueId()) + "\n";
-        has_content = true;
-      }
-    }
+  // Items Attributes
+  for (const auto &item_ptr : tile.getItems()) {
+    const auto *item = item_ptr.get();
+    bool item_has_attrs =
+        (item->getActionId() > 0 || item->getUniqueId() > 0 ||
+         item->getDoorId() > 0 || !item->getText().empty() ||
+         item->getTeleportDestination() != nullptr);
 
-    // Items Attributes
-    for (const auto &item_ptr : tile->getItems()) {
-      const auto *item = item_ptr.get();
-      bool item_has_attrs =
-          (item->getActionId() > 0 || item->getUniqueId() > 0 ||
-           item->getDoorId() > 0 || !item->getText().empty() ||
-           item->getTeleportDestination() != nullptr);
-
-      if (item_has_attrs) {
-        has_content = true;
-        tooltip_text += "id: " + std::to_string(item->getServerId()) + "\n";
-        if (item->getActionId() > 0)
-          tooltip_text += "aid: " + std::to_string(item->getActionId()) + "\n";
-        if (item->getUniqueId() > 0)
-          tooltip_text += "uid: " + std::to_string(item->getUniqueId()) + "\n";
-        if (item->getDoorId() > 0)
-          tooltip_text +=
-              "door id: " + std::to_string(item->getDoorId()) + "\n";
-
-        if (!item->getText().empty()) {
-          tooltip_text += "text: " + item->getText() + "\n";
-        }
-
-        const auto *dest = item->getTeleportDestination();
-        if (dest) {
-          tooltip_text += "dest: " + std::to_string(dest->x) + ", " +
-                          std::to_string(dest->y) + ", " +
-                          std::to_string(dest->z) + "\n";
-        }
+    if (item_has_attrs) {
+      has_content = true;
+      tooltip_text += "id: " + std::to_string(item->getServerId()) + "\n";
+      if (item->getActionId() > 0)
+        tooltip_text += "aid: " + std::to_string(item->getActionId()) + "\n";
+      if (item->getUniqueId() > 0)
+        tooltip_text += "uid: " + std::to_string(item->getUniqueId()) + "\n";
+      if (item->getDoorId() > 0)
+        tooltip_text += "door id: " + std::to_string(item->getDoorId()) + "\n";
+
+      if (!item->getText().empty()) {
+        tooltip_text += "text: " + item->getText() + "\n";
       }
-    }
-
-    if (has_content) {
-      // Use pre-calculated screen_pos from collector, but we need to adjust for
-      // Parallax? TileRenderer calculates screen_x/y used for drawing sprites.
-      // OverlayEntry stores that screen_x/y.
-      // That position IS the render position (parallax applied).
-      // BUT Sprite drawing subtracts cx*size etc.
-      // Let's verify OverlayEntry's screen_pos.
-      // In MapRenderer: screen_x = x * TILE_SIZE. Passed to queueTile.
-      // In TileRenderer::queueTile: It's just raw world coordinate unless
-      // adjusted. WAIT - MapRenderer passes `screen_x = x * TILE_SIZE`. This is
-      // WORLD SPACE. It is NOT screen space. The `tileToScreen` logic typically
-      // applies camera transform. In OverlayRenderer/TooltipRenderer:
-      // `tileToScreen` applies camera, zoom, AND parallax.
-
-      // So if we use OverlayEntry.screen_pos (which is world space), we need to
-      // project it. `queueTile` received `screen_x` which was just `x * 32`.
-
-      // Let's re-use `tileToScreen` helper from this class, but optimized.
-      // Actually, `tileToScreen` needs `pos`. We have `pos`.
-      // So we can just use `tileToScreen(tile_pos, ...)` and ignore stored
-      // entry.screen_pos if it's raw world. PRO: Consistent with old renderer.
-      // CON: Re-calculating position.
-      // Cost: negligible (a few muls/adds) vs Map Iteration (massive).
 
-      glm::vec2 screen_pos = Utils::tileToScreen(
-          tile_pos, camera_pos, viewport_pos, viewport_size, zoom);
-      drawSpeechBubble(draw_list, screen_pos, tooltip_text, is_waypoint, zoom,
-                       scale);
+      const auto *dest = item->getTeleportDestination();
+      if (dest) {
+        tooltip_text += "dest: " + std::to_string(dest->x) + ", " +
+                        std::to_string(dest->y) + ", " +
+                        std::to_string(dest->z) + "\n";
+      }
     }
   }
 
-  ImGui::SetWindowFontScale(1.0f);
+  return has_content;
 }
 
 void TooltipOverlay::renderHoverTooltip(
@@ -227,14 +238,17 @@ void TooltipOverlay::renderHoverTooltip(
 void TooltipOverlay::drawSpeechBubble(ImDrawList *draw_list,
                                       const glm::vec2 &tile_pos,
                                       const std::string &text, bool is_waypoint,
-                                      float zoom, float scale) {
+                                      float zoom, float scale,
+                                      OverlayTextCache &text_cache) {
   float tile_size = Config::Rendering::TILE_SIZE * zoom;
   float center_x = tile_pos.x + tile_size / 2.0f;
   float tile_top_y = tile_pos.y;
 
-  float max_text_width = 150.0f * scale;
-  ImVec2 text_size =
-      ImGui::CalcTextSize(text.c_str(), nullptr, false, max_text_width);
+  float max_text_width = Config::Tooltip::MAX_WIDTH_BASE * scale;
+  ImU32 text_color = Config::Colors::TOOLTIP_TEXT;
+  auto &label = text_cache.get(nullptr, ImGui::GetFontSize() * scale, text,
+                               text_color, max_text_width);
+  ImVec2 text_size = label.size;
 
   ImVec2 padding(4 * scale, 2 * scale);
   float bubble_width = text_size.x + padding.x * 2;
@@ -248,7 +262,6 @@ void TooltipOverlay::drawSpeechBubble(ImDrawList *draw_list,
   ImU32 bg_color = is_waypoint ? Config::Colors::TOOLTIP_WAYPOINT_BG
                                : Config::Colors::TOOLTIP_NORMAL_BG;
   ImU32 border_color = Config::Colors::TOOLTIP_BORDER;
-  ImU32 text_color = Config::Colors::TOOLTIP_TEXT;
 
   draw_list->AddRectFilled(ImVec2(bubble_left, bubble_top),
                            ImVec2(bubble_left + bubble_width, bubble_bottom),
@@ -266,9 +279,8 @@ void TooltipOverlay::drawSpeechBubble(ImDrawList *draw_list,
   draw_list->AddLine(p1, p3, border_color, 1.0f * scale);
   draw_list->AddLine(p2, p3, border_color, 1.0f * scale);
 
-  draw_list->AddText(nullptr, 0.0f,
-                     ImVec2(bubble_left + padding.x, bubble_top + padding.y),
-                     text_color, text.c_str(), nullptr, max_text_width);
+  text_cache.draw(draw_list, label,
+                  ImVec2(bubble_left + padding.x, bubble_top + padding.y));
 }
 
 void TooltipOverlay::drawParchmentTooltip(ImDrawList *draw_list,
@@ -2,10 +2,12 @@
 #include "../../Core/Config.h"
 #include "Domain/ChunkedMap.h"
 #include "OverlayCollector.h"
+#include "OverlayTextCache.h"
 #include "TooltipBubbleRenderer.h"
 #include <glm/glm.hpp>
 #include <imgui.h>
 #include <string>
+#include <unordered_map>
 
 namespace MapEditor {
 namespace Rendering {
@@ -21,12 +23,16 @@ public:
 
   /**
    * Optimized rendering using pre-collected overlay entries.
+   * Tooltip texts are formatted once per tile and reused until the tile's
+   * chunk revision changes; the bubble text comes from text_cache.
    */
   void renderFromCollector(ImDrawList *draw_list,
                            const std::vector<OverlayEntry> &entries,
+                           const Domain::ChunkedMap *map,
                            const glm::vec2 &camera_pos,
                            const glm::vec2 &viewport_pos,
-                           const glm::vec2 &viewport_size, float zoom);
+                           const glm::vec2 &viewport_size, float zoom,
+                           OverlayTextCache &text_cache);
 
   /**
    * Render hover tooltip at mouse position (parchment style).
@@ -43,11 +49,42 @@ public:
   void setLODMode(bool enabled) { is_lod_active_ = enabled; }
 
 private:
+  // Formatted tooltip of one tile position
+  struct CachedTooltip {
+    const Domain::Tile *tile = nullptr;
+    const std::string *waypoint_name = nullptr;
+    uint32_t revision = 0; // Chunk revision formatted from (0 = always stale)
+    std::string text;
+    bool has_content = false;
+    bool is_waypoint = false;
+    uint32_t last_used = 0;
+  };
+
   bool is_lod_active_ = false;
 
+  std::unordered_map<uint64_t, CachedTooltip> tooltips_;
+  uint32_t frame_ = 0;
+
+  static uint64_t makeKey(const Domain::Position &pos) {
+    // Same packing as ChunkSpriteCache: 24 bits x, 24 bits y, 8 bits floor
+    uint64_t key = 0;
+    key |= (static_cast<uint64_t>(pos.x + 0x800000) & 0xFFFFFF) << 32;
+    key |= (static_cast<uint64_t>(pos.y + 0x800000) & 0xFFFFFF) << 8;
+    key |= static_cast<uint64_t>(pos.z & 0xFF);
+    return key;
+  }
+
+  /**
+   * Format the attribute tooltip of a tile.
+   * @return true if the tile has anything to show
+   */
+  static bool formatTooltip(const Domain::Tile &tile,
+                            const std::string *waypoint_name, std::string &out,
+                            bool &is_waypoint);
+
   void drawSpeechBubble(ImDrawList *draw_list, const glm::vec2 &tile_pos,
                         const std::string &text, bool is_waypoint, float zoom,
-                        float scale);
+                        float scale, OverlayTextCache &text_cache);
 
   void drawParchmentTooltip(ImDrawList *draw_list, const glm::vec2 &pos,
                             const std::string &text);
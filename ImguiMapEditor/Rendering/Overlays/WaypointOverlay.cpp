@@ -7,7 +7,7 @@ namespace Rendering {
 void WaypointOverlay::renderFromCollector(
     ImDrawList *draw_list, const std::vector<OverlayEntry> &entries,
     const glm::vec2 &camera_pos, const glm::vec2 &viewport_pos,
-    const glm::vec2 &viewport_size, float zoom) {
+    const glm::vec2 &viewport_size, float zoom, OverlayTextCache &text_cache) {
   if (entries.empty())
     return;
 
@@ -77,27 +77,19 @@ void WaypointOverlay::renderFromCollector(
     glm::vec2 offset = (map_pos_unzoomed - cam_offset) * zoom;
     glm::vec2 final_screen_pos = viewport_pos + viewport_size * 0.5f + offset;
 
-    drawWaypointFlame(draw_list, final_screen_pos, *entry.waypoint_name, zoom);
+    drawWaypointFlame(draw_list, final_screen_pos, *entry.waypoint_name, zoom,
+                      text_cache);
   }
 }
 
 void WaypointOverlay::collectVisibleWaypoints(
     const Domain::ChunkedMap &map, int floor_z, const VisibleBounds &bounds,
     OverlayCollector &collector, const Services::ViewSettings &settings,
-    float floor_offset) {
+    float floor_offset, const OverlayChunkIndex *index) {
   // Process Waypoints (Unified Overlay Collection)
   // We do this here instead of in queueTile because Waypoints are stored in
   // Map, not Tile.
-  const auto &waypoints = map.getWaypoints();
-  for (const auto &wp : waypoints) {
-    if (wp.position.z != floor_z)
-      continue;
-
-    // Simple bounds check
-    if (wp.position.x < bounds.start_x || wp.position.x >= bounds.end_x ||
-        wp.position.y < bounds.start_y || wp.position.y >= bounds.end_y)
-      continue;
-
+  auto collect = [&](const Domain::ChunkedMap::Waypoint &wp) {
     float screen_x = wp.position.x * TILE_SIZE - floor_offset;
     float screen_y = wp.position.y * TILE_SIZE - floor_offset;
 
@@ -115,12 +107,31 @@ void WaypointOverlay::collectVisibleWaypoints(
       OverlayEntry entry{nullptr, {screen_x, screen_y}, &wp.name};
       collector.waypoints.push_back(entry);
     }
+  };
+
+  if (index) {
+    index->forEachWaypoint(map, floor_z, bounds, collect);
+    return;
+  }
+
+  const auto &waypoints = map.getWaypoints();
+  for (const auto &wp : waypoints) {
+    if (wp.position.z != floor_z)
+      continue;
+
+    // Simple bounds check
+    if (wp.position.x < bounds.start_x || wp.position.x >= bounds.end_x ||
+        wp.position.y < bounds.start_y || wp.position.y >= bounds.end_y)
+      continue;
+
+    collect(wp);
   }
 }
 
 void WaypointOverlay::drawWaypointFlame(ImDrawList *draw_list,
                                         const glm::vec2 &screen_pos,
-                                        const std::string &name, float zoom) {
+                                        const std::string &name, float zoom,
+                                        OverlayTextCache &text_cache) {
   float size = Config::Rendering::TILE_SIZE * zoom;
   float center_x = screen_pos.x + size / 2.0f;
   float base_y = screen_pos.y + size;
@@ -159,10 +170,11 @@ void WaypointOverlay::drawWaypointFlame(ImDrawList *draw_list,
 
   // Label
   if (!name.empty() && zoom > 0.5f) {
-    ImVec2 text_size = ImGui::CalcTextSize(name.c_str());
-    draw_list->AddText(ImVec2(center_x - text_size.x / 2,
-                              base_y - flame_height - text_size.y - 2),
-                       Config::Colors::WAYPOINT_FLAME_INNER, name.c_str());
+    auto &label = text_cache.get(nullptr, ImGui::GetFontSize(), name,
+                                 Config::Colors::WAYPOINT_FLAME_INNER);
+    text_cache.draw(draw_list, label,
+                    ImVec2(center_x - label.size.x / 2,
+                           base_y - flame_height - label.size.y - 2));
   }
 }
 
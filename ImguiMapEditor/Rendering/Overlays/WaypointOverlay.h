@@ -1,7 +1,9 @@
 #pragma once
 #include "../../Core/Config.h"
 #include "Domain/ChunkedMap.h"
+#include "OverlayChunkIndex.h"
 #include "OverlayCollector.h"
+#include "OverlayTextCache.h"
 #include "Rendering/Visibility/ChunkVisibilityManager.h"
 #include "Services/ViewSettings.h"
 #include <glm/glm.hpp>
@@ -27,21 +29,25 @@ public:
                            const std::vector<OverlayEntry> &entries,
                            const glm::vec2 &camera_pos,
                            const glm::vec2 &viewport_pos,
-                           const glm::vec2 &viewport_size, float zoom);
+                           const glm::vec2 &viewport_size, float zoom,
+                           OverlayTextCache &text_cache);
 
   /**
    * Collect visible waypoints and add them to the overlay collector.
    * Extracts collection logic from MapRenderer.
+   * @param index Refreshed per-chunk waypoint index; nullptr scans all
    */
   static void collectVisibleWaypoints(const Domain::ChunkedMap &map,
                                       int floor_z, const VisibleBounds &bounds,
                                       OverlayCollector &collector,
                                       const Services::ViewSettings &settings,
-                                      float floor_offset);
+                                      float floor_offset,
+                                      const OverlayChunkIndex *index = nullptr);
 
 private:
   void drawWaypointFlame(ImDrawList *draw_list, const glm::vec2 &screen_pos,
-                         const std::string &name, float zoom);
+                         const std::string &name, float zoom,
+                         OverlayTextCache &text_cache);
 
   static constexpr float TILE_SIZE = Config::Rendering::TILE_SIZE;
 };
@@ -1,6 +1,7 @@
 #include "Rendering/Passes/GhostFloorRenderer.h"
 #include "Domain/ChunkedMap.h"
 #include "Rendering/Backend/SpriteBatch.h"
+#include "Rendering/Frame/FramePreparer.h"
 #include "Rendering/Map/TileRenderer.h"
 #include "Rendering/Tile/ChunkRenderingStrategy.h"
 #include "Rendering/Visibility/FloorIterator.h"
@@ -43,7 +44,9 @@ void GhostFloorRenderer::render(const RenderContext &context) {
         FloorIterator::GHOST_ALPHA,
         glm::vec2(context.viewport_width, context.viewport_height),
         context.camera.getPosition(), context.mvp_matrix, context.anim_ticks,
-        context.missing_sprites_buffer);
+        context.missing_sprites_buffer,
+        context.frame_prep ? context.frame_prep->getGhostFloor(ghost_higher)
+                           : nullptr);
   }
 
   // Ghost lower floor
@@ -57,7 +60,9 @@ void GhostFloorRenderer::render(const RenderContext &context) {
         FloorIterator::GHOST_ALPHA,
         glm::vec2(context.viewport_width, context.viewport_height),
         context.camera.getPosition(), context.mvp_matrix, context.anim_ticks,
-        context.missing_sprites_buffer);
+        context.missing_sprites_buffer,
+        context.frame_prep ? context.frame_prep->getGhostFloor(ghost_lower)
+                           : nullptr);
   }
 }
 
@@ -66,14 +71,21 @@ void GhostFloorRenderer::renderSingleFloor(
     const VisibleBounds &bounds, int current_floor, int ghost_floor, float zoom,
     float alpha, const glm::vec2 &viewport_size, const glm::vec2 &camera_pos,
     const glm::mat4 &mvp, const AnimationTicks &anim_ticks,
-    std::vector<uint32_t> &missing_sprites) {
+    std::vector<uint32_t> &missing_sprites, const PreparedFloor *prepared) {
   // Calculate floor offset for ghost floor (parallax effect)
   float floor_offset =
       FloorIterator::getFloorOffset(current_floor, ghost_floor);
 
-  // Update chunk visibility for ghost floor
-  chunk_visibility_.update(map, bounds, static_cast<int8_t>(ghost_floor),
-                           floor_offset);
+  // Chunk visibility for ghost floor, gathered on workers when prepared.
+  // The shared manager is also used by TerrainPass, so updating it here
+  // would invalidate its incremental state every frame.
+  if (!prepared) {
+    chunk_visibility_.update(map, bounds, static_cast<int8_t>(ghost_floor),
+                             floor_offset);
+  }
+  const std::vector<VisibleChunk> &visible_chunks =
+      prepared ? prepared->visibility.getVisibleChunks()
+               : chunk_visibility_.getVisibleChunks();
 
   // OPTIMIZATION: Use ChunkRenderingStrategy's Cached Mode.
   // This automatically handles cache generation (uploading static geometry once)
@@ -91,7 +103,7 @@ void GhostFloorRenderer::renderSingleFloor(
                                sprite_manager_.getSpriteLUT());
   sprite_batch_.setGlobalTint(1.0f, 1.0f, 1.0f, alpha);
 
-  for (const VisibleChunk &vc : chunk_visibility_.getVisibleChunks()) {
+  for (const VisibleChunk &vc : visible_chunks) {
     Domain::Chunk *chunk = vc.chunk;
 
     ChunkRenderingStrategy::Context chunk_ctx(
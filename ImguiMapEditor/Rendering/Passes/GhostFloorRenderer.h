@@ -25,6 +25,7 @@ namespace Rendering {
 class TileRenderer;
 class SpriteBatch;
 class ChunkRenderingStrategy;
+struct PreparedFloor;
 
 /**
  * Renders ghost (transparent) floors above/below the current floor.
@@ -47,6 +48,7 @@ public:
 private:
   /**
    * Internal helper: Render a single ghost floor with parallax offset.
+   * @param prepared Ghost floor prepared by FramePreparer, or nullptr
    */
   void renderSingleFloor(const Domain::ChunkedMap &map, RenderState &state,
                          const VisibleBounds &bounds, int current_floor,
@@ -54,7 +56,8 @@ private:
                          const glm::vec2 &viewport_size,
                          const glm::vec2 &camera_pos, const glm::mat4 &mvp,
                          const AnimationTicks &anim_ticks,
-                         std::vector<uint32_t> &missing_sprites);
+                         std::vector<uint32_t> &missing_sprites,
+                         const PreparedFloor *prepared);
 
 private:
   TileRenderer &tile_renderer_;
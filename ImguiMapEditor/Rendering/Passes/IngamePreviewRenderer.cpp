@@ -234,10 +234,11 @@ void IngamePreviewRenderer::render(const Domain::ChunkedMap &map,
       last_ambient_light_ = config.ambient_level;
     }
 
-    light_manager_->render(map, viewport_width, viewport_height, camera_x,
-                           camera_y, zoom, floor, 
+    light_manager_->render(map, light_snapshots_, viewport_width,
+                           viewport_height, camera_x, camera_y, zoom, floor,
                            render_start_z, render_end_z,  // Floor range from fading calculation
                            config);
+    light_snapshots_.publish(); // Trims the working set
   }
 }
 
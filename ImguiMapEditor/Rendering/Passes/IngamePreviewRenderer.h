@@ -2,6 +2,7 @@
 #include "Core/Config.h"
 #include "Domain/ChunkedMap.h"
 #include "Rendering/Backend/SpriteBatch.h"
+#include "Rendering/Frame/RenderSnapshotStore.h"
 #include "Rendering/Light/LightManager.h"
 #include "Rendering/Map/TileRenderer.h"
 #include "Rendering/Visibility/FloorVisibilityCalculator.h"
@@ -67,6 +68,7 @@ private:
 
   // Light system (independent from MapRenderer)
   std::unique_ptr<LightManager> light_manager_;
+  RenderSnapshotStore light_snapshots_; // Chunk snapshots lights read from
   uint8_t last_ambient_light_ = 255;
 
   // Fading state
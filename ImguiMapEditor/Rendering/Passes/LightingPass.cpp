@@ -45,7 +45,7 @@ void LightingPass::render(const RenderContext &context) {
   }
 
   context.state.light_manager->render(
-      context.map, context.viewport_width, context.viewport_height,
+      context.map, *context.state.snapshots, context.viewport_width, context.viewport_height,
       context.camera.getX(), context.camera.getY(), context.camera.getZoom(),
       static_cast<int>(context.current_floor),
       floor_range.start_z, floor_range.super_end_z,
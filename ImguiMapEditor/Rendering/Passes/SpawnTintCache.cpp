@@ -0,0 +1,188 @@
+#include "SpawnTintCache.h"
+#include "Domain/ChunkedMap.h"
+#include <algorithm>
+#include <bit>
+
+namespace MapEditor {
+namespace Rendering {
+
+namespace {
+
+// Bits x0..x1 (inclusive) of a mask row
+uint32_t rowBits(int x0, int x1) {
+  const int width = x1 - x0 + 1;
+  return width >= 32 ? ~0u : ((1u << width) - 1u) << x0;
+}
+
+} // anonymous namespace
+
+void SpawnTintCache::update(const Domain::ChunkedMap &map, int floor_z,
+                            const VisibleBounds &bounds) {
+  ++frame_;
+  visible_.clear();
+
+  const int32_t chunk_x0 = bounds.start_x >> 5;
+  const int32_t chunk_y0 = bounds.start_y >> 5;
+  const int32_t chunk_x1 = (bounds.end_x - 1) >> 5;
+  const int32_t chunk_y1 = (bounds.end_y - 1) >> 5;
+  if (chunk_x1 < chunk_x0 || chunk_y1 < chunk_y0) {
+    return;
+  }
+
+  // Visible chunks plus a one-chunk ring of possible spawn sources
+  const int32_t grid_w = chunk_x1 - chunk_x0 + 3;
+  const int32_t grid_h = chunk_y1 - chunk_y0 + 3;
+  const size_t grid_size = static_cast<size_t>(grid_w) * grid_h;
+  grid_chunks_.assign(grid_size, nullptr);
+  grid_signatures_.assign(grid_size, 0);
+  bool any_spawns = false;
+  for (int32_t gy = 0; gy < grid_h; ++gy) {
+    for (int32_t gx = 0; gx < grid_w; ++gx) {
+      const Domain::Chunk *chunk =
+          map.getChunk(chunk_x0 - 1 + gx, chunk_y0 - 1 + gy,
+                       static_cast<int16_t>(floor_z));
+      const size_t index = static_cast<size_t>(gy) * grid_w + gx;
+      grid_chunks_[index] = chunk;
+      grid_signatures_[index] = spawnSignature(chunk);
+      any_spawns |= grid_signatures_[index] != 0;
+    }
+  }
+
+  if (any_spawns) {
+    const Domain::Chunk *neighbours[9];
+    std::array<uint64_t, 9> sources;
+    for (int32_t cy = chunk_y0; cy <= chunk_y1; ++cy) {
+      for (int32_t cx = chunk_x0; cx <= chunk_x1; ++cx) {
+        const int32_t gx = cx - chunk_x0 + 1;
+        const int32_t gy = cy - chunk_y0 + 1;
+        bool tinted = false;
+        for (int i = 0; i < 9; ++i) {
+          const size_t index =
+              static_cast<size_t>(gy - 1 + i / 3) * grid_w + (gx - 1 + i % 3);
+          neighbours[i] = grid_chunks_[index];
+          sources[i] = grid_signatures_[index];
+          tinted |= sources[i] != 0;
+        }
+        if (!tinted) {
+          continue;
+        }
+
+        ChunkTint &tint = chunks_[makeKey(cx, cy)];
+        tint.last_used = frame_;
+        if (!tint.built || tint.sources != sources) {
+          tint.chunk_x = cx;
+          tint.chunk_y = cy;
+          tint.sources = sources;
+          rasterize(tint, neighbours);
+        }
+        if (!tint.rects.empty()) {
+          visible_.push_back(&tint);
+        }
+      }
+    }
+  }
+
+  if (chunks_.size() > Config::Performance::SPAWN_TINT_CACHE_LIMIT) {
+    for (auto it = chunks_.begin(); it != chunks_.end();) {
+      // Keep chunks used last frame; they are likely needed again
+      if (frame_ - it->second.last_used > 1) {
+        it = chunks_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+void SpawnTintCache::clear() {
+  chunks_.clear();
+  visible_.clear();
+}
+
+uint64_t SpawnTintCache::spawnSignature(const Domain::Chunk *chunk) {
+  if (!chunk || !chunk->hasSpawns()) {
+    return 0;
+  }
+
+  // Every tile mutation, spawn placement and radius edits included, bumps
+  // the chunk revision, so the revision alone identifies the spawn layout.
+  // Shifted so the low bit can mark "has spawns" (0 means none).
+  return (static_cast<uint64_t>(chunk->getRevision()) << 1) | 1;
+}
+
+void SpawnTintCache::rasterize(ChunkTint &tint,
+                               const Domain::Chunk *const neighbours[9]) {
+  tint.mask.fill(0);
+  tint.built = true;
+
+  const int32_t origin_x = tint.chunk_x * SIZE;
+  const int32_t origin_y = tint.chunk_y * SIZE;
+  for (int i = 0; i < 9; ++i) {
+    const Domain::Chunk *chunk = neighbours[i];
+    if (!chunk || !chunk->hasSpawns()) {
+      continue;
+    }
+    for (const Domain::Tile *tile : chunk->getSpawnTiles()) {
+      const Domain::Spawn *spawn = tile ? tile->getSpawn() : nullptr;
+      if (!spawn) {
+        continue;
+      }
+      // Square (Chebyshev) radius; reach is limited to the neighbourhood
+      const int32_t radius = std::clamp<int32_t>(spawn->radius, 0, SIZE);
+      const int32_t x0 = std::max(0, tile->getX() - radius - origin_x);
+      const int32_t x1 = std::min(SIZE - 1, tile->getX() + radius - origin_x);
+      const int32_t y0 = std::max(0, tile->getY() - radius - origin_y);
+      const int32_t y1 = std::min(SIZE - 1, tile->getY() + radius - origin_y);
+      if (x0 > x1 || y0 > y1) {
+        continue;
+      }
+      const uint32_t bits = rowBits(x0, x1);
+      for (int32_t y = y0; y <= y1; ++y) {
+        tint.mask[y] |= bits;
+      }
+    }
+  }
+
+  buildRects(tint);
+}
+
+void SpawnTintCache::buildRects(ChunkTint &tint) {
+  tint.rects.clear();
+
+  // Split rows into runs and extend the rectangle ending on the row above
+  // while a run keeps the same extent (a 32-bit row has at most 16 runs)
+  std::array<uint16_t, SIZE / 2> open;
+  std::array<uint16_t, SIZE / 2> next;
+  size_t open_count = 0;
+  for (int y = 0; y < SIZE; ++y) {
+    size_t next_count = 0;
+    uint32_t bits = tint.mask[y];
+    while (bits) {
+      const int x = std::countr_zero(bits);
+      const int width = std::countr_one(bits >> x);
+      bits &= ~rowBits(x, x + width - 1);
+
+      uint16_t index = static_cast<uint16_t>(tint.rects.size());
+      bool extended = false;
+      for (size_t i = 0; i < open_count; ++i) {
+        Rect &rect = tint.rects[open[i]];
+        if (rect.x == x && rect.w == width) {
+          ++rect.h;
+          index = open[i];
+          extended = true;
+          break;
+        }
+      }
+      if (!extended) {
+        tint.rects.push_back({static_cast<uint8_t>(x), static_cast<uint8_t>(y),
+                              static_cast<uint8_t>(width), 1});
+      }
+      next[next_count++] = index;
+    }
+    open = next;
+    open_count = next_count;
+  }
+}
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -0,0 +1,91 @@
+#pragma once
+#include "Core/Config.h"
+#include "Rendering/Visibility/VisibleBounds.h"
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace MapEditor {
+
+namespace Domain {
+class ChunkedMap;
+class Chunk;
+} // namespace Domain
+
+namespace Rendering {
+
+/**
+ * Spawn radius tint of one floor, rasterized per chunk.
+ *
+ * Each chunk position near a spawn gets a bitmask of tiles inside any spawn
+ * radius, merged into a few rectangles for drawing. A mask is rebuilt only
+ * when a spawn in its 3x3 chunk neighbourhood is added, removed, moved or
+ * resized. The editor caps spawn radii at 30 tiles, so spawns one chunk
+ * further away cannot reach it; larger radii from imported maps are clipped
+ * to one chunk. Overlapping radii tint a tile once.
+ *
+ * update() reads the map and writes only this cache, so one floor's cache
+ * can be updated on a worker while other floors are prepared.
+ */
+class SpawnTintCache {
+public:
+  static constexpr int SIZE = Config::Performance::CHUNK_SIZE;
+  using Rows = std::array<uint32_t, SIZE>;
+
+  // Tinted tile rectangle in chunk-local tiles
+  struct Rect {
+    uint8_t x, y, w, h;
+  };
+
+  struct ChunkTint {
+    int32_t chunk_x = 0;
+    int32_t chunk_y = 0;
+    Rows mask{};
+    std::vector<Rect> rects;
+    // Spawn signatures of the 3x3 neighbourhood rasterized (row-major)
+    std::array<uint64_t, 9> sources{};
+    uint32_t last_used = 0;
+    bool built = false;
+  };
+
+  /**
+   * Rebuild stale chunk tints within bounds and collect the tinted ones.
+   */
+  void update(const Domain::ChunkedMap &map, int floor_z,
+              const VisibleBounds &bounds);
+
+  /**
+   * Chunk tints with at least one tinted tile from the last update().
+   */
+  const std::vector<const ChunkTint *> &getVisible() const { return visible_; }
+
+  void clear();
+
+  size_t getCachedChunkCount() const { return chunks_.size(); }
+
+private:
+  static uint64_t makeKey(int32_t chunk_x, int32_t chunk_y) {
+    // Chunk packing without the floor (one cache per floor)
+    return (static_cast<uint64_t>(static_cast<uint32_t>(chunk_x)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(chunk_y));
+  }
+
+  // Derived from the chunk revision; changes whenever a spawn of the chunk
+  // changes (0 = no spawns)
+  static uint64_t spawnSignature(const Domain::Chunk *chunk);
+
+  void rasterize(ChunkTint &tint, const Domain::Chunk *const neighbours[9]);
+  static void buildRects(ChunkTint &tint);
+
+  std::unordered_map<uint64_t, ChunkTint> chunks_;
+  std::vector<const ChunkTint *> visible_;
+  uint32_t frame_ = 0;
+
+  // Per-update scratch: chunks and signatures around the visible range
+  std::vector<const Domain::Chunk *> grid_chunks_;
+  std::vector<uint64_t> grid_signatures_;
+};
+
+} // namespace Rendering
+} // namespace MapEditor
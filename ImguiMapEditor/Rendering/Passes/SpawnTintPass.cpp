@@ -1,4 +1,5 @@
 #include "SpawnTintPass.h"
+#include "SpawnTintCache.h"
 #include "Rendering/Resources/AtlasManager.h"
 #include "Rendering/Utils/CoordUtils.h"
 #include "Services/SpriteManager.h"
@@ -59,36 +60,59 @@ void SpawnTintPass::queueCenterIndicator(float screen_x, float screen_y,
 
 void SpawnTintPass::renderFromCollector(const OverlayCollector &collector,
                                         int floor_z, float floor_offset,
-                                        float alpha) {
+                                        float alpha,
+                                        const SpawnTintCache *tint) {
   // Use constant TILE_SIZE (32.0f) because the MVP matrix handles Zoom.
   constexpr float tile_size = Config::Rendering::TILE_SIZE;
 
   // 1. Render Cyan Radius Tints
-  for (const auto &entry : collector.spawn_radii) {
-    if (entry.floor != floor_z)
-      continue;
-
-    // Calculate World Coordinates (Un-zoomed, but with parallax offset)
-    // Same logic as ChunkRenderingStrategy
-    float center_world_x = entry.center_x * tile_size - floor_offset;
-    float center_world_y = entry.center_y * tile_size - floor_offset;
-
-    // Radius is square (Chebyshev)
-    // Full width = (radius * 2 + 1) tiles
-    float radius_px = (entry.radius * 2 + 1) * tile_size;
-
-    // Top-left corner
-    float top_left_x = center_world_x - entry.radius * tile_size;
-    float top_left_y = center_world_y - entry.radius * tile_size;
-
+  if (tint) {
+    // Pre-rasterized per-chunk masks (overlapping radii merged)
     const AtlasRegion *white_pixel =
         sprite_manager_.getAtlasManager().getWhitePixel();
-    if (white_pixel) {
-      float overlay_alpha = Config::Colors::SPAWN_RADIUS_TINT_FACTOR * alpha;
-      sprite_batch_.draw(top_left_x, top_left_y, radius_px, radius_px,
-                         *white_pixel, Config::Colors::SPAWN_RADIUS_TINT_R,
-                         Config::Colors::SPAWN_RADIUS_TINT_G,
-                         Config::Colors::SPAWN_RADIUS_TINT_B, overlay_alpha);
+    float overlay_alpha = Config::Colors::SPAWN_RADIUS_TINT_FACTOR * alpha;
+    for (const SpawnTintCache::ChunkTint *chunk : tint->getVisible()) {
+      if (!white_pixel)
+        break;
+      const int32_t origin_x = chunk->chunk_x * SpawnTintCache::SIZE;
+      const int32_t origin_y = chunk->chunk_y * SpawnTintCache::SIZE;
+      for (const SpawnTintCache::Rect &rect : chunk->rects) {
+        sprite_batch_.draw((origin_x + rect.x) * tile_size - floor_offset,
+                           (origin_y + rect.y) * tile_size - floor_offset,
+                           rect.w * tile_size, rect.h * tile_size, *white_pixel,
+                           Config::Colors::SPAWN_RADIUS_TINT_R,
+                           Config::Colors::SPAWN_RADIUS_TINT_G,
+                           Config::Colors::SPAWN_RADIUS_TINT_B, overlay_alpha);
+      }
+    }
+  } else {
+    // One quad per spawn radius
+    for (const auto &entry : collector.spawn_radii) {
+      if (entry.floor != floor_z)
+        continue;
+
+      // Calculate World Coordinates (Un-zoomed, but with parallax offset)
+      // Same logic as ChunkRenderingStrategy
+      float center_world_x = entry.center_x * tile_size - floor_offset;
+      float center_world_y = entry.center_y * tile_size - floor_offset;
+
+      // Radius is square (Chebyshev)
+      // Full width = (radius * 2 + 1) tiles
+      float radius_px = (entry.radius * 2 + 1) * tile_size;
+
+      // Top-left corner
+      float top_left_x = center_world_x - entry.radius * tile_size;
+      float top_left_y = center_world_y - entry.radius * tile_size;
+
+      const AtlasRegion *white_pixel =
+          sprite_manager_.getAtlasManager().getWhitePixel();
+      if (white_pixel) {
+        float overlay_alpha = Config::Colors::SPAWN_RADIUS_TINT_FACTOR * alpha;
+        sprite_batch_.draw(top_left_x, top_left_y, radius_px, radius_px,
+                           *white_pixel, Config::Colors::SPAWN_RADIUS_TINT_R,
+                           Config::Colors::SPAWN_RADIUS_TINT_G,
+                           Config::Colors::SPAWN_RADIUS_TINT_B, overlay_alpha);
+      }
     }
   }
 
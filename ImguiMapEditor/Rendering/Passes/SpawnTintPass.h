@@ -14,6 +14,8 @@ class SpriteManager;
 
 namespace Rendering {
 
+class SpawnTintCache;
+
 /**
  * Renders spawn-related overlays:
  * - Cyan tint for tiles within spawn radius
@@ -57,9 +59,12 @@ public:
    * This decoupled rendering ensures overlays appear even when tile rendering
    * is batched/cached.
    * Uses World Coordinates (unscaled) to match the TerrainPass MVP matrix.
+   * @param tint Pre-rasterized radius tint of the floor; when null, one quad
+   *             is drawn per spawn radius from the collector
    */
   void renderFromCollector(const OverlayCollector &collector, int floor_z,
-                           float floor_offset, float alpha);
+                           float floor_offset, float alpha,
+                           const SpawnTintCache *tint = nullptr);
 
   /**
    * Collect all spawns within the visible area (plus radius) into the overlay
@@ -1,11 +1,14 @@
 #include "Rendering/Passes/TerrainPass.h"
 #include "Core/Config.h"
 #include "Rendering/Frame/FrameDataCollector.h"
+#include "Rendering/Frame/FramePreparer.h"
 #include "Rendering/Map/TileRenderer.h"
 #include "Rendering/Passes/ShadeRenderer.hpp"
 #include "Rendering/Passes/SpawnTintPass.h"
+#include "Rendering/Tile/ChunkImpostorRenderer.h"
 #include "Rendering/Tile/ChunkRenderingStrategy.h"
 #include "Rendering/Visibility/ChunkVisibilityManager.h"
+#include "Rendering/Visibility/FloorCoverage.h"
 #include "Rendering/Visibility/FloorIterator.h"
 #include "Rendering/Visibility/LODPolicy.h"
 #include "Services/SpriteManager.h"
@@ -29,6 +32,8 @@ TerrainPass::TerrainPass(TileRenderer &tile_renderer,
       std::make_unique<SpawnTintPass>(sprite_batch_, sprite_manager_);
   chunk_strategy_ = std::make_unique<ChunkRenderingStrategy>(
       tile_renderer_, sprite_batch_, sprite_manager);
+  impostor_renderer_ = std::make_unique<ChunkImpostorRenderer>(sprite_batch_);
+  floor_coverage_ = std::make_unique<FloorCoverage>();
 
   // Initialize state
   was_lod_active_ = false;
@@ -65,11 +70,18 @@ void TerrainPass::render(const RenderContext &context) {
     context.state.chunk_cache.prune(
         static_cast<int8_t>(floor_range.super_end_z),
         static_cast<int8_t>(floor_range.start_z));
+    context.state.impostor_cache.prune(
+        static_cast<int8_t>(floor_range.super_end_z),
+        static_cast<int8_t>(floor_range.start_z));
 
     last_floor_ = context.current_floor;
     was_show_all_floors_ = show_all_floors;
   }
 
+  context.state.impostor_cache.beginFrame();
+  floor_coverage_->beginFrame();
+  impostor_builds_left_ = Config::Performance::IMPOSTOR_BUILDS_PER_FRAME;
+
   // Get white pixel for shade rendering
   const AtlasRegion *white_pixel =
       sprite_manager_.getAtlasManager().getWhitePixel();
@@ -113,26 +125,28 @@ void TerrainPass::renderMainFloor(const RenderContext &context, int floor) {
   if (was_lod_active_ && !is_lod_active_) {
     // Zoomed IN: Clear cache
     context.state.chunk_cache.clear();
+    context.state.impostor_cache.clear();
   }
   was_lod_active_ = is_lod_active_;
 
-  // Expand viewport bounds per floor (RME parallax effect)
-  int floor_diff =
-      FloorIterator::calculateRangeWithToggle(
-          context.current_floor, context.view_settings->show_all_floors)
-          .start_z -
-      floor;
-
+  const PreparedFloor *prepared =
+      context.frame_prep ? context.frame_prep->getFloor(floor) : nullptr;
   FloorRange floor_range = FloorIterator::calculateRangeWithToggle(
       context.current_floor, context.view_settings->show_all_floors);
-  int floor_diff_val = floor_range.start_z - floor;
 
-  VisibleBounds floor_bounds =
-      context.visible_bounds.withFloorOffset(floor_diff_val);
+  VisibleBounds floor_bounds;
+  float floor_offset = 0.0f;
+  if (prepared) {
+    floor_bounds = prepared->bounds;
+    floor_offset = prepared->floor_offset;
+  } else {
+    // Expand viewport bounds per floor (RME parallax effect)
+    floor_bounds =
+        context.visible_bounds.withFloorOffset(floor_range.start_z - floor);
 
-  // Calculate floor offset for parallax
-  float floor_offset =
-      FloorIterator::getFloorOffset(context.current_floor, floor);
+    // Calculate floor offset for parallax
+    floor_offset = FloorIterator::getFloorOffset(context.current_floor, floor);
+  }
 
   float zoom = context.camera.getZoom();
 
@@ -142,14 +156,19 @@ void TerrainPass::renderMainFloor(const RenderContext &context, int floor) {
   // Update cache policy
   context.state.last_zoom = zoom;
 
-  // Query visibility for THIS floor specifically
-  chunk_visibility_.update(context.map, floor_bounds,
-                           static_cast<int8_t>(floor), floor_offset);
-
-  // PRE-PASS: Collect all spawns before tile rendering
-  frame_data_collector_.collectSpawns(context.map, floor, floor_bounds,
-                                      context.state.overlay_collector,
-                                      *context.view_settings);
+  // PRE-PASS: Visibility and spawns, gathered on workers when prepared
+  if (prepared) {
+    context.state.overlay_collector.merge(prepared->spawns);
+  } else {
+    chunk_visibility_.update(context.map, floor_bounds,
+                             static_cast<int8_t>(floor), floor_offset);
+    frame_data_collector_.collectSpawns(context.map, floor, floor_bounds,
+                                        context.state.overlay_collector,
+                                        *context.view_settings);
+  }
+  const std::vector<VisibleChunk> &visible_chunks =
+      prepared ? prepared->visibility.getVisibleChunks()
+               : chunk_visibility_.getVisibleChunks();
 
   int tiles_rendered = 0;
 
@@ -159,45 +178,75 @@ void TerrainPass::renderMainFloor(const RenderContext &context, int floor) {
     // 1. Flush and end the current Sprite Batch (used for shade/overlays)
     sprite_batch_.end(sprite_manager_.getAtlasManager());
 
-    // 2. Begin Tile Batch Mode (sets shader, binds Atlas/LUT/VAO ONCE)
-    sprite_batch_.beginTileBatch(context.mvp_matrix,
-                                 sprite_manager_.getAtlasManager(),
-                                 sprite_manager_.getSpriteLUT());
-
-    for (const VisibleChunk &vc : chunk_visibility_.getVisibleChunks()) {
-      Domain::Chunk *chunk = vc.chunk;
-      ChunkRenderingStrategy::Context chunk_ctx(
-          context.state, context.anim_ticks, context.missing_sprites_buffer,
-          tiles_rendered, floor, floor_offset, *chunk);
-
-      // Render using cached VBOs
-      chunk_strategy_->renderCached(*chunk, chunk_ctx);
+    if (zoom < Config::Performance::IMPOSTOR_ZOOM_THRESHOLD) {
+      // 2a. Far zoom: one pre-rasterized quad per chunk
+      renderImpostors(context, visible_chunks, floor, floor_offset,
+                      tiles_rendered);
+    } else {
+      // 2. Begin Tile Batch Mode (sets shader, binds Atlas/LUT/VAO ONCE)
+      sprite_batch_.beginTileBatch(context.mvp_matrix,
+                                   sprite_manager_.getAtlasManager(),
+                                   sprite_manager_.getSpriteLUT());
+
+      for (const VisibleChunk &vc : visible_chunks) {
+        Domain::Chunk *chunk = vc.chunk;
+        ChunkRenderingStrategy::Context chunk_ctx(
+            context.state, context.anim_ticks, context.missing_sprites_buffer,
+            tiles_rendered, floor, floor_offset, *chunk);
+
+        // Render using cached VBOs
+        chunk_strategy_->renderCached(*chunk, chunk_ctx);
+      }
+
+      // 3. End Tile Batch Mode
+      sprite_batch_.endTileBatch();
     }
 
-    // 3. End Tile Batch Mode
-    sprite_batch_.endTileBatch();
-
     // 4. Restart Sprite Batch Mode for subsequent rendering (Creatures, etc.)
     sprite_batch_.begin(context.mvp_matrix);
 
+    // 5. Keep the VBO cache bounded: drop chunks that just left the view
+    if (prepared && context.state.chunk_cache.getCacheSize() >
+                        Config::Performance::CHUNK_CACHE_SOFT_LIMIT) {
+      for (const ChunkCoord &left : prepared->visibility.getLeftChunks()) {
+        context.state.chunk_cache.evict(left.x, left.y, left.z);
+      }
+    }
+
   } else {
     // === DYNAMIC / SPRITE MODE ===
     // Proceed using the existing Sprite Batch session
-    for (const VisibleChunk &vc : chunk_visibility_.getVisibleChunks()) {
+    // Floors end_z..floor-1 are drawn over this one: skip tiles they hide
+    const bool occluded_floor = floor > floor_range.end_z;
+    FloorCoverage::Rows hidden_rows;
+
+    for (const VisibleChunk &vc : visible_chunks) {
       Domain::Chunk *chunk = vc.chunk;
       ChunkRenderingStrategy::Context chunk_ctx(
           context.state, context.anim_ticks, context.missing_sprites_buffer,
           tiles_rendered, floor, floor_offset, *chunk);
 
+      const FloorCoverage::Rows *hidden = nullptr;
+      if (occluded_floor &&
+          floor_coverage_->computeOccluded(context.map, *chunk, floor,
+                                           floor_range.end_z,
+                                           context.current_floor, hidden_rows)) {
+        hidden = &hidden_rows;
+      }
+
       // Render using dynamic sprite queuing (CPU heavy, GPU batched)
-      chunk_strategy_->renderDynamic(*chunk, chunk_ctx);
+      chunk_strategy_->renderDynamic(*chunk, chunk_ctx, hidden);
     }
   }
 
   // Process Waypoints
-  frame_data_collector_.collectWaypoints(context.map, floor, floor_bounds,
-                                         context.state.overlay_collector,
-                                         *context.view_settings, floor_offset);
+  if (prepared) {
+    context.state.overlay_collector.merge(prepared->waypoints);
+  } else {
+    frame_data_collector_.collectWaypoints(
+        context.map, floor, floor_bounds, context.state.overlay_collector,
+        *context.view_settings, floor_offset);
+  }
 
   // Render Spawn Overlays (Radius Tints & Indicators)
   // Check LOD Policy: Should we show detailed spawn tints?
@@ -208,9 +257,96 @@ void TerrainPass::renderMainFloor(const RenderContext &context, int floor) {
   if (show_spawn_overlays && context.view_settings->show_spawns &&
       context.view_settings->show_spawn_radius && spawn_renderer_) {
 
-    spawn_renderer_->renderFromCollector(context.state.overlay_collector, floor,
-                                         floor_offset, 1.0f);
+    spawn_renderer_->renderFromCollector(
+        context.state.overlay_collector, floor, floor_offset, 1.0f,
+        prepared ? &prepared->spawn_tint : nullptr);
   }
 }
+
+void TerrainPass::renderImpostors(
+    const RenderContext &context,
+    const std::vector<VisibleChunk> &visible_chunks, int floor,
+    float floor_offset, int &tiles_rendered) {
+  ChunkSpriteCache &chunk_cache = context.state.chunk_cache;
+  ChunkImpostorCache &impostor_cache = context.state.impostor_cache;
+  const uint64_t generation = chunk_cache.getGlobalGeneration();
+  const int8_t z = static_cast<int8_t>(floor);
+  const auto &atlas = sprite_manager_.getAtlasManager();
+  auto &lut = sprite_manager_.getSpriteLUT();
+
+  impostor_draws_.clear();
+  bool building = false;
+
+  for (const VisibleChunk &vc : visible_chunks) {
+    const Domain::Chunk &chunk = *vc.chunk;
+    const int32_t chunk_x = chunk.world_x / Domain::Chunk::SIZE;
+    const int32_t chunk_y = chunk.world_y / Domain::Chunk::SIZE;
+    const uint32_t revision = chunk.getRevision();
+
+    const ChunkImpostorCache::Impostor *impostor = impostor_cache.find(
+        chunk_x, chunk_y, z, revision, generation, floor_offset);
+
+    if (!impostor && impostor_builds_left_ > 0) {
+      // Rasterize from the cached VBO once it reflects this revision and
+      // all of its sprites are still in the atlas
+      ChunkSpriteCache::CachedChunk *cached =
+          chunk_cache.get(chunk_x, chunk_y, z);
+      if (cached && cached->vbo && cached->generation >= generation &&
+          cached->revision == revision &&
+          cached->floor_offset == floor_offset) {
+        if (!chunk_strategy_->touchCachedSprites(cached)) {
+          // Evicted sprites would rasterize as holes; the fallback path
+          // regenerates the chunk and reloads them
+          chunk_cache.invalidate(chunk_x, chunk_y, z);
+        } else {
+          if (!building) {
+            building = impostor_renderer_->beginBuilds(atlas, lut);
+          }
+          if (building) {
+            impostor = impostor_renderer_->build(
+                impostor_cache, chunk_x, chunk_y, z, *cached, revision,
+                generation, floor_offset, atlas, lut);
+            --impostor_builds_left_;
+          }
+        }
+      }
+    }
+
+    impostor_draws_.emplace_back(&vc, impostor);
+  }
+
+  if (building) {
+    impostor_renderer_->endBuilds(impostor_cache);
+  }
+
+  // Draw in visible order so chunks without a current impostor (new, edited
+  // or no free cell) overlap their neighbours like the rest. Each run of
+  // impostors is one instanced draw; each run of fallback chunks goes
+  // through the cached VBO path, which also prepares them for next frame.
+  for (size_t i = 0; i < impostor_draws_.size();) {
+    if (impostor_draws_[i].second) {
+      for (; i < impostor_draws_.size() && impostor_draws_[i].second; ++i) {
+        const Domain::Chunk &chunk = *impostor_draws_[i].first->chunk;
+        impostor_renderer_->queue(
+            *impostor_draws_[i].second,
+            chunk.world_x * Config::Rendering::TILE_SIZE - floor_offset,
+            chunk.world_y * Config::Rendering::TILE_SIZE - floor_offset);
+      }
+      impostor_renderer_->flush(impostor_cache, context.mvp_matrix);
+      continue;
+    }
+
+    sprite_batch_.beginTileBatch(context.mvp_matrix, atlas, lut);
+    for (; i < impostor_draws_.size() && !impostor_draws_[i].second; ++i) {
+      const Domain::Chunk &chunk = *impostor_draws_[i].first->chunk;
+      ChunkRenderingStrategy::Context chunk_ctx(
+          context.state, context.anim_ticks, context.missing_sprites_buffer,
+          tiles_rendered, floor, floor_offset, chunk);
+      chunk_strategy_->renderCached(chunk, chunk_ctx);
+    }
+    sprite_batch_.endTileBatch();
+  }
+}
+
 } // namespace Rendering
 } // namespace MapEditor
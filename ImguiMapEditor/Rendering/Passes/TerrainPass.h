@@ -1,7 +1,10 @@
 #pragma once
 
 #include "Rendering/Core/IRenderPass.h"
+#include "Rendering/Tile/ChunkImpostorCache.h"
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace MapEditor {
 
@@ -17,7 +20,10 @@ class SpriteBatch;
 class ShadeRenderer;
 class SpawnTintPass;
 class ChunkRenderingStrategy;
+class ChunkImpostorRenderer;
+class FloorCoverage;
 class FrameDataCollector;
+struct VisibleChunk;
 
 /**
  * Main rendering pass for the map terrain.
@@ -56,9 +62,24 @@ private:
   std::unique_ptr<ShadeRenderer> shade_renderer_;
   std::unique_ptr<SpawnTintPass> spawn_renderer_;
   std::unique_ptr<ChunkRenderingStrategy> chunk_strategy_;
+  std::unique_ptr<ChunkImpostorRenderer> impostor_renderer_;
+  std::unique_ptr<FloorCoverage> floor_coverage_;
+
+  // Impostor rasterizations left this frame (shared by all floors)
+  int impostor_builds_left_ = 0;
+  // Visible chunks in draw order with their impostor; chunks without one
+  // (nullptr) are drawn from cached VBOs
+  std::vector<std::pair<const VisibleChunk *,
+                        const ChunkImpostorCache::Impostor *>>
+      impostor_draws_;
 
   // Helper for rendering a single floor
   void renderMainFloor(const RenderContext &context, int floor);
+
+  // Far-zoom path: impostor quads, cached VBOs for chunks without one
+  void renderImpostors(const RenderContext &context,
+                       const std::vector<VisibleChunk> &visible_chunks,
+                       int floor, float floor_offset, int &tiles_rendered);
 };
 
 } // namespace Rendering
@@ -4,6 +4,7 @@
 #include "Rendering/Visibility/FloorIterator.h"
 #include "Services/ClientDataService.h"
 #include "Services/ViewSettings.h"
+#include <algorithm>
 #include <glad/glad.h>
 #include <spdlog/spdlog.h>
 
@@ -80,17 +81,13 @@ bool WallOutlineRenderer::isWallItem(const Domain::ItemType &type) const {
          !type.hasFlag(Domain::ItemFlag::Moveable) && type.top_order != 0;
 }
 
-bool WallOutlineRenderer::tileHasWall(const Domain::ChunkedMap &map, int x,
-                                      int y, int z) const {
-  Domain::Position pos(x, y, static_cast<int16_t>(z));
-  const Domain::Tile *tile = map.getTile(pos);
+bool WallOutlineRenderer::tileHasWall(const Domain::Tile *tile) const {
   if (!tile)
     return false;
 
   for (const auto &item : tile->getItems()) {
     const Domain::ItemType *type =
-        client_data_ ? client_data_->getItemTypeByServerId(item->getServerId())
-                     : nullptr;
+        client_data_->getItemTypeByServerId(item->getServerId());
     if (type && isWallItem(*type)) {
       return true;
     }
@@ -98,6 +95,32 @@ bool WallOutlineRenderer::tileHasWall(const Domain::ChunkedMap &map, int x,
   return false;
 }
 
+uint32_t WallOutlineRenderer::wallRow(const Domain::Chunk *chunk,
+                                      int local_y) const {
+  uint32_t bits = 0;
+  if (!chunk)
+    return bits;
+  for (int x = 0; x < CHUNK_SIZE; ++x) {
+    if (tileHasWall(chunk->getTileUnsafe(x, local_y))) {
+      bits |= 1u << x;
+    }
+  }
+  return bits;
+}
+
+uint32_t WallOutlineRenderer::wallColumn(const Domain::Chunk *chunk,
+                                         int local_x) const {
+  uint32_t bits = 0;
+  if (!chunk)
+    return bits;
+  for (int y = 0; y < CHUNK_SIZE; ++y) {
+    if (tileHasWall(chunk->getTileUnsafe(local_x, y))) {
+      bits |= 1u << y;
+    }
+  }
+  return bits;
+}
+
 void WallOutlineRenderer::addQuad(float x, float y, float w, float h, float r,
                                   float g, float b, float a) {
   // Two triangles forming a quad
@@ -145,28 +168,79 @@ void WallOutlineRenderer::addQuad(float x, float y, float w, float h, float r,
                                               });
 }
 
-void WallOutlineRenderer::addLine(float x1, float y1, float x2, float y2,
-                                  float r, float g, float b, float a) {
-  line_vertices_.insert(line_vertices_.end(), {
-                                                  x1,
-                                                  y1,
-                                                  r,
-                                                  g,
-                                                  b,
-                                                  a,
-                                                  x2,
-                                                  y2,
-                                                  r,
-                                                  g,
-                                                  b,
-                                                  a,
-                                              });
+void WallOutlineRenderer::addLine(std::vector<float> &vertices, float x1,
+                                  float y1, float x2, float y2, float r,
+                                  float g, float b, float a) {
+  vertices.insert(vertices.end(), {x1, y1, r, g, b, a, x2, y2, r, g, b, a});
+}
+
+void WallOutlineRenderer::buildChunkWalls(ChunkWalls &walls,
+                                          const Domain::Chunk &chunk,
+                                          const Domain::Chunk *right,
+                                          const Domain::Chunk *below,
+                                          float floor_offset) {
+  const uint32_t revision = chunk.getRevision();
+  const uint32_t right_revision = right ? right->getRevision() : 0;
+  const uint32_t bottom_revision = below ? below->getRevision() : 0;
+
+  // Only rescan the parts whose source chunk changed
+  if (!walls.built || walls.revision != revision) {
+    for (int y = 0; y < CHUNK_SIZE; ++y) {
+      walls.rows[y] = wallRow(&chunk, y);
+    }
+    walls.revision = revision;
+  }
+  if (!walls.built || walls.right_revision != right_revision) {
+    walls.right_column = wallColumn(right, 0);
+    walls.right_revision = right_revision;
+  }
+  if (!walls.built || walls.bottom_revision != bottom_revision) {
+    walls.bottom_row = wallRow(below, 0);
+    walls.bottom_revision = bottom_revision;
+  }
+  walls.built = true;
+
+  // Connections run from each wall tile to its +X and +Y wall neighbours
+  std::vector<float> &lines = walls.line_vertices;
+  lines.clear();
+  const float half = TILE_SIZE / 2.0f;
+  for (int y = 0; y < CHUNK_SIZE; ++y) {
+    const uint32_t row = walls.rows[y];
+    if (row == 0)
+      continue;
+
+    const uint32_t right_bit = (walls.right_column >> y) & 1u;
+    const uint32_t right_links =
+        row & ((row >> 1) | (right_bit << (CHUNK_SIZE - 1)));
+    const uint32_t next_row =
+        (y + 1 < CHUNK_SIZE) ? walls.rows[y + 1] : walls.bottom_row;
+    const uint32_t down_links = row & next_row;
+
+    const float center_y =
+        (chunk.world_y + y) * TILE_SIZE - floor_offset + half;
+    for (int x = 0; x < CHUNK_SIZE; ++x) {
+      const uint32_t bit = 1u << x;
+      if (!((right_links | down_links) & bit))
+        continue;
+
+      const float center_x =
+          (chunk.world_x + x) * TILE_SIZE - floor_offset + half;
+      if (right_links & bit) {
+        addLine(lines, center_x, center_y, center_x + TILE_SIZE, center_y,
+                YELLOW_R, YELLOW_G, YELLOW_B, YELLOW_A);
+      }
+      if (down_links & bit) {
+        addLine(lines, center_x, center_y, center_x, center_y + TILE_SIZE,
+                YELLOW_R, YELLOW_G, YELLOW_B, YELLOW_A);
+      }
+    }
+  }
 }
 
 void WallOutlineRenderer::collectData(const Domain::ChunkedMap &map,
-                                      int start_x, int start_y, int end_x,
-                                      int end_y, int floor_z,
-                                      float floor_offset) {
+                                      int start_chunk_x, int start_chunk_y,
+                                      int end_chunk_x, int end_chunk_y,
+                                      int floor_z, float floor_offset) {
   line_vertices_.clear();
   quad_vertices_.clear();
 
@@ -175,51 +249,40 @@ void WallOutlineRenderer::collectData(const Domain::ChunkedMap &map,
 
   // Reserve some space
   line_vertices_.reserve(Config::Performance::WALL_VERTICES_RESERVE);
+  ++collect_count_;
 
-  // Scan all visible tiles for wall items
-  for (int y = start_y; y < end_y; ++y) {
-    for (int x = start_x; x < end_x; ++x) {
-      Domain::Position pos(x, y, static_cast<int16_t>(floor_z));
-      const Domain::Tile *tile = map.getTile(pos);
-      if (!tile)
+  const int16_t z = static_cast<int16_t>(floor_z);
+  for (int cy = start_chunk_y; cy <= end_chunk_y; ++cy) {
+    for (int cx = start_chunk_x; cx <= end_chunk_x; ++cx) {
+      const Domain::Chunk *chunk = map.getChunk(cx, cy, z);
+      if (!chunk)
         continue;
 
-      float screen_x = x * TILE_SIZE - floor_offset;
-      float screen_y = y * TILE_SIZE - floor_offset;
-
-      bool has_wall = false;
-
-      // Check all stacked items on this tile for walls
-      for (const auto &item : tile->getItems()) {
-        const Domain::ItemType *type =
-            client_data_->getItemTypeByServerId(item->getServerId());
-        if (type && isWallItem(*type)) {
-          has_wall = true;
-          break;
-        }
+      ChunkWalls &walls = chunk_walls_[makeKey(cx, cy, floor_z)];
+      walls.last_used = collect_count_;
+
+      const Domain::Chunk *right = map.getChunk(cx + 1, cy, z);
+      const Domain::Chunk *below = map.getChunk(cx, cy + 1, z);
+      const bool stale =
+          !walls.built || walls.revision != chunk->getRevision() ||
+          walls.right_revision != (right ? right->getRevision() : 0) ||
+          walls.bottom_revision != (below ? below->getRevision() : 0);
+      if (stale) {
+        buildChunkWalls(walls, *chunk, right, below, floor_offset);
       }
 
-      // Add yellow lines for wall connections
-      // Only check +X and +Y to avoid duplicates
-      if (has_wall) {
-        float center_x = screen_x + TILE_SIZE / 2.0f;
-        float center_y = screen_y + TILE_SIZE / 2.0f;
-
-        // Check neighbor at (x+1, y)
-        if (tileHasWall(map, x + 1, y, floor_z)) {
-          float neighbor_center_x =
-              (x + 1) * TILE_SIZE - floor_offset + TILE_SIZE / 2.0f;
-          addLine(center_x, center_y, neighbor_center_x, center_y, YELLOW_R,
-                  YELLOW_G, YELLOW_B, YELLOW_A);
-        }
-
-        // Check neighbor at (x, y+1)
-        if (tileHasWall(map, x, y + 1, floor_z)) {
-          float neighbor_center_y =
-              (y + 1) * TILE_SIZE - floor_offset + TILE_SIZE / 2.0f;
-          addLine(center_x, center_y, center_x, neighbor_center_y, YELLOW_R,
-                  YELLOW_G, YELLOW_B, YELLOW_A);
-        }
+      line_vertices_.insert(line_vertices_.end(), walls.line_vertices.begin(),
+                            walls.line_vertices.end());
+    }
+  }
+
+  // Drop chunks that scrolled out of view once the cache grows large
+  if (chunk_walls_.size() > Config::Performance::WALL_CHUNK_CACHE_LIMIT) {
+    for (auto it = chunk_walls_.begin(); it != chunk_walls_.end();) {
+      if (it->second.last_used != collect_count_) {
+        it = chunk_walls_.erase(it);
+      } else {
+        ++it;
       }
     }
   }
@@ -246,24 +309,38 @@ void WallOutlineRenderer::render(const RenderContext &context) {
   if (!initialized_)
     return;
 
+  // Chunks covering the visible tiles; panning inside them changes nothing
+  const int start_chunk_x = std::max(0, start_x) / CHUNK_SIZE;
+  const int start_chunk_y = std::max(0, start_y) / CHUNK_SIZE;
+  const int end_chunk_x = std::max(0, end_x - 1) / CHUNK_SIZE;
+  const int end_chunk_y = std::max(0, end_y - 1) / CHUNK_SIZE;
+
   // Check cache
   bool cache_valid = (map.getRevision() == last_revision_) &&
-                     (floor_z == last_floor_) && (start_x == last_start_x_) &&
-                     (start_y == last_start_y_) && (end_x == last_end_x_) &&
-                     (end_y == last_end_y_) &&
+                     (floor_z == last_floor_) &&
+                     (start_chunk_x == last_start_chunk_x_) &&
+                     (start_chunk_y == last_start_chunk_y_) &&
+                     (end_chunk_x == last_end_chunk_x_) &&
+                     (end_chunk_y == last_end_chunk_y_) &&
                      (floor_offset == last_floor_offset_);
 
   if (!cache_valid) {
+    // Per-chunk geometry is keyed by floor, not offset
+    if (floor_offset != last_floor_offset_) {
+      chunk_walls_.clear();
+    }
+
     // Collect overlay data
-    collectData(map, start_x, start_y, end_x, end_y, floor_z, floor_offset);
+    collectData(map, start_chunk_x, start_chunk_y, end_chunk_x, end_chunk_y,
+                floor_z, floor_offset);
 
     // Update cache state
     last_revision_ = map.getRevision();
     last_floor_ = floor_z;
-    last_start_x_ = start_x;
-    last_start_y_ = start_y;
-    last_end_x_ = end_x;
-    last_end_y_ = end_y;
+    last_start_chunk_x_ = start_chunk_x;
+    last_start_chunk_y_ = start_chunk_y;
+    last_end_chunk_x_ = end_chunk_x;
+    last_end_chunk_y_ = end_chunk_y;
     last_floor_offset_ = floor_offset;
 
     // Upload to VBOs (GL_STATIC_DRAW since we cache it until change)
@@ -5,7 +5,9 @@
 #include "Rendering/Core/GLHandle.h"
 #include "Rendering/Core/IRenderPass.h"
 #include "Rendering/Core/Shader.h"
+#include <array>
 #include <glm/glm.hpp>
+#include <unordered_map>
 #include <vector>
 
 namespace MapEditor {
@@ -26,6 +28,10 @@ namespace Rendering {
  *    (Unpassable + BlockMissiles + !Moveable + top_order!=0)
  *
  * Rendered as an overlay after sprite batch, with blending enabled.
+ *
+ * Wall bits and line vertices are cached per chunk and rebuilt only when the
+ * chunk or the neighbours its border bits come from change revision, so a
+ * map edit or a pan rescans only the affected chunks.
  */
 class WallOutlineRenderer : public IRenderPass {
 public:
@@ -50,6 +56,30 @@ public:
 
 private:
   static constexpr float TILE_SIZE = Config::Rendering::TILE_SIZE;
+  static constexpr int CHUNK_SIZE = Domain::Chunk::SIZE;
+
+  /**
+   * Cached wall data for one chunk on one floor.
+   * Bit x of rows[y] is set when local tile (x, y) has a wall. The border
+   * holds the first column of the chunk to the right and the first row of
+   * the chunk below, the only neighbours connection lines reach.
+   */
+  struct ChunkWalls {
+    std::array<uint32_t, CHUNK_SIZE> rows{};
+    uint32_t right_column = 0; // Bit y: wall at local (CHUNK_SIZE, y)
+    uint32_t bottom_row = 0;   // Bit x: wall at local (x, CHUNK_SIZE)
+
+    // Revisions the bits were built from (0 = chunk absent)
+    uint32_t revision = 0;
+    uint32_t right_revision = 0;
+    uint32_t bottom_revision = 0;
+
+    std::vector<float> line_vertices; // x, y, r, g, b, a per vertex
+    uint32_t last_used = 0;
+    bool built = false;
+  };
+
+  static_assert(CHUNK_SIZE <= 32, "Wall rows are stored as 32-bit masks");
 
   // Colors (RGBA)
   static constexpr float ORANGE_R = Config::Rendering::WALL_HOOK_COLOR_R;
@@ -73,15 +103,29 @@ private:
   bool isWallItem(const Domain::ItemType &type) const;
 
   /**
-   * Check if a tile at (x, y, z) contains a wall item.
+   * Check if a tile contains a wall item.
    */
-  bool tileHasWall(const Domain::ChunkedMap &map, int x, int y, int z) const;
+  bool tileHasWall(const Domain::Tile *tile) const;
 
   /**
-   * Collect overlay data by scanning visible tiles.
+   * Wall bits of one row / column of a chunk (0 if the chunk is absent).
    */
-  void collectData(const Domain::ChunkedMap &map, int start_x, int start_y,
-                   int end_x, int end_y, int floor_z, float floor_offset);
+  uint32_t wallRow(const Domain::Chunk *chunk, int local_y) const;
+  uint32_t wallColumn(const Domain::Chunk *chunk, int local_x) const;
+
+  /**
+   * Rebuild a chunk's wall bits (as needed) and its line vertices.
+   */
+  void buildChunkWalls(ChunkWalls &walls, const Domain::Chunk &chunk,
+                       const Domain::Chunk *right, const Domain::Chunk *below,
+                       float floor_offset);
+
+  /**
+   * Collect overlay data for the chunks covering the visible tiles.
+   */
+  void collectData(const Domain::ChunkedMap &map, int start_chunk_x,
+                   int start_chunk_y, int end_chunk_x, int end_chunk_y,
+                   int floor_z, float floor_offset);
 
   /**
    * Add a quad (2 triangles) to the vertex buffer.
@@ -90,10 +134,19 @@ private:
                float a);
 
   /**
-   * Add a line segment to the line vertex buffer.
+   * Add a line segment to a line vertex buffer.
    */
-  void addLine(float x1, float y1, float x2, float y2, float r, float g,
-               float b, float a);
+  static void addLine(std::vector<float> &vertices, float x1, float y1,
+                      float x2, float y2, float r, float g, float b, float a);
+
+  static uint64_t makeKey(int32_t chunk_x, int32_t chunk_y, int z) {
+    // Same packing as ChunkSpriteCache: 24 bits x, 24 bits y, 8 bits floor
+    uint64_t key = 0;
+    key |= (static_cast<uint64_t>(chunk_x + 0x800000) & 0xFFFFFF) << 32;
+    key |= (static_cast<uint64_t>(chunk_y + 0x800000) & 0xFFFFFF) << 8;
+    key |= static_cast<uint64_t>(z & 0xFF);
+    return key;
+  }
 
   // Services (not owned)
   Services::ClientDataService *client_data_ = nullptr;
@@ -107,19 +160,23 @@ private:
   DeferredVAOHandle line_vao_;
   DeferredVBOHandle line_vbo_;
 
-  // Per-frame vertex data
+  // Vertex data of the visible chunks, uploaded when it changes
   std::vector<float> quad_vertices_; // x, y, r, g, b, a per vertex
   std::vector<float> line_vertices_; // x, y, r, g, b, a per vertex
 
+  // Per-chunk wall cache
+  std::unordered_map<uint64_t, ChunkWalls> chunk_walls_;
+  uint32_t collect_count_ = 0;
+
   bool initialized_ = false;
 
   // Cache tracking
   uint32_t last_revision_ = 0;
   int last_floor_ = -128;
-  int last_start_x_ = -1;
-  int last_start_y_ = -1;
-  int last_end_x_ = -1;
-  int last_end_y_ = -1;
+  int last_start_chunk_x_ = -1;
+  int last_start_chunk_y_ = -1;
+  int last_end_chunk_x_ = -1;
+  int last_end_chunk_y_ = -1;
   float last_floor_offset_ = 0.0f;
 };
 
@@ -29,15 +29,9 @@ bool AtlasManager::ensureInitialized() {
 
 const AtlasRegion *AtlasManager::addSprite(uint32_t sprite_id,
                                            const uint8_t *rgba_data) {
-  // Fast check via direct lookup for common sprites
-  if (sprite_id < DIRECT_LOOKUP_SIZE && direct_lookup_[sprite_id] != nullptr) {
-    return direct_lookup_[sprite_id];
-  }
-
-  // Check hash map for already-added sprites
-  auto it = sprite_regions_.find(sprite_id);
-  if (it != sprite_regions_.end()) {
-    return it->second;
+  // Fast check via direct lookup / hash map for already-added sprites
+  if (const AtlasRegion *existing = getRegion(sprite_id)) {
+    return existing;
   }
 
   if (!rgba_data) {
@@ -50,6 +44,8 @@ const AtlasRegion *AtlasManager::addSprite(uint32_t sprite_id,
     return nullptr;
   }
 
+  makeRoom();
+
   // Add to texture array
   auto region = atlas_.addSprite(rgba_data);
   if (!region.has_value()) {
@@ -57,78 +53,179 @@ const AtlasRegion *AtlasManager::addSprite(uint32_t sprite_id,
     return nullptr;
   }
 
-  // Store in stable deque
-  region_storage_.push_back(*region);
-  AtlasRegion *ptr = &region_storage_.back();
-
-  // Store pointer in hash map
-  auto [inserted_it, success] = sprite_regions_.emplace(sprite_id, ptr);
-  if (!success) {
-    spdlog::error("Failed to store region for sprite {}", sprite_id);
-    return nullptr;
-  }
+  return store(sprite_id, *region);
+}
 
-  // Also store in direct lookup for O(1) access
-  if (sprite_id < DIRECT_LOOKUP_SIZE) {
-    direct_lookup_[sprite_id] = ptr;
+bool AtlasManager::updateSprite(uint32_t sprite_id,
+                                const uint8_t *rgba_data) {
+  const AtlasRegion *region = getRegion(sprite_id);
+  if (!region) {
+    return false;
   }
-
-  return ptr;
+  return atlas_.updateSprite(*region, rgba_data);
 }
 
 const AtlasRegion *AtlasManager::addSpriteFromPBO(uint32_t sprite_id,
                                                   const uint8_t *pbo_offset) {
   // Fast check via direct lookup
-  if (sprite_id < DIRECT_LOOKUP_SIZE && direct_lookup_[sprite_id] != nullptr) {
-    return direct_lookup_[sprite_id];
-  }
-
-  auto it = sprite_regions_.find(sprite_id);
-  if (it != sprite_regions_.end()) {
-    return it->second;
+  if (const AtlasRegion *existing = getRegion(sprite_id)) {
+    return existing;
   }
 
   if (!ensureInitialized()) {
     return nullptr;
   }
 
+  makeRoom();
+
   auto region = atlas_.addSpriteFromPBO(pbo_offset);
   if (!region.has_value()) {
     spdlog::error("Failed to add sprite {} via PBO", sprite_id);
     return nullptr;
   }
 
-  // Store in stable deque
-  region_storage_.push_back(*region);
-  AtlasRegion *ptr = &region_storage_.back();
+  return store(sprite_id, *region);
+}
 
-  auto [inserted_it, success] = sprite_regions_.emplace(sprite_id, ptr);
-  if (!success) {
-    spdlog::error("Failed to store region for sprite {}", sprite_id);
-    return nullptr;
+const AtlasRegion *AtlasManager::store(uint32_t sprite_id,
+                                       const AtlasRegion &region) {
+  // Reuse the entry of an evicted sprite, else append to the stable deque
+  ResidentSprite *entry = nullptr;
+  if (!free_entries_.empty()) {
+    entry = free_entries_.back();
+    free_entries_.pop_back();
+  } else {
+    entry = &region_storage_.emplace_back();
+  }
+  *entry = ResidentSprite{region, sprite_id, frame_, frame_, false, true};
+  age_queue_.push_back(entry);
+
+  SpriteEntry &record = table_.at(sprite_id);
+  record.sprite = entry;
+  record.status = SpriteStatus::None;
+  ++resident_count_;
+
+  if (!recently_evicted_.empty()) {
+    auto evicted = recently_evicted_.find(sprite_id);
+    if (evicted != recently_evicted_.end()) {
+      if (frame_ - evicted->second <=
+          Config::Performance::ATLAS_THRASH_WINDOW_FRAMES) {
+        ++thrash_reloads_;
+      }
+      recently_evicted_.erase(evicted);
+    }
+  }
+
+  return &entry->region;
+}
+
+void AtlasManager::makeRoom() {
+  if (!atlas_.needsNewLayer() ||
+      atlas_.getLayerCount() < Config::Performance::ATLAS_RESIDENT_LAYERS) {
+    return;
+  }
+
+  const size_t evicted =
+      evictColdSprites(Config::Performance::ATLAS_EVICTION_BATCH);
+  if (evicted == 0) {
+    spdlog::debug("AtlasManager: No cold sprites to evict, growing atlas "
+                  "beyond {} layers",
+                  Config::Performance::ATLAS_RESIDENT_LAYERS);
   }
+}
 
-  if (sprite_id < DIRECT_LOOKUP_SIZE) {
-    direct_lookup_[sprite_id] = ptr;
+size_t AtlasManager::evictColdSprites(size_t count) {
+  // Walk the cold front of the age queue. Stamps only grow, so once the
+  // front was queued too recently nothing behind it is old enough either.
+  std::vector<ResidentSprite *> candidates;
+  while (candidates.size() < count && !age_queue_.empty()) {
+    ResidentSprite *entry = age_queue_.front();
+    if (frame_ - entry->queued <
+        Config::Performance::ATLAS_EVICTION_MIN_AGE_FRAMES) {
+      break;
+    }
+    age_queue_.pop_front();
+    if (entry->pinned) {
+      continue;
+    }
+    if (frame_ - entry->last_used <
+        Config::Performance::ATLAS_EVICTION_MIN_AGE_FRAMES) {
+      // Used since it was queued: second chance at the back
+      entry->queued = frame_;
+      age_queue_.push_back(entry);
+      continue;
+    }
+    candidates.push_back(entry);
+  }
+  if (candidates.empty()) {
+    return 0;
+  }
+
+  // Forget old thrash records so the map stays small
+  std::erase_if(recently_evicted_, [this](const auto &record) {
+    return frame_ - record.second >
+           Config::Performance::ATLAS_THRASH_WINDOW_FRAMES;
+  });
+
+  for (ResidentSprite *entry : candidates) {
+    const uint32_t sprite_id = entry->sprite_id;
+    atlas_.releaseSprite(entry->region);
+    table_.at(sprite_id).sprite = nullptr;
+    entry->live = false;
+    free_entries_.push_back(entry);
+    recently_evicted_[sprite_id] = frame_;
+    if (on_evicted_) {
+      on_evicted_(sprite_id);
+    }
   }
 
-  return ptr;
+  evictions_ += candidates.size();
+  resident_count_ -= candidates.size();
+  spdlog::debug("AtlasManager: Evicted {} cold sprites ({} resident)",
+                candidates.size(), resident_count_);
+  return candidates.size();
+}
+
+bool AtlasManager::pinSprite(uint32_t sprite_id) {
+  ResidentSprite *entry = find(sprite_id);
+  if (!entry) {
+    return false;
+  }
+  if (!entry->pinned) {
+    entry->pinned = true;
+    ++pinned_count_;
+  }
+  return true;
+}
+
+AtlasResidencyStats AtlasManager::getResidencyStats() const {
+  AtlasResidencyStats stats;
+  stats.resident = resident_count_;
+  stats.pinned = pinned_count_;
+  stats.free_slots = atlas_.getFreeSlotCount();
+  stats.layers = static_cast<size_t>(atlas_.getLayerCount());
+  stats.evictions = evictions_;
+  stats.thrash_reloads = thrash_reloads_;
+  stats.thrash_rate =
+      evictions_ > 0 ? static_cast<float>(thrash_reloads_) / evictions_ : 0.0f;
+  return stats;
 }
 
 const AtlasRegion *AtlasManager::getWhitePixel() {
-  if (sprite_regions_.count(WHITE_PIXEL_ID)) {
-    return sprite_regions_.at(WHITE_PIXEL_ID);
+  if (const AtlasRegion *region = getRegion(WHITE_PIXEL_ID)) {
+    return region;
   }
 
   // Create 32x32 white texture
   std::vector<uint8_t> white_data(32 * 32 * 4, 255);
-  return addSprite(WHITE_PIXEL_ID, white_data.data());
+  const auto *region = addSprite(WHITE_PIXEL_ID, white_data.data());
+  pinSprite(WHITE_PIXEL_ID);
+  return region;
 }
 
 const AtlasRegion *AtlasManager::getInvalidItemPlaceholder() {
-  auto it = sprite_regions_.find(INVALID_PLACEHOLDER_ID);
-  if (it != sprite_regions_.end()) {
-    return it->second;
+  if (const AtlasRegion *region = getRegion(INVALID_PLACEHOLDER_ID)) {
+    return region;
   }
 
   // Create 32x32 RGBA red square with some transparency
@@ -146,6 +243,7 @@ const AtlasRegion *AtlasManager::getInvalidItemPlaceholder() {
   const auto *region = addSprite(INVALID_PLACEHOLDER_ID, rgba.data());
 
   if (region) {
+    pinSprite(INVALID_PLACEHOLDER_ID);
     spdlog::debug("AtlasManager: Created invalid item placeholder sprite");
   } else {
     spdlog::warn("AtlasManager: Failed to create invalid item placeholder sprite");
@@ -155,10 +253,7 @@ const AtlasRegion *AtlasManager::getInvalidItemPlaceholder() {
 }
 
 bool AtlasManager::hasSprite(uint32_t sprite_id) const {
-  if (sprite_id < DIRECT_LOOKUP_SIZE) {
-    return direct_lookup_[sprite_id] != nullptr;
-  }
-  return sprite_regions_.find(sprite_id) != sprite_regions_.end();
+  return find(sprite_id) != nullptr;
 }
 
 void AtlasManager::bind(uint32_t slot) const { atlas_.bind(slot); }
@@ -173,9 +268,9 @@ void AtlasManager::forEachSprite(
     std::function<void(uint32_t, const AtlasRegion &)> callback) const {
   if (!callback)
     return;
-  for (const auto &[id, region] : sprite_regions_) {
-    if (region) {
-      callback(id, *region);
+  for (const ResidentSprite &entry : region_storage_) {
+    if (entry.live) {
+      callback(entry.sprite_id, entry.region);
     }
   }
 }
@@ -183,8 +278,12 @@ void AtlasManager::forEachSprite(
 void AtlasManager::clear() {
   atlas_ = TextureAtlas();
   region_storage_.clear();
-  sprite_regions_.clear();
-  std::fill(direct_lookup_.begin(), direct_lookup_.end(), nullptr);
+  free_entries_.clear();
+  age_queue_.clear();
+  table_.reset(); // Keeps pages, they are sized for the same sprite file
+  resident_count_ = 0;
+  pinned_count_ = 0;
+  recently_evicted_.clear();
   spdlog::debug("AtlasManager cleared");
 }
 
@@ -1,4 +1,5 @@
 #pragma once
+#include "Rendering/Resources/SpriteTable.h"
 #include "Rendering/Resources/TextureAtlas.h"
 #include <cstdint>
 #include <deque>
@@ -9,16 +10,53 @@
 namespace MapEditor {
 namespace Rendering {
 
+/**
+ * Load status of a sprite that is not in the atlas.
+ */
+enum class SpriteStatus : uint8_t {
+  None,    // Not requested (or resident)
+  Pending, // Load requested, waiting for upload
+  Failed   // Load failed; not requested again until the cache is cleared
+};
+
+/**
+ * Residency counters for the sprite atlas.
+ */
+struct AtlasResidencyStats {
+  size_t resident = 0;        // Sprites currently in the atlas
+  size_t pinned = 0;          // Sprites that are never evicted
+  size_t free_slots = 0;      // Released slots waiting for reuse
+  size_t layers = 0;          // Layers in use
+  uint64_t evictions = 0;     // Sprites evicted since start
+  uint64_t thrash_reloads = 0; // Evicted sprites added back shortly after
+  float thrash_rate = 0.0f;   // thrash_reloads / evictions
+};
+
 /**
  * Manages a single texture array atlas and provides sprite → region lookup.
  *
  * Uses a single GL_TEXTURE_2D_ARRAY that expands automatically as needed.
- * Sprites are stored by their sprite_id for O(1) lookup during rendering.
+ * Sprites are stored by their sprite_id in a directly indexed SpriteTable,
+ * which also tracks load status and per-frame missing reports, so the render
+ * hot path never hashes.
+ *
+ * RESIDENCY:
+ * - Every sprite carries the frame it was last looked up or touched. The
+ *   stamp is the only state lookups write, so they stay const.
+ * - Once ATLAS_RESIDENT_LAYERS layers are full, adding a sprite first
+ *   evicts a batch of sprites not used for ATLAS_EVICTION_MIN_AGE_FRAMES;
+ *   their slots are reused before any new layer is opened. Pinned sprites
+ *   are never evicted.
+ * - Candidates come from an age queue ordered by the frame each sprite was
+ *   queued. A sprite used since it was queued moves to the back instead of
+ *   being evicted (second chance), so a batch only visits the cold front
+ *   of the queue rather than every resident sprite.
+ * - Region pointers stay valid until their sprite is evicted. Callers that
+ *   keep a region across frames must pin the sprite.
  */
 class AtlasManager {
 public:
-  // Max sprite ID for O(1) direct lookup (covers most Tibia sprites)
-  static constexpr uint32_t DIRECT_LOOKUP_SIZE = 100000;
+  using EvictionCallback = std::function<void(uint32_t sprite_id)>;
 
   AtlasManager() = default;
   ~AtlasManager() = default;
@@ -41,21 +79,115 @@ public:
   const AtlasRegion *addSprite(uint32_t sprite_id, const uint8_t *rgba_data);
 
   /**
-   * Get the atlas region for an already-added sprite.
-   * Uses O(1) array lookup for sprite_id < DIRECT_LOOKUP_SIZE, hash otherwise.
+   * Replace the pixels of an already-added sprite in place.
+   * The region (and pointers to it) stay the same.
+   * @param sprite_id Sprite ID passed to addSprite()
+   * @param rgba_data 32x32x4 bytes of RGBA pixel data
+   * @return true if the sprite exists and was updated
+   */
+  bool updateSprite(uint32_t sprite_id, const uint8_t *rgba_data);
+
+  /**
+   * Get the atlas region for an already-added sprite and mark it as used
+   * this frame.
+   * O(1) table lookup; only synthetic ids beyond the client range hash.
    * @param sprite_id Sprite ID
    * @return Pointer to region, or nullptr if sprite not found
    */
   inline const AtlasRegion *getRegion(uint32_t sprite_id) const {
-    // Fast path: direct array lookup for common sprites
-    if (sprite_id < DIRECT_LOOKUP_SIZE) {
-      return direct_lookup_[sprite_id]; // O(1)
+    const ResidentSprite *entry = find(sprite_id);
+    if (!entry) {
+      return nullptr;
+    }
+    entry->last_used = frame_;
+    return &entry->region;
+  }
+
+  /**
+   * Mark a sprite as used this frame without fetching its region.
+   * Used by cached geometry that resolves sprites on the GPU.
+   * @return true if the sprite is resident
+   */
+  inline bool touch(uint32_t sprite_id) const {
+    const ResidentSprite *entry = find(sprite_id);
+    if (!entry) {
+      return false;
+    }
+    entry->last_used = frame_;
+    return true;
+  }
+
+  /**
+   * Pre-allocate table pages for sprite ids [0, count).
+   * Call with the sprite file's sprite count.
+   */
+  void reserveSprites(uint32_t count) { table_.reserve(count); }
+
+  /**
+   * Get the load status of a sprite (None for resident sprites).
+   */
+  SpriteStatus getStatus(uint32_t sprite_id) const {
+    const SpriteEntry *entry = table_.find(sprite_id);
+    return entry ? entry->status : SpriteStatus::None;
+  }
+
+  /**
+   * Set the load status of a sprite.
+   */
+  void setStatus(uint32_t sprite_id, SpriteStatus status) {
+    table_.at(sprite_id).status = status;
+  }
+
+  /**
+   * Record that a sprite was needed but not resident this frame.
+   * @return true only for the first report of the sprite in a frame, so
+   *         callers can build duplicate-free missing lists
+   */
+  bool markMissing(uint32_t sprite_id) {
+    SpriteEntry &entry = table_.at(sprite_id);
+    if (entry.missing_frame == frame_) {
+      return false;
     }
-    // Slow path: hash lookup for rare high-ID sprites
-    auto it = sprite_regions_.find(sprite_id);
-    return it != sprite_regions_.end() ? it->second : nullptr;
+    entry.missing_frame = frame_;
+    return true;
+  }
+
+  /**
+   * Exclude a sprite from eviction (e.g. regions held across frames).
+   * @return true if the sprite exists
+   */
+  bool pinSprite(uint32_t sprite_id);
+
+  /**
+   * Advance the frame stamp used for LRU ordering.
+   * Call once per frame.
+   */
+  void beginFrame() { ++frame_; }
+
+  /**
+   * Get the current frame stamp.
+   */
+  uint32_t getFrame() const { return frame_; }
+
+  /**
+   * Get number of sprites evicted since start.
+   * Cached geometry compares it to notice that sprites it uses may be gone.
+   */
+  uint64_t getEvictionCount() const { return evictions_; }
+
+  /**
+   * Set the function called for each evicted sprite (e.g. to update the
+   * sprite LUT).
+   */
+  void setEvictionCallback(EvictionCallback callback) {
+    on_evicted_ = std::move(callback);
   }
 
+  /**
+   * Get residency counters.
+   */
+  AtlasResidencyStats getResidencyStats() const;
+
   /**
    * Check if a sprite has been added.
    */
@@ -90,7 +222,7 @@ public:
   /**
    * Get total number of sprites.
    */
-  size_t getTotalSpriteCount() const { return sprite_regions_.size(); }
+  size_t getTotalSpriteCount() const { return resident_count_; }
 
   /**
    * Clear atlas and sprite mappings.
@@ -122,19 +254,63 @@ public:
   uint64_t getAtlasVersion() const { return atlas_.getVersion(); }
 
 private:
+  // Region plus residency bookkeeping
+  struct ResidentSprite {
+    AtlasRegion region;
+    uint32_t sprite_id = 0;
+    // Frame stamp; mutable so const lookups can mark the sprite as used
+    mutable uint32_t last_used = 0;
+    uint32_t queued = 0; // Frame the sprite entered the back of age_queue_
+    bool pinned = false;
+    bool live = false; // False while the entry waits in free_entries_
+  };
+
+  // Per-id record in table_
+  struct SpriteEntry {
+    ResidentSprite *sprite = nullptr;
+    uint32_t missing_frame = 0; // Frame of the last markMissing() report
+    SpriteStatus status = SpriteStatus::None;
+  };
+
+  inline const ResidentSprite *find(uint32_t sprite_id) const {
+    const SpriteEntry *entry = table_.find(sprite_id);
+    return entry ? entry->sprite : nullptr;
+  }
+
+  inline ResidentSprite *find(uint32_t sprite_id) {
+    SpriteEntry *entry = table_.find(sprite_id);
+    return entry ? entry->sprite : nullptr;
+  }
+
   bool ensureInitialized();
 
+  // Evict cold sprites if adding one would open a layer beyond the budget
+  void makeRoom();
+  size_t evictColdSprites(size_t count);
+  const AtlasRegion *store(uint32_t sprite_id, const AtlasRegion &region);
+
   TextureAtlas atlas_;
 
-  // Use std::deque for stable storage of AtlasRegions.
-  // This ensures pointers to elements remain valid even when new elements are added (no reallocation copy).
-  std::deque<AtlasRegion> region_storage_;
+  // Use std::deque for stable storage of entries.
+  // This ensures pointers to elements remain valid even when new elements are
+  // added (no reallocation copy). Entries of evicted sprites are reused.
+  std::deque<ResidentSprite> region_storage_;
+  std::vector<ResidentSprite *> free_entries_;
+  // Every live unpinned sprite once, in order of ResidentSprite::queued;
+  // pinned sprites are dropped when they reach the front
+  std::deque<ResidentSprite *> age_queue_;
 
-  // Map stores pointers to elements in region_storage_
-  std::unordered_map<uint32_t, AtlasRegion *> sprite_regions_;
+  // Sprite id -> entry in region_storage_, load status, missing reports
+  SpriteTable<SpriteEntry> table_;
+  size_t resident_count_ = 0;
 
-  // O(1) direct lookup for sprite IDs < DIRECT_LOOKUP_SIZE
-  std::vector<const AtlasRegion *> direct_lookup_{DIRECT_LOOKUP_SIZE, nullptr};
+  uint32_t frame_ = 1; // Starts above the zero in fresh table records
+  size_t pinned_count_ = 0;
+  uint64_t evictions_ = 0;
+  uint64_t thrash_reloads_ = 0;
+  // Frame at which recently evicted sprites left, for thrash detection
+  std::unordered_map<uint32_t, uint32_t> recently_evicted_;
+  EvictionCallback on_evicted_;
 };
 
 } // namespace Rendering
@@ -0,0 +1,118 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MapEditor {
+namespace Rendering {
+
+/**
+ * Directly indexed per-sprite records.
+ *
+ * Ids below PAGED_LIMIT (primary and secondary client sprites) live in
+ * 4096-entry pages indexed by id, so a lookup is two array reads and never
+ * hashes. Pages are allocated on first write, which keeps the sparse
+ * secondary-client range cheap; reserve() pre-allocates the pages for the
+ * primary sprite file. Synthetic ids above the limit (colorized outfits,
+ * white pixel) fall back to a hash map.
+ */
+template <typename T> class SpriteTable {
+public:
+  // Covers primary (0-1M) and secondary (1M-2M) client sprites
+  static constexpr uint32_t PAGED_LIMIT = 2000000;
+
+  /**
+   * Allocate pages for ids [0, count).
+   */
+  void reserve(uint32_t count) {
+    if (count > PAGED_LIMIT) {
+      count = PAGED_LIMIT;
+    }
+    if (count == 0) {
+      return;
+    }
+    const uint32_t last_page = (count - 1) >> PAGE_BITS;
+    ensureDirectory(last_page);
+    for (uint32_t page = 0; page <= last_page; ++page) {
+      if (!pages_[page]) {
+        pages_[page] = std::make_unique<Page>();
+      }
+    }
+  }
+
+  /**
+   * Get the record for an id, or nullptr if it was never written.
+   */
+  inline const T *find(uint32_t id) const {
+    if (id < PAGED_LIMIT) {
+      const uint32_t page = id >> PAGE_BITS;
+      if (page < pages_.size() && pages_[page]) {
+        return &(*pages_[page])[id & PAGE_MASK];
+      }
+      return nullptr;
+    }
+    auto it = overflow_.find(id);
+    return it != overflow_.end() ? &it->second : nullptr;
+  }
+
+  inline T *find(uint32_t id) {
+    return const_cast<T *>(std::as_const(*this).find(id));
+  }
+
+  /**
+   * Get the record for an id, creating it (value-initialized) if needed.
+   */
+  T &at(uint32_t id) {
+    if (id < PAGED_LIMIT) {
+      const uint32_t page = id >> PAGE_BITS;
+      ensureDirectory(page);
+      if (!pages_[page]) {
+        pages_[page] = std::make_unique<Page>();
+      }
+      return (*pages_[page])[id & PAGE_MASK];
+    }
+    return overflow_[id];
+  }
+
+  /**
+   * Reset every record to its default value, keeping allocated pages.
+   */
+  void reset() {
+    for (auto &page : pages_) {
+      if (page) {
+        page->fill(T{});
+      }
+    }
+    overflow_.clear();
+  }
+
+  /**
+   * Release all pages.
+   */
+  void clear() {
+    pages_.clear();
+    overflow_.clear();
+  }
+
+private:
+  static constexpr uint32_t PAGE_BITS = 12;
+  static constexpr uint32_t PAGE_SIZE = 1u << PAGE_BITS;
+  static constexpr uint32_t PAGE_MASK = PAGE_SIZE - 1;
+
+  using Page = std::array<T, PAGE_SIZE>;
+
+  void ensureDirectory(uint32_t page) {
+    if (page >= pages_.size()) {
+      pages_.resize(page + 1);
+    }
+  }
+
+  std::vector<std::unique_ptr<Page>> pages_;
+  std::unordered_map<uint32_t, T> overflow_;
+};
+
+} // namespace Rendering
+} // namespace MapEditor
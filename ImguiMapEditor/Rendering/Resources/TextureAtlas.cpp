@@ -15,7 +15,7 @@ TextureAtlas::TextureAtlas(TextureAtlas &&other) noexcept
       allocated_layers_(other.allocated_layers_),
       total_sprite_count_(other.total_sprite_count_),
       current_layer_(other.current_layer_), next_x_(other.next_x_),
-      next_y_(other.next_y_) {
+      next_y_(other.next_y_), free_slots_(std::move(other.free_slots_)) {
   other.texture_id_ = 0;
   other.layer_count_ = 0;
   other.allocated_layers_ = 0;
@@ -35,6 +35,7 @@ TextureAtlas &TextureAtlas::operator=(TextureAtlas &&other) noexcept {
     current_layer_ = other.current_layer_;
     next_x_ = other.next_x_;
     next_y_ = other.next_y_;
+    free_slots_ = std::move(other.free_slots_);
     other.texture_id_ = 0;
     other.layer_count_ = 0;
     other.allocated_layers_ = 0;
@@ -221,46 +222,21 @@ std::optional<AtlasRegion> TextureAtlas::addSprite(const uint8_t *rgba_data) {
     return std::nullopt;
   }
 
-  // Check if current layer is full
-  if (next_y_ >= SPRITES_PER_ROW) {
-    if (!addLayer()) {
-      return std::nullopt; // Can't add more layers
-    }
+  int layer = 0;
+  int pixel_x = 0;
+  int pixel_y = 0;
+  if (!acquireSlot(layer, pixel_x, pixel_y)) {
+    return std::nullopt; // Can't add more layers
   }
 
-  // Calculate pixel position in current layer
-  int pixel_x = next_x_ * SPRITE_SIZE;
-  int pixel_y = next_y_ * SPRITE_SIZE;
-
   // Upload sprite data to texture array
   glBindTexture(GL_TEXTURE_2D_ARRAY, texture_id_);
-  glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, pixel_x, pixel_y, current_layer_,
+  glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, pixel_x, pixel_y, layer,
                   SPRITE_SIZE, SPRITE_SIZE, 1, GL_RGBA, GL_UNSIGNED_BYTE,
                   rgba_data);
   glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
 
-  // Calculate UV coordinates with half-texel inset
-  const float texel_size = 1.0f / static_cast<float>(ATLAS_SIZE);
-  const float half_texel = texel_size * 0.5f;
-
-  AtlasRegion region;
-  region.atlas_index = static_cast<uint32_t>(current_layer_);
-  region.u_min = static_cast<float>(pixel_x) / ATLAS_SIZE + half_texel;
-  region.v_min = static_cast<float>(pixel_y) / ATLAS_SIZE + half_texel;
-  region.u_max =
-      static_cast<float>(pixel_x + SPRITE_SIZE) / ATLAS_SIZE - half_texel;
-  region.v_max =
-      static_cast<float>(pixel_y + SPRITE_SIZE) / ATLAS_SIZE - half_texel;
-
-  // Advance to next slot
-  next_x_++;
-  if (next_x_ >= SPRITES_PER_ROW) {
-    next_x_ = 0;
-    next_y_++;
-  }
-  total_sprite_count_++;
-
-  return region;
+  return makeRegion(layer, pixel_x, pixel_y);
 }
 
 std::optional<AtlasRegion>
@@ -271,43 +247,105 @@ TextureAtlas::addSpriteFromPBO(const uint8_t *pbo_offset) {
     return std::nullopt;
   }
 
-  // Check if current layer is full
-  if (next_y_ >= SPRITES_PER_ROW) {
-    if (!addLayer()) {
-      return std::nullopt;
-    }
+  int layer = 0;
+  int pixel_x = 0;
+  int pixel_y = 0;
+  if (!acquireSlot(layer, pixel_x, pixel_y)) {
+    return std::nullopt;
   }
 
-  int pixel_x = next_x_ * SPRITE_SIZE;
-  int pixel_y = next_y_ * SPRITE_SIZE;
-
   // Upload from PBO (GL_PIXEL_UNPACK_BUFFER must be bound!)
   glBindTexture(GL_TEXTURE_2D_ARRAY, texture_id_);
-  glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, pixel_x, pixel_y, current_layer_,
+  glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, pixel_x, pixel_y, layer,
                   SPRITE_SIZE, SPRITE_SIZE, 1, GL_RGBA, GL_UNSIGNED_BYTE,
                   pbo_offset);
   glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
 
+  return makeRegion(layer, pixel_x, pixel_y);
+}
+
+bool TextureAtlas::acquireSlot(int &layer, int &pixel_x, int &pixel_y) {
+  if (!free_slots_.empty()) {
+    const uint32_t slot = free_slots_.top();
+    free_slots_.pop();
+    const int index = static_cast<int>(slot % SPRITES_PER_LAYER);
+    layer = static_cast<int>(slot / SPRITES_PER_LAYER);
+    pixel_x = (index % SPRITES_PER_ROW) * SPRITE_SIZE;
+    pixel_y = (index / SPRITES_PER_ROW) * SPRITE_SIZE;
+    total_sprite_count_++;
+    return true;
+  }
+
+  // Check if current layer is full
+  if (next_y_ >= SPRITES_PER_ROW) {
+    if (!addLayer()) {
+      return false;
+    }
+  }
+
+  layer = current_layer_;
+  pixel_x = next_x_ * SPRITE_SIZE;
+  pixel_y = next_y_ * SPRITE_SIZE;
+
+  // Advance to next slot
+  next_x_++;
+  if (next_x_ >= SPRITES_PER_ROW) {
+    next_x_ = 0;
+    next_y_++;
+  }
+  total_sprite_count_++;
+  return true;
+}
+
+AtlasRegion TextureAtlas::makeRegion(int layer, int pixel_x, int pixel_y) {
+  // Calculate UV coordinates with half-texel inset
   const float texel_size = 1.0f / static_cast<float>(ATLAS_SIZE);
   const float half_texel = texel_size * 0.5f;
 
   AtlasRegion region;
-  region.atlas_index = static_cast<uint32_t>(current_layer_);
+  region.atlas_index = static_cast<uint32_t>(layer);
   region.u_min = static_cast<float>(pixel_x) / ATLAS_SIZE + half_texel;
   region.v_min = static_cast<float>(pixel_y) / ATLAS_SIZE + half_texel;
   region.u_max =
       static_cast<float>(pixel_x + SPRITE_SIZE) / ATLAS_SIZE - half_texel;
   region.v_max =
       static_cast<float>(pixel_y + SPRITE_SIZE) / ATLAS_SIZE - half_texel;
+  region.slot = static_cast<uint32_t>(layer * SPRITES_PER_LAYER +
+                                      (pixel_y / SPRITE_SIZE) * SPRITES_PER_ROW +
+                                      pixel_x / SPRITE_SIZE);
+  return region;
+}
 
-  next_x_++;
-  if (next_x_ >= SPRITES_PER_ROW) {
-    next_x_ = 0;
-    next_y_++;
+bool TextureAtlas::updateSprite(const AtlasRegion &region,
+                                const uint8_t *rgba_data) {
+  if (!isValid() || !rgba_data ||
+      region.atlas_index >= static_cast<uint32_t>(layer_count_)) {
+    return false;
   }
-  total_sprite_count_++;
 
-  return region;
+  // UVs carry a half-texel inset, truncation recovers the slot origin
+  const int pixel_x = static_cast<int>(region.u_min * ATLAS_SIZE);
+  const int pixel_y = static_cast<int>(region.v_min * ATLAS_SIZE);
+
+  glBindTexture(GL_TEXTURE_2D_ARRAY, texture_id_);
+  glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, pixel_x, pixel_y,
+                  static_cast<GLint>(region.atlas_index), SPRITE_SIZE,
+                  SPRITE_SIZE, 1, GL_RGBA, GL_UNSIGNED_BYTE, rgba_data);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  return true;
+}
+
+void TextureAtlas::releaseSprite(const AtlasRegion &region) {
+  if (!isValid() ||
+      region.atlas_index >= static_cast<uint32_t>(layer_count_)) {
+    return;
+  }
+
+  const int slot_x = static_cast<int>(region.u_min * ATLAS_SIZE) / SPRITE_SIZE;
+  const int slot_y = static_cast<int>(region.v_min * ATLAS_SIZE) / SPRITE_SIZE;
+  free_slots_.push(region.atlas_index * SPRITES_PER_LAYER +
+                   static_cast<uint32_t>(slot_y * SPRITES_PER_ROW + slot_x));
+  total_sprite_count_--;
 }
 
 void TextureAtlas::bind(uint32_t slot) const {
@@ -328,6 +366,7 @@ void TextureAtlas::release() {
   current_layer_ = 0;
   next_x_ = 0;
   next_y_ = 0;
+  free_slots_ = {};
 }
 
 } // namespace Rendering
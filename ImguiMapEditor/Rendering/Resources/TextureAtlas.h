@@ -2,8 +2,11 @@
 
 #include "Core/Config.h"
 #include <cstdint>
+#include <functional>
 #include <glad/glad.h>
 #include <optional>
+#include <queue>
+#include <vector>
 
 
 namespace MapEditor {
@@ -19,6 +22,9 @@ struct AtlasRegion {
   float v_min = 0.0f;       // UV top
   float u_max = 1.0f;       // UV right
   float v_max = 1.0f;       // UV bottom
+  // Global slot: atlas_index * SPRITES_PER_LAYER + cell, row-major in the
+  // layer. Lets instance data reference the sprite without storing UVs.
+  uint32_t slot = 0;
 };
 
 /**
@@ -27,6 +33,10 @@ struct AtlasRegion {
  * Each layer holds 16384 32x32 sprites.
  *
  * This enables single-draw-call rendering by sampling layer via atlas_layer.
+ *
+ * Slots released with releaseSprite() are reused lowest first, so live
+ * sprites stay packed in the low layers and new layers are only opened when
+ * every earlier slot is taken.
  */
 class TextureAtlas {
 public:
@@ -71,6 +81,33 @@ public:
    */
   std::optional<AtlasRegion> addSpriteFromPBO(const uint8_t *pbo_offset);
 
+  /**
+   * Overwrite the pixels of a region returned by addSprite().
+   * @param region Region to update (layer and UVs are unchanged)
+   * @param rgba_data Pointer to 32*32*4 bytes of RGBA pixel data
+   * @return true if the region was updated
+   */
+  bool updateSprite(const AtlasRegion &region, const uint8_t *rgba_data);
+
+  /**
+   * Return a region's slot to the atlas for reuse.
+   * The region must not be drawn or updated afterwards.
+   * @param region Region returned by addSprite() or addSpriteFromPBO()
+   */
+  void releaseSprite(const AtlasRegion &region);
+
+  /**
+   * Check if the next addSprite() has to open a new layer.
+   */
+  bool needsNewLayer() const {
+    return free_slots_.empty() && next_y_ >= SPRITES_PER_ROW;
+  }
+
+  /**
+   * Get number of released slots waiting for reuse.
+   */
+  size_t getFreeSlotCount() const { return free_slots_.size(); }
+
   /**
    * Bind the texture array to a texture slot.
    * @param slot Texture unit (0-15)
@@ -112,6 +149,11 @@ private:
   bool addLayer();
   void release();
 
+  // Pick the slot for the next sprite: lowest free slot, else the next
+  // unused one (opening a layer if needed)
+  bool acquireSlot(int &layer, int &pixel_x, int &pixel_y);
+  static AtlasRegion makeRegion(int layer, int pixel_x, int pixel_y);
+
   GLuint texture_id_ = 0;
   int layer_count_ = 0;        // Number of layers allocated
   int allocated_layers_ = 0;   // Number of layers in GPU memory
@@ -120,6 +162,10 @@ private:
   int next_x_ = 0;             // Next slot X in current layer
   int next_y_ = 0;             // Next slot Y in current layer
   uint64_t version_ = 0;       // Incremented on texture object change
+
+  // Released slots (layer * SPRITES_PER_LAYER + y * SPRITES_PER_ROW + x)
+  std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>>
+      free_slots_;
 };
 
 } // namespace Rendering
@@ -1,5 +1,6 @@
 #pragma once
 #include "Domain/Position.h"
+#include "Domain/Selection/SelectionChunk.h"
 #include "Domain/Selection/SelectionEntry.h"
 #include <cstdint>
 #include <functional>
@@ -83,6 +84,20 @@ public:
   virtual void forEachEntryOnFloor(int16_t floor,
                                    const EntryCallback &callback) const = 0;
 
+  /**
+   * Callback type for chunk-level iteration.
+   * Receives the chunk's tile/creature/spawn masks and its entries.
+   */
+  using ChunkCallback =
+      std::function<void(const Domain::Selection::SelectionChunk &chunk)>;
+
+  /**
+   * Iterate selected chunks on a specific floor.
+   * Lets overlays cull whole chunks and walk mask bits instead of entries.
+   */
+  virtual void forEachChunkOnFloor(int16_t floor,
+                                   const ChunkCallback &callback) const = 0;
+
   /**
    * Check if any spawn-type entities are selected at a position.
    */
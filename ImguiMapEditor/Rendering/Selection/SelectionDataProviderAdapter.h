@@ -46,15 +46,26 @@ public:
     if (!service_)
       return false;
 
-    auto entries = service_->getEntriesAt(pos);
-    for (const auto &entry : entries) {
+    // Read the tile's entry run in place - this runs per drawn item
+    const Domain::Selection::SelectionChunk *chunk = findChunk(pos);
+    if (!chunk) {
+      return false;
+    }
+
+    const int index = Domain::Selection::SelectionChunk::tileIndex(pos);
+    if (!chunk->tiles.test(index)) {
+      return false;
+    }
+
+    auto [first, last] = chunk->entriesAt(index);
+    for (auto it = first; it != last; ++it) {
       // Ground type with null ptr means whole tile selected
-      if (entry.getType() == Domain::Selection::EntityType::Ground &&
-          entry.entity_ptr == nullptr) {
+      if (it->getType() == Domain::Selection::EntityType::Ground &&
+          it->entity_ptr == nullptr) {
         return true;
       }
       // Check specific item
-      if (entry.entity_ptr == item) {
+      if (it->entity_ptr == item) {
         return true;
       }
     }
@@ -87,15 +98,7 @@ public:
     if (!service_)
       return {};
 
-    std::vector<Domain::Position> result;
-    for (const auto &entry : service_->getAllEntries()) {
-      // Use getPosition() method, not .pos member
-      const Domain::Position &pos = entry.getPosition();
-      if (pos.z == floor) {
-        result.push_back(pos);
-      }
-    }
-    return result;
+    return service_->getBucket().getPositionsOnFloor(floor);
   }
 
   void forEachEntryOnFloor(int16_t floor,
@@ -103,42 +106,45 @@ public:
     if (!service_)
       return;
 
-    for (const auto &entry : service_->getAllEntries()) {
-      // Use getPosition() method, not .pos member
-      const Domain::Position &pos = entry.getPosition();
-      if (pos.z == floor) {
-        callback(pos, entry.getType());
-      }
-    }
+    service_->getBucket().forEachChunkOnFloor(
+        floor, [&](const Domain::Selection::SelectionChunk &chunk) {
+          for (const auto &entry : chunk.entries) {
+            callback(entry.getPosition(), entry.getType());
+          }
+        });
+  }
+
+  void forEachChunkOnFloor(int16_t floor,
+                           const ChunkCallback &callback) const override {
+    if (!service_)
+      return;
+
+    service_->getBucket().forEachChunkOnFloor(floor, callback);
   }
 
   bool hasSpawnSelectionAt(const Domain::Position &pos) const override {
     if (!service_)
       return false;
 
-    auto entries = service_->getEntriesAt(pos);
-    for (const auto &entry : entries) {
-      if (entry.getType() == Domain::Selection::EntityType::Spawn) {
-        return true;
-      }
-    }
-    return false;
+    return service_->getBucket().hasSpawnAt(pos);
   }
 
   bool hasCreatureSelectionAt(const Domain::Position &pos) const override {
     if (!service_)
       return false;
 
-    auto entries = service_->getEntriesAt(pos);
-    for (const auto &entry : entries) {
-      if (entry.getType() == Domain::Selection::EntityType::Creature) {
-        return true;
-      }
-    }
-    return false;
+    return service_->getBucket().hasCreatureAt(pos);
   }
 
 private:
+  const Domain::Selection::SelectionChunk *
+  findChunk(const Domain::Position &pos) const {
+    using Domain::Selection::SelectionChunk;
+    return service_->getBucket().getChunk(pos.x >> SelectionChunk::SHIFT,
+                                          pos.y >> SelectionChunk::SHIFT,
+                                          pos.z);
+  }
+
   const Services::Selection::SelectionService *service_ = nullptr;
 };
 
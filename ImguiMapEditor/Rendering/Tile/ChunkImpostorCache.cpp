@@ -0,0 +1,156 @@
+#include "Rendering/Tile/ChunkImpostorCache.h"
+#include <glad/glad.h>
+#include <spdlog/spdlog.h>
+
+namespace MapEditor {
+namespace Rendering {
+
+const ChunkImpostorCache::Impostor *
+ChunkImpostorCache::find(int32_t chunk_x, int32_t chunk_y, int8_t floor,
+                         uint32_t revision, uint64_t generation,
+                         float floor_offset) {
+  auto it = entries_.find(makeKey(chunk_x, chunk_y, floor));
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  Impostor &impostor = it->second;
+  if (!impostor.valid || impostor.revision != revision ||
+      impostor.generation < generation ||
+      impostor.floor_offset != floor_offset) {
+    return nullptr;
+  }
+  impostor.last_used = frame_;
+  return &impostor;
+}
+
+ChunkImpostorCache::Impostor *
+ChunkImpostorCache::acquire(int32_t chunk_x, int32_t chunk_y, int8_t floor) {
+  const uint64_t key = makeKey(chunk_x, chunk_y, floor);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    if (free_cells_.empty() && !growTexture() && !evictOne()) {
+      return nullptr;
+    }
+    Impostor impostor;
+    impostor.cell = free_cells_.back();
+    impostor.z = floor;
+    free_cells_.pop_back();
+    it = entries_.emplace(key, impostor).first;
+  }
+  it->second.valid = false;
+  it->second.last_used = frame_;
+  return &it->second;
+}
+
+void ChunkImpostorCache::markBuilt(Impostor &impostor, uint32_t revision,
+                                   uint64_t generation, float floor_offset) {
+  impostor.revision = revision;
+  impostor.generation = generation;
+  impostor.floor_offset = floor_offset;
+  impostor.valid = true;
+}
+
+void ChunkImpostorCache::invalidate(int32_t chunk_x, int32_t chunk_y,
+                                    int8_t floor) {
+  auto it = entries_.find(makeKey(chunk_x, chunk_y, floor));
+  if (it != entries_.end()) {
+    it->second.valid = false;
+  }
+}
+
+void ChunkImpostorCache::prune(int8_t min_z, int8_t max_z) {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.z < min_z || it->second.z > max_z) {
+      free_cells_.push_back(it->second.cell);
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void ChunkImpostorCache::clear() {
+  entries_.clear();
+  free_cells_.clear();
+  texture_.reset();
+  page_count_ = 0;
+}
+
+bool ChunkImpostorCache::growTexture() {
+  if (page_count_ >= MAX_PAGES) {
+    return false;
+  }
+  const int pages = page_count_ + 1;
+
+  DeferredTextureHandle texture;
+  texture.create();
+  glBindTexture(GL_TEXTURE_2D_ARRAY, texture.get());
+  for (int level = 0; level < MIP_LEVELS; ++level) {
+    const int size = PAGE_SIZE >> level;
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, level, GL_RGBA8, size, size, pages, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+  }
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+                  GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, 0);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, MIP_LEVELS - 1);
+
+  // Carry existing pages over (all levels) so live impostors stay valid
+  if (page_count_ > 0) {
+    GLint previous_read = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous_read);
+    DeferredFBOHandle fbo;
+    fbo.create();
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo.get());
+    for (int layer = 0; layer < page_count_; ++layer) {
+      for (int level = 0; level < MIP_LEVELS; ++level) {
+        const int size = PAGE_SIZE >> level;
+        glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                  texture_.get(), level, layer);
+        glCopyTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, 0, 0,
+                            size, size);
+      }
+    }
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previous_read));
+  }
+  glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+  texture_ = std::move(texture);
+
+  // Lowest cell of the new page is handed out first
+  const uint32_t first = static_cast<uint32_t>(page_count_) * CELLS_PER_PAGE;
+  for (uint32_t cell = first + CELLS_PER_PAGE; cell-- > first;) {
+    free_cells_.push_back(cell);
+  }
+  page_count_ = pages;
+
+  spdlog::debug("[ChunkImpostorCache] Grew to {} pages ({} impostors)", pages,
+                pages * CELLS_PER_PAGE);
+  return true;
+}
+
+bool ChunkImpostorCache::evictOne() {
+  auto victim = entries_.end();
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    // Never evict an impostor already queued for drawing this frame
+    if (it->second.last_used == frame_) {
+      continue;
+    }
+    if (victim == entries_.end() ||
+        it->second.last_used < victim->second.last_used) {
+      victim = it;
+    }
+  }
+  if (victim == entries_.end()) {
+    return false;
+  }
+  free_cells_.push_back(victim->second.cell);
+  entries_.erase(victim);
+  return true;
+}
+
+} // namespace Rendering
+} // namespace MapEditor
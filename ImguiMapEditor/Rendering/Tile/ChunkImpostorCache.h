@@ -0,0 +1,132 @@
+#pragma once
+#include "Core/Config.h"
+#include "Rendering/Core/GLHandle.h"
+#include <bit>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace MapEditor {
+namespace Rendering {
+
+/**
+ * Pre-rasterized chunk images for far-zoom rendering.
+ *
+ * Each (chunk, floor) impostor is one IMPOSTOR_SIZE cell in a mipmapped
+ * texture array, rasterized from the chunk's cached TileInstance VBO. The
+ * cell covers the chunk plus IMPOSTOR_MARGIN world pixels above and to the
+ * left, where large and elevated sprites overhang, so drawing impostors in
+ * chunk order overlaps like the full sprite rendering does.
+ *
+ * Pixels are alpha-premultiplied. An impostor is valid for the chunk
+ * revision, floor offset and chunk cache generation it was rasterized with.
+ * Impostors are only rasterized from valid cached chunks, which never hold
+ * placeholder sprites, so sprite loading does not invalidate them.
+ * When all cells are taken the least recently drawn impostor not used this
+ * frame is evicted; if none qualifies the chunk is drawn from sprites.
+ */
+class ChunkImpostorCache {
+public:
+  static constexpr int CELL_SIZE = Config::Performance::IMPOSTOR_SIZE;
+  static constexpr int PAGE_SIZE = Config::Performance::IMPOSTOR_PAGE_SIZE;
+  static constexpr int CELLS_PER_ROW = PAGE_SIZE / CELL_SIZE;
+  static constexpr int CELLS_PER_PAGE = CELLS_PER_ROW * CELLS_PER_ROW;
+  static constexpr int MAX_PAGES = Config::Performance::IMPOSTOR_MAX_PAGES;
+  static constexpr int MARGIN = Config::Performance::IMPOSTOR_MARGIN;
+  // Mip chain stops at 4x4 cells; smaller levels would blend neighbouring cells
+  static constexpr int MIP_LEVELS =
+      std::bit_width(static_cast<unsigned>(CELL_SIZE)) - 2;
+  // World pixels covered by a cell along each axis
+  static constexpr float WORLD_SIZE =
+      static_cast<float>(Config::Performance::CHUNK_SIZE *
+                             Config::Rendering::TILE_DIMENSION +
+                         MARGIN);
+
+  struct Impostor {
+    uint32_t cell = 0;         // page * CELLS_PER_PAGE + index in page
+    uint32_t revision = 0;     // Chunk revision rasterized
+    uint64_t generation = 0;   // ChunkSpriteCache generation rasterized
+    float floor_offset = 0.0f; // Floor offset rasterized
+    uint32_t last_used = 0;    // Frame last drawn
+    int8_t z = 0;
+    bool valid = false;
+  };
+
+  ChunkImpostorCache() = default;
+  ~ChunkImpostorCache() = default;
+
+  // Non-copyable (GPU resource), movable
+  ChunkImpostorCache(const ChunkImpostorCache &) = delete;
+  ChunkImpostorCache &operator=(const ChunkImpostorCache &) = delete;
+  ChunkImpostorCache(ChunkImpostorCache &&) = default;
+  ChunkImpostorCache &operator=(ChunkImpostorCache &&) = default;
+
+  /**
+   * Advance the frame counter used for LRU eviction.
+   */
+  void beginFrame() { ++frame_; }
+
+  /**
+   * Get a current impostor and mark it drawn this frame.
+   * @return Impostor, or nullptr if missing or stale
+   */
+  const Impostor *find(int32_t chunk_x, int32_t chunk_y, int8_t floor,
+                       uint32_t revision, uint64_t generation,
+                       float floor_offset);
+
+  /**
+   * Get or assign a cell for a chunk, growing the texture or evicting as
+   * needed. The returned impostor is marked invalid until the caller
+   * rasterizes it and calls markBuilt().
+   * @return Impostor to rasterize into, or nullptr if no cell is available
+   */
+  Impostor *acquire(int32_t chunk_x, int32_t chunk_y, int8_t floor);
+
+  /**
+   * Record that an acquired impostor now holds the given chunk state.
+   */
+  void markBuilt(Impostor &impostor, uint32_t revision, uint64_t generation,
+                 float floor_offset);
+
+  /**
+   * Mark a chunk's impostor stale (keeps its cell for the rebuild).
+   */
+  void invalidate(int32_t chunk_x, int32_t chunk_y, int8_t floor);
+
+  /**
+   * Drop impostors outside the given floor range.
+   */
+  void prune(int8_t min_z, int8_t max_z);
+
+  /**
+   * Drop all impostors and release the texture.
+   */
+  void clear();
+
+  GLuint getTexture() const { return texture_.get(); }
+  int getPageCount() const { return page_count_; }
+  size_t getImpostorCount() const { return entries_.size(); }
+
+private:
+  static uint64_t makeKey(int32_t chunk_x, int32_t chunk_y, int8_t floor) {
+    // Same packing as ChunkSpriteCache: 24 bits x, 24 bits y, 8 bits floor
+    uint64_t key = 0;
+    key |= (static_cast<uint64_t>(chunk_x + 0x800000) & 0xFFFFFF) << 32;
+    key |= (static_cast<uint64_t>(chunk_y + 0x800000) & 0xFFFFFF) << 8;
+    key |= static_cast<uint64_t>(floor & 0xFF);
+    return key;
+  }
+
+  bool growTexture();
+  bool evictOne();
+
+  DeferredTextureHandle texture_;
+  int page_count_ = 0;
+
+  std::unordered_map<uint64_t, Impostor> entries_;
+  std::vector<uint32_t> free_cells_;
+  uint32_t frame_ = 1;
+};
+
+} // namespace Rendering
+} // namespace MapEditor
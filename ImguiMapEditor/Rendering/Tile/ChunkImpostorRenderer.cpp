@@ -0,0 +1,233 @@
+#include "Rendering/Tile/ChunkImpostorRenderer.h"
+#include "Rendering/Backend/SpriteBatch.h"
+#include "Rendering/Resources/AtlasManager.h"
+#include "Rendering/Resources/ShaderLoader.h"
+#include "Rendering/Resources/SpriteAtlasLUT.h"
+#include <cstddef>
+#include <glm/gtc/matrix_transform.hpp>
+#include <spdlog/spdlog.h>
+
+namespace MapEditor {
+namespace Rendering {
+
+using Cache = ChunkImpostorCache;
+
+ChunkImpostorRenderer::ChunkImpostorRenderer(SpriteBatch &sprite_batch)
+    : sprite_batch_(sprite_batch) {}
+
+ChunkImpostorRenderer::~ChunkImpostorRenderer() = default;
+
+bool ChunkImpostorRenderer::ensureInitialized() {
+  if (initialized_)
+    return true;
+  if (init_failed_)
+    return false;
+
+  shader_ = ShaderLoader::load("impostor");
+  if (!shader_ || !shader_->isValid()) {
+    spdlog::error("ChunkImpostorRenderer: Failed to load impostor shader: {}",
+                  shader_ ? shader_->getError() : "file not found");
+    init_failed_ = true;
+    return false;
+  }
+
+  vao_.create();
+  quad_vbo_.create();
+  quad_ebo_.create();
+  instance_vbo_.create();
+  fbo_.create();
+  read_fbo_.create();
+
+  glBindVertexArray(vao_.get());
+
+  // Unit quad, top-left origin (same as SpriteBatch)
+  const float quad_vertices[] = {
+      0.0f, 0.0f, 0.0f, 0.0f, // top-left
+      1.0f, 0.0f, 1.0f, 0.0f, // top-right
+      1.0f, 1.0f, 1.0f, 1.0f, // bottom-right
+      0.0f, 1.0f, 0.0f, 1.0f  // bottom-left
+  };
+  const unsigned int quad_indices[] = {0, 1, 2, 2, 3, 0};
+
+  glBindBuffer(GL_ARRAY_BUFFER, quad_vbo_.get());
+  glBufferData(GL_ARRAY_BUFFER, sizeof(quad_vertices), quad_vertices,
+               GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quad_ebo_.get());
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quad_indices), quad_indices,
+               GL_STATIC_DRAW);
+
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void *)0);
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float),
+                        (void *)(2 * sizeof(float)));
+  glEnableVertexAttribArray(1);
+
+  // Location 2: x, y, size; location 3: cell
+  glBindBuffer(GL_ARRAY_BUFFER, instance_vbo_.get());
+  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Instance),
+                        (void *)offsetof(Instance, x));
+  glEnableVertexAttribArray(2);
+  glVertexAttribDivisor(2, 1);
+  glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(Instance),
+                         (void *)offsetof(Instance, cell));
+  glEnableVertexAttribArray(3);
+  glVertexAttribDivisor(3, 1);
+
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  initialized_ = true;
+  return true;
+}
+
+bool ChunkImpostorRenderer::beginBuilds(const AtlasManager &atlas_manager,
+                                        SpriteAtlasLUT &lut) {
+  if (!ensureInitialized())
+    return false;
+
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &saved_framebuffer_);
+  glGetIntegerv(GL_VIEWPORT, saved_viewport_);
+  glGetIntegerv(GL_SCISSOR_BOX, saved_scissor_);
+  saved_scissor_enabled_ = glIsEnabled(GL_SCISSOR_TEST);
+
+  glBindFramebuffer(GL_FRAMEBUFFER, fbo_.get());
+  glEnable(GL_SCISSOR_TEST);
+  glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+  // Instances are drawn relative to (MARGIN, MARGIN), so one projection
+  // covers every cell. Y runs upward so the world top lands on texture row 0,
+  // matching the impostor shader's texture coordinates.
+  const glm::mat4 projection =
+      glm::ortho(0.0f, Cache::WORLD_SIZE, 0.0f, Cache::WORLD_SIZE);
+  sprite_batch_.beginTileBatch(projection, atlas_manager, lut);
+
+  // Accumulate coverage in alpha so the result is premultiplied
+  glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE,
+                      GL_ONE_MINUS_SRC_ALPHA);
+  built_cells_.clear();
+  return true;
+}
+
+const ChunkImpostorCache::Impostor *ChunkImpostorRenderer::build(
+    ChunkImpostorCache &cache, int32_t chunk_x, int32_t chunk_y, int8_t floor,
+    const ChunkSpriteCache::CachedChunk &cached, uint32_t revision,
+    uint64_t generation, float floor_offset, const AtlasManager &atlas_manager,
+    SpriteAtlasLUT &lut) {
+  Cache::Impostor *impostor = cache.acquire(chunk_x, chunk_y, floor);
+  if (!impostor)
+    return nullptr;
+
+  const int page = static_cast<int>(impostor->cell / Cache::CELLS_PER_PAGE);
+  const int index = static_cast<int>(impostor->cell % Cache::CELLS_PER_PAGE);
+  const int x = (index % Cache::CELLS_PER_ROW) * Cache::CELL_SIZE;
+  const int y = (index / Cache::CELLS_PER_ROW) * Cache::CELL_SIZE;
+
+  glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                            cache.getTexture(), 0, page);
+  glViewport(x, y, Cache::CELL_SIZE, Cache::CELL_SIZE);
+  glScissor(x, y, Cache::CELL_SIZE, Cache::CELL_SIZE);
+  glClear(GL_COLOR_BUFFER_BIT);
+
+  sprite_batch_.drawTileInstances(cached.vbo.get(), cached.tiles.size(),
+                                  static_cast<float>(Cache::MARGIN),
+                                  static_cast<float>(Cache::MARGIN),
+                                  atlas_manager, lut);
+
+  cache.markBuilt(*impostor, revision, generation, floor_offset);
+  built_cells_.push_back(impostor->cell);
+  return impostor;
+}
+
+void ChunkImpostorRenderer::endBuilds(const ChunkImpostorCache &cache) {
+  sprite_batch_.endTileBatch();
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+  // Halve each built cell level by level. A linear 2:1 blit samples the
+  // centre of every 2x2 block, i.e. a box filter like glGenerateMipmap,
+  // without rebuilding the mips of every page in the array.
+  if (!built_cells_.empty()) {
+    glDisable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, read_fbo_.get());
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbo_.get());
+    for (uint32_t cell : built_cells_) {
+      const int page = static_cast<int>(cell / Cache::CELLS_PER_PAGE);
+      const int index = static_cast<int>(cell % Cache::CELLS_PER_PAGE);
+      const int x = (index % Cache::CELLS_PER_ROW) * Cache::CELL_SIZE;
+      const int y = (index / Cache::CELLS_PER_ROW) * Cache::CELL_SIZE;
+      for (int level = 1; level < Cache::MIP_LEVELS; ++level) {
+        glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                  cache.getTexture(), level - 1, page);
+        glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                  cache.getTexture(), level, page);
+        const int src_x = x >> (level - 1);
+        const int src_y = y >> (level - 1);
+        const int src_size = Cache::CELL_SIZE >> (level - 1);
+        glBlitFramebuffer(src_x, src_y, src_x + src_size, src_y + src_size,
+                          src_x / 2, src_y / 2, (src_x + src_size) / 2,
+                          (src_y + src_size) / 2, GL_COLOR_BUFFER_BIT,
+                          GL_LINEAR);
+      }
+    }
+    built_cells_.clear();
+  }
+
+  glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(saved_framebuffer_));
+  glViewport(saved_viewport_[0], saved_viewport_[1], saved_viewport_[2],
+             saved_viewport_[3]);
+  glScissor(saved_scissor_[0], saved_scissor_[1], saved_scissor_[2],
+            saved_scissor_[3]);
+  if (saved_scissor_enabled_) {
+    glEnable(GL_SCISSOR_TEST);
+  } else {
+    glDisable(GL_SCISSOR_TEST);
+  }
+}
+
+void ChunkImpostorRenderer::queue(const ChunkImpostorCache::Impostor &impostor,
+                                  float origin_x, float origin_y) {
+  pending_.push_back({origin_x - Cache::MARGIN, origin_y - Cache::MARGIN,
+                      Cache::WORLD_SIZE, impostor.cell});
+}
+
+void ChunkImpostorRenderer::flush(const ChunkImpostorCache &cache,
+                                  const glm::mat4 &mvp) {
+  if (pending_.empty())
+    return;
+  if (!ensureInitialized() || cache.getTexture() == 0) {
+    pending_.clear();
+    return;
+  }
+
+  // Orphan and refill; a few thousand 16-byte instances at most
+  glBindBuffer(GL_ARRAY_BUFFER, instance_vbo_.get());
+  glBufferData(GL_ARRAY_BUFFER, pending_.size() * sizeof(Instance),
+               pending_.data(), GL_STREAM_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); // Premultiplied
+
+  shader_->use();
+  shader_->setMat4("uMVP", mvp);
+  shader_->setInt("uImpostors", 0);
+  shader_->setInt("uCellsPerRow", Cache::CELLS_PER_ROW);
+  shader_->setInt("uCellsPerPage", Cache::CELLS_PER_PAGE);
+  shader_->setFloat("uCellUV", static_cast<float>(Cache::CELL_SIZE) /
+                                   static_cast<float>(Cache::PAGE_SIZE));
+  shader_->setFloat("uHalfTexel", 0.5f / static_cast<float>(Cache::PAGE_SIZE));
+
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, cache.getTexture());
+
+  glBindVertexArray(vao_.get());
+  glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0,
+                          static_cast<GLsizei>(pending_.size()));
+  glBindVertexArray(0);
+
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  glDisable(GL_BLEND);
+  pending_.clear();
+}
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -0,0 +1,108 @@
+#pragma once
+#include "Rendering/Core/GLHandle.h"
+#include "Rendering/Core/Shader.h"
+#include "Rendering/Tile/ChunkImpostorCache.h"
+#include "Rendering/Tile/ChunkSpriteCache.h"
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace MapEditor {
+namespace Rendering {
+
+class AtlasManager;
+class SpriteAtlasLUT;
+class SpriteBatch;
+
+/**
+ * Rasterizes chunk impostors and draws them as one quad per chunk.
+ *
+ * Rasterization replays a chunk's cached TileInstance VBO through the tile
+ * shader into the impostor's texture cell, so impostors match the sprite
+ * rendering exactly and need no CPU sprite decoding. Mip levels of the cells
+ * rasterized in a frame are downsampled once in endBuilds().
+ *
+ * Usage per frame:
+ *   beginBuilds(); build(...) x N; endBuilds();   // optional
+ *   queue(...) x M; flush(mvp);
+ */
+class ChunkImpostorRenderer {
+public:
+  explicit ChunkImpostorRenderer(SpriteBatch &sprite_batch);
+  ~ChunkImpostorRenderer();
+
+  // Non-copyable
+  ChunkImpostorRenderer(const ChunkImpostorRenderer &) = delete;
+  ChunkImpostorRenderer &operator=(const ChunkImpostorRenderer &) = delete;
+
+  /**
+   * Bind the impostor framebuffer and start a tile batch for rasterizing.
+   * Saves the framebuffer, viewport and scissor state for endBuilds().
+   * @return false if GL resources could not be created
+   */
+  bool beginBuilds(const AtlasManager &atlas_manager, SpriteAtlasLUT &lut);
+
+  /**
+   * Rasterize a chunk's cached instances into its impostor cell.
+   * @param cached Valid cached chunk matching revision and floor_offset
+   * @return The built impostor, or nullptr if no cell was available
+   */
+  const ChunkImpostorCache::Impostor *
+  build(ChunkImpostorCache &cache, int32_t chunk_x, int32_t chunk_y,
+        int8_t floor, const ChunkSpriteCache::CachedChunk &cached,
+        uint32_t revision, uint64_t generation, float floor_offset,
+        const AtlasManager &atlas_manager, SpriteAtlasLUT &lut);
+
+  /**
+   * Downsample the mip levels of the cells built since beginBuilds() and
+   * restore the saved GL state.
+   */
+  void endBuilds(const ChunkImpostorCache &cache);
+
+  /**
+   * Queue an impostor quad for the chunk whose origin is origin_x/origin_y.
+   */
+  void queue(const ChunkImpostorCache::Impostor &impostor, float origin_x,
+             float origin_y);
+
+  /**
+   * Draw all queued impostor quads.
+   */
+  void flush(const ChunkImpostorCache &cache, const glm::mat4 &mvp);
+
+  size_t getQueuedCount() const { return pending_.size(); }
+
+private:
+  struct Instance {
+    float x, y;    // World top-left of the cell area (origin - margin)
+    float size;    // World size of the cell area
+    uint32_t cell; // ChunkImpostorCache cell
+  };
+
+  bool ensureInitialized();
+
+  SpriteBatch &sprite_batch_;
+
+  std::unique_ptr<Shader> shader_;
+  DeferredVAOHandle vao_;
+  DeferredVBOHandle quad_vbo_;
+  DeferredVBOHandle quad_ebo_;
+  DeferredVBOHandle instance_vbo_;
+  DeferredFBOHandle fbo_;
+  DeferredFBOHandle read_fbo_; // Source level of mip downsampling
+  bool initialized_ = false;
+  bool init_failed_ = false;
+
+  std::vector<Instance> pending_;
+
+  // GL state saved by beginBuilds()
+  GLint saved_framebuffer_ = 0;
+  GLint saved_viewport_[4] = {0, 0, 0, 0};
+  GLint saved_scissor_[4] = {0, 0, 0, 0};
+  GLboolean saved_scissor_enabled_ = GL_FALSE;
+  // Cells rasterized since beginBuilds(), downsampled by endBuilds()
+  std::vector<uint32_t> built_cells_;
+};
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -41,11 +41,35 @@ void ChunkRenderingStrategy::renderFromCache(
   // Always use GPU path - no CPU fallback needed
   if (cached->vbo.isValid()) {
     sprite_batch_.drawTileInstances(cached->vbo.get(), cached->tiles.size(),
+                                    cached->origin_x, cached->origin_y,
                                     sprite_manager_.getAtlasManager(),
                                     sprite_manager_.getSpriteLUT());
   }
 }
 
+bool ChunkRenderingStrategy::touchCachedSprites(
+    ChunkSpriteCache::CachedChunk *cached) {
+  // Cached instances resolve sprites on the GPU, so they never pass through
+  // getRegion(). Re-mark them periodically, and after any eviction, so the
+  // atlas keeps them resident.
+  const auto &atlas = sprite_manager_.getAtlasManager();
+  const bool stale =
+      atlas.getFrame() - cached->touched_frame >=
+          Config::Performance::ATLAS_TOUCH_INTERVAL_FRAMES ||
+      atlas.getEvictionCount() != cached->touched_evictions;
+  if (!stale) {
+    return true;
+  }
+
+  bool resident = true;
+  for (const TileInstance &instance : cached->tiles) {
+    resident &= atlas.touch(instance.sprite_id);
+  }
+  cached->touched_frame = atlas.getFrame();
+  cached->touched_evictions = atlas.getEvictionCount();
+  return resident;
+}
+
 void ChunkRenderingStrategy::renderCached(const Domain::Chunk &chunk,
                                           const Context &ctx) {
 
@@ -57,11 +81,18 @@ void ChunkRenderingStrategy::renderCached(const Domain::Chunk &chunk,
 
   // FIX: Check floor_offset in addition to validity and generation.
   // floor_offset depends on current_floor for underground floors, so cached
-  // positions become invalid when current_floor changes.
+  // positions become invalid when current_floor changes. The revision check
+  // picks up tile edits, which never clear the chunk's dirty flag.
   bool cache_valid =
       cached && cached->valid &&
       cached->generation >= ctx.state.chunk_cache.getGlobalGeneration() &&
-      cached->floor_offset == ctx.floor_offset;
+      cached->floor_offset == ctx.floor_offset &&
+      cached->revision == chunk.getRevision();
+
+  if (cache_valid && !touchCachedSprites(cached)) {
+    // Some sprites were evicted from the atlas; regenerate to reload them
+    cache_valid = false;
+  }
 
   if (!cache_valid) {
     generateCachedChunk(chunk, ctx, cached);
@@ -77,8 +108,9 @@ void ChunkRenderingStrategy::generateCachedChunk(
   cached->tiles.clear();
   cached->tiles.reserve(chunk.getNonEmptyCount() * 2);
 
-  // Track missing sprites count BEFORE generation to detect new missing sprites
-  size_t missing_before = ctx.missing_sprites.size();
+  // Track miss reports BEFORE generation to detect missing sprites (the
+  // missing list itself is deduplicated per frame)
+  const uint64_t misses_before = sprite_manager_.getMissCount();
 
   // ISOMETRIC DIAGONAL ITERATION (OTClient parity)
   // Tiles at NW drawn first, tiles at SE drawn last for correct depth
@@ -90,7 +122,8 @@ void ChunkRenderingStrategy::generateCachedChunk(
 
     tile_renderer_.queueTileToTileCache(
         *tile, tile_x, tile_y, ctx.floor_z, screen_x, screen_y, ctx.anim_ticks,
-        ctx.missing_sprites, cached->tiles, 1.0f);
+        ctx.missing_sprites, cached->tiles, ctx.chunk_screen_x,
+        ctx.chunk_screen_y, 1.0f);
     ctx.tiles_rendered++;
   });
 
@@ -99,18 +132,30 @@ void ChunkRenderingStrategy::generateCachedChunk(
   // FIX: Only mark cache as valid if ALL sprites were available during
   // generation. If any sprites were missing, the chunk will be regenerated on
   // the next frame when those sprites may have finished loading asynchronously.
-  bool had_missing_sprites = ctx.missing_sprites.size() > missing_before;
+  bool had_missing_sprites = sprite_manager_.getMissCount() > misses_before;
   cached->valid = !had_missing_sprites;
   cached->floor_offset = ctx.floor_offset; // Store for cache invalidation check
+  cached->origin_x = ctx.chunk_screen_x;
+  cached->origin_y = ctx.chunk_screen_y;
   cached->generation = ctx.state.chunk_cache.getGlobalGeneration();
+  cached->revision = chunk.getRevision();
+  // Generation looked up every sprite, which marked them as used
+  cached->touched_frame = sprite_manager_.getAtlasManager().getFrame();
+  cached->touched_evictions = sprite_manager_.getAtlasManager().getEvictionCount();
 }
 
 void ChunkRenderingStrategy::renderDynamic(const Domain::Chunk &chunk,
-                                           const Context &ctx) {
+                                           const Context &ctx,
+                                           const FloorCoverage::Rows *hidden) {
 
   // ISOMETRIC DIAGONAL ITERATION (OTClient parity)
   // Tiles at NW drawn first, tiles at SE drawn last for correct depth
   chunk.forEachTileDiagonal([&](const Domain::Tile *tile, int lx, int ly) {
+    // Completely under opaque ground of a floor drawn above
+    if (hidden && ((*hidden)[ly] >> lx) & 1u) {
+      return;
+    }
+
     // Calc coords incrementally using context
     int tile_x = ctx.chunk_wx + lx;
     int tile_y = ctx.chunk_wy + ly;
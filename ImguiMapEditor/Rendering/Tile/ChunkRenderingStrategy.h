@@ -6,6 +6,7 @@
 #include "Rendering/Frame/RenderState.h"
 #include "Rendering/Tile/ChunkSpriteCache.h"
 #include "Rendering/Visibility/ChunkVisibilityManager.h"
+#include "Rendering/Visibility/FloorCoverage.h"
 #include <cstdint>
 #include <vector>
 
@@ -69,8 +70,10 @@ public:
    * Render a chunk using the dynamic immediate path (Zoomed In / Animated).
    * Iterates tiles and queues sprites to the batch.
    * Assumes SpriteBatch is in Sprite mode (begin called).
+   * @param hidden Optional per-row mask of tiles hidden by floors above
    */
-  void renderDynamic(const Domain::Chunk &chunk, const Context &ctx);
+  void renderDynamic(const Domain::Chunk &chunk, const Context &ctx,
+                     const FloorCoverage::Rows *hidden = nullptr);
 
   /**
    * DEPRECATED: Render only the edge of a chunk.
@@ -79,6 +82,12 @@ public:
   void renderEdge(const Domain::Chunk &chunk, const Context &ctx,
                   const VisibleBounds &bounds);
 
+  /**
+   * Keep a cached chunk's sprites resident in the atlas.
+   * @return false if any of them was evicted
+   */
+  bool touchCachedSprites(ChunkSpriteCache::CachedChunk *cached);
+
 private:
   void generateCachedChunk(const Domain::Chunk &chunk, const Context &ctx,
                            ChunkSpriteCache::CachedChunk *cached);
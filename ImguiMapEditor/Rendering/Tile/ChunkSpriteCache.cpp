@@ -24,6 +24,17 @@ ChunkSpriteCache::get(int32_t chunk_x, int32_t chunk_y, int8_t floor) const {
   return nullptr;
 }
 
+ChunkSpriteCache::CachedChunk *
+ChunkSpriteCache::get(int32_t chunk_x, int32_t chunk_y, int8_t floor) {
+
+  uint64_t key = makeKey(chunk_x, chunk_y, floor);
+  auto it = cache_.find(key);
+  if (it != cache_.end() && it->second.valid) {
+    return &it->second;
+  }
+  return nullptr;
+}
+
 void ChunkSpriteCache::invalidate(int32_t chunk_x, int32_t chunk_y,
                                   int8_t floor) {
   uint64_t key = makeKey(chunk_x, chunk_y, floor);
@@ -34,6 +45,10 @@ void ChunkSpriteCache::invalidate(int32_t chunk_x, int32_t chunk_y,
   }
 }
 
+void ChunkSpriteCache::evict(int32_t chunk_x, int32_t chunk_y, int8_t floor) {
+  cache_.erase(makeKey(chunk_x, chunk_y, floor)); // VBO handle frees itself
+}
+
 void ChunkSpriteCache::invalidateAll() {
   global_generation_++;
   for (auto &[key, entry] : cache_) {
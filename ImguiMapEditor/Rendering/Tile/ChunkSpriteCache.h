@@ -25,10 +25,18 @@ public:
     DeferredVBOHandle vbo;           // Handle to GPU buffer (created lazily)
     size_t vbo_capacity = 0;         // Current capacity in bytes
     uint64_t generation = 0;         // Incremented when chunk content changes
+    uint32_t revision = 0;           // Domain::Chunk revision generated from
     float floor_offset =
         0.0f;     // Floor offset used when generating (for cache validation)
+    // Chunk origin the instance positions are relative to
+    float origin_x = 0.0f;
+    float origin_y = 0.0f;
     int8_t z = 0; // Store Z floor for smart eviction
     bool valid = false;
+    // Atlas residency: frame the sprites were last marked as used, and the
+    // atlas eviction count at that time
+    uint32_t touched_frame = 0;
+    uint64_t touched_evictions = 0;
 
     CachedChunk() = default;
     CachedChunk(CachedChunk &&) = default;
@@ -48,6 +56,7 @@ public:
    * Get existing cache entry (returns null if not cached).
    */
   const CachedChunk *get(int32_t chunk_x, int32_t chunk_y, int8_t floor) const;
+  CachedChunk *get(int32_t chunk_x, int32_t chunk_y, int8_t floor);
 
   /**
    * Invalidate a specific chunk's cache.
@@ -55,6 +64,11 @@ public:
    */
   void invalidate(int32_t chunk_x, int32_t chunk_y, int8_t floor);
 
+  /**
+   * Drop a chunk's cache entry and free its VBO.
+   */
+  void evict(int32_t chunk_x, int32_t chunk_y, int8_t floor);
+
   /**
    * Invalidate all cached chunks.
    * Called on map load, zoom change, major settings change.
@@ -129,8 +129,11 @@ void CreatureRenderer::queue(const Domain::Creature *creature, float screen_x,
 
       if (!region) {
         // Queue for async load
-        missing_sprites.push_back(base_sprite_id);
-        if (template_sprite_id != 0) {
+        if (sprite_manager_.markMissing(base_sprite_id)) {
+          missing_sprites.push_back(base_sprite_id);
+        }
+        if (template_sprite_id != 0 &&
+            sprite_manager_.markMissing(template_sprite_id)) {
           missing_sprites.push_back(template_sprite_id);
         }
         continue;
@@ -18,7 +18,13 @@ public:
   explicit SpriteEmitter(SpriteBatch &batch) : batch_(batch) {}
 
   void setCache(std::vector<SpriteInstance> *cache) { cache_ = cache; }
-  void setTileCache(std::vector<TileInstance> *cache) { tile_cache_ = cache; }
+  // TileInstance positions are stored relative to origin_x/origin_y
+  void setTileCache(std::vector<TileInstance> *cache, float origin_x = 0.0f,
+                    float origin_y = 0.0f) {
+    tile_cache_ = cache;
+    tile_origin_x_ = origin_x;
+    tile_origin_y_ = origin_y;
+  }
 
   bool hasTileCache() const { return tile_cache_ != nullptr; }
   bool hasCache() const { return cache_ != nullptr; }
@@ -32,15 +38,8 @@ public:
                          .y = y,
                          .w = w,
                          .h = h,
-                         .u_min = region.u_min,
-                         .v_min = region.v_min,
-                         .u_max = region.u_max,
-                         .v_max = region.v_max,
-                         .r = r,
-                         .g = g,
-                         .b = b,
-                         .a = a,
-                         .atlas_layer = static_cast<float>(region.atlas_index)});
+                         .slot = region.slot,
+                         .tint = packTint(r, g, b, a)});
     } else {
       batch_.draw(x, y, w, h, region, r, g, b, a);
     }
@@ -52,19 +51,13 @@ public:
   // lookup) So for immediate mode, callers might still need to look up region.
   // However, ItemRenderer logic usually handles the lookup if no tile cache is
   // present.
-  inline void emitById(float x, float y, float w, float h, uint32_t sprite_id,
-                       float r, float g, float b, float a) {
+  inline void emitById(float x, float y, float w, float /*h*/,
+                       uint32_t sprite_id, float r, float g, float b, float a) {
     if (tile_cache_) {
-      tile_cache_->push_back({.x = x,
-                              .y = y,
-                              .w = w,
-                              .h = h,
-                              .sprite_id = sprite_id,
-                              .flags = 0,
-                              .r = r,
-                              .g = g,
-                              .b = b,
-                              .a = a});
+      // Cached sprites are square, only w is stored
+      tile_cache_->push_back(TileInstance::pack(x - tile_origin_x_,
+                                                y - tile_origin_y_, w,
+                                                sprite_id, r, g, b, a));
     }
   }
 
@@ -72,6 +65,8 @@ private:
   SpriteBatch &batch_;
   std::vector<SpriteInstance> *cache_ = nullptr;
   std::vector<TileInstance> *tile_cache_ = nullptr;
+  float tile_origin_x_ = 0.0f;
+  float tile_origin_y_ = 0.0f;
 };
 
 } // namespace Rendering
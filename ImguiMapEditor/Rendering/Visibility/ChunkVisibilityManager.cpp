@@ -2,47 +2,135 @@
 #include "Domain/ChunkedMap.h"
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 
 namespace MapEditor {
 namespace Rendering {
 
+namespace {
+
+// 24 bits x, 24 bits y, 8 bits floor (same packing as ChunkSpriteCache)
+uint64_t packCoord(int32_t chunk_x, int32_t chunk_y, int8_t z) {
+  return ((static_cast<uint64_t>(chunk_x + 0x800000) & 0xFFFFFF) << 32) |
+         ((static_cast<uint64_t>(chunk_y + 0x800000) & 0xFFFFFF) << 8) |
+         static_cast<uint64_t>(static_cast<uint8_t>(z));
+}
+
+ChunkCoord unpackCoord(uint64_t key) {
+  ChunkCoord coord;
+  coord.x = static_cast<int32_t>((key >> 32) & 0xFFFFFF) - 0x800000;
+  coord.y = static_cast<int32_t>((key >> 8) & 0xFFFFFF) - 0x800000;
+  coord.z = static_cast<int8_t>(key & 0xFF);
+  return coord;
+}
+
+} // anonymous namespace
+
 void ChunkVisibilityManager::update(const Domain::ChunkedMap &map,
                                     const VisibleBounds &bounds, int8_t floor_z,
                                     float floor_offset) {
-  // Clear previous results
-  visible_chunks_.clear();
-  chunk_buffer_.clear();
+  const uint32_t layout = map.getLayoutRevision(floor_z);
+  const bool same_region = has_query_ && &map == last_map_ &&
+                           floor_z == last_floor_ && layout == last_layout_ &&
+                           bounds == last_bounds_;
+
+  if (!same_region) {
+    queryCandidates(map, bounds, floor_z);
+    last_map_ = &map;
+    last_bounds_ = bounds;
+    last_floor_ = floor_z;
+    last_layout_ = layout;
+    has_query_ = true;
+  } else {
+    entered_.clear();
+    left_.clear();
+  }
+
+  // Tile edits can empty or fill a candidate without changing the layout
+  if (!same_region || floor_offset != last_offset_ || !visibleListCurrent()) {
+    last_offset_ = floor_offset;
+    rebuildVisibleList();
+  }
+}
+
+void ChunkVisibilityManager::queryCandidates(const Domain::ChunkedMap &map,
+                                             const VisibleBounds &bounds,
+                                             int8_t floor_z) {
+  candidates_.clear();
 
-  // Query map for chunks in the visible bounds
+  // Query map for chunks in the visible bounds (empty ones too, so emptiness
+  // changes do not require a new query)
   map.getVisibleChunks(bounds.start_x, bounds.start_y, bounds.end_x,
-                       bounds.end_y, floor_z, chunk_buffer_);
+                       bounds.end_y, floor_z, candidates_, true);
+
+  // Diff against the previous region
+  std::swap(previous_keys_, candidate_keys_);
+  candidate_keys_.clear();
+  candidate_keys_.reserve(candidates_.size());
+  for (const Domain::Chunk *chunk : candidates_) {
+    candidate_keys_.push_back(packCoord(chunk->world_x / Domain::Chunk::SIZE,
+                                        chunk->world_y / Domain::Chunk::SIZE,
+                                        floor_z));
+  }
+  std::sort(candidate_keys_.begin(), candidate_keys_.end());
 
-  // Process each chunk
-  visible_chunks_.reserve(chunk_buffer_.size());
+  std::vector<uint64_t> changed;
+  std::set_difference(candidate_keys_.begin(), candidate_keys_.end(),
+                      previous_keys_.begin(), previous_keys_.end(),
+                      std::back_inserter(changed));
+  entered_.clear();
+  std::transform(changed.begin(), changed.end(), std::back_inserter(entered_),
+                 unpackCoord);
 
-  for (Domain::Chunk *chunk : chunk_buffer_) {
-    addVisibleChunk(chunk, floor_offset, bounds);
+  changed.clear();
+  std::set_difference(previous_keys_.begin(), previous_keys_.end(),
+                      candidate_keys_.begin(), candidate_keys_.end(),
+                      std::back_inserter(changed));
+  left_.clear();
+  std::transform(changed.begin(), changed.end(), std::back_inserter(left_),
+                 unpackCoord);
+}
+
+bool ChunkVisibilityManager::visibleListCurrent() const {
+  size_t index = 0;
+  for (Domain::Chunk *chunk : candidates_) {
+    if (chunk->isEmpty()) {
+      continue;
+    }
+    if (index >= visible_chunks_.size() ||
+        visible_chunks_[index].chunk != chunk) {
+      return false;
+    }
+    ++index;
   }
+  return index == visible_chunks_.size();
 }
 
-void ChunkVisibilityManager::addVisibleChunk(Domain::Chunk *chunk,
-                                             float floor_offset,
-                                             const VisibleBounds &bounds) {
+void ChunkVisibilityManager::rebuildVisibleList() {
+  visible_chunks_.clear();
+  visible_chunks_.reserve(candidates_.size());
 
-  VisibleChunk vc;
-  vc.chunk = chunk;
+  for (Domain::Chunk *chunk : candidates_) {
+    if (chunk->isEmpty()) {
+      continue;
+    }
 
-  // Calculate screen position with floor offset for parallax
-  vc.screen_x = chunk->world_x * TILE_SIZE - floor_offset;
-  vc.screen_y = chunk->world_y * TILE_SIZE - floor_offset;
+    VisibleChunk vc;
+    vc.chunk = chunk;
 
-  // Determine if chunk is fully within viewport (enables fast path)
-  vc.fully_visible = chunk->world_x >= bounds.start_x &&
-                     chunk->world_x + Domain::Chunk::SIZE <= bounds.end_x &&
-                     chunk->world_y >= bounds.start_y &&
-                     chunk->world_y + Domain::Chunk::SIZE <= bounds.end_y;
+    // Calculate screen position with floor offset for parallax
+    vc.screen_x = chunk->world_x * TILE_SIZE - last_offset_;
+    vc.screen_y = chunk->world_y * TILE_SIZE - last_offset_;
 
-  visible_chunks_.push_back(vc);
+    // Determine if chunk is fully within viewport (enables fast path)
+    vc.fully_visible =
+        chunk->world_x >= last_bounds_.start_x &&
+        chunk->world_x + Domain::Chunk::SIZE <= last_bounds_.end_x &&
+        chunk->world_y >= last_bounds_.start_y &&
+        chunk->world_y + Domain::Chunk::SIZE <= last_bounds_.end_y;
+
+    visible_chunks_.push_back(vc);
+  }
 }
 
 } // namespace Rendering
@@ -27,10 +27,25 @@ struct VisibleChunk {
       false; // True if chunk is entirely within viewport (fast path)
 };
 
+/**
+ * Chunk coordinates of a chunk entering or leaving the visible region.
+ */
+struct ChunkCoord {
+  int32_t x = 0;
+  int32_t y = 0;
+  int8_t z = 0;
+};
+
 /**
  * Determines which chunks are visible in the current viewport.
  * Handles culling, ordering, and screen position calculation.
  *
+ * Visibility is incremental: the map is only queried when the bounds, floor
+ * or the floor's chunk layout change. Otherwise the previous candidate set
+ * (allocated chunks in the region, including empty ones) is re-filtered, and
+ * the visible list is kept as-is when nothing became empty or non-empty.
+ * Each query also records which chunks entered and left the region.
+ *
  * Extracted from MapRenderer to separate visibility logic from rendering.
  */
 class ChunkVisibilityManager {
@@ -39,7 +54,8 @@ public:
 
   /**
    * Update visible chunks for a given floor.
-   * This rebuilds the visibility list.
+   * Only touches this instance and reads the map, so separate instances may
+   * update concurrently.
    * @param map The chunked map to query
    * @param bounds Visible tile bounds
    * @param floor_z Floor to query
@@ -60,20 +76,41 @@ public:
    */
   size_t getVisibleChunkCount() const { return visible_chunks_.size(); }
 
+  /**
+   * Chunks that entered / left the region in the last update().
+   * Both are empty when the region did not change.
+   */
+  const std::vector<ChunkCoord> &getEnteredChunks() const { return entered_; }
+  const std::vector<ChunkCoord> &getLeftChunks() const { return left_; }
+
   /**
    * Reserve capacity for expected chunk count (reduces allocations).
    */
   void reserve(size_t capacity) {
     visible_chunks_.reserve(capacity);
-    chunk_buffer_.reserve(capacity);
+    candidates_.reserve(capacity);
   }
 
 private:
+  void queryCandidates(const Domain::ChunkedMap &map,
+                       const VisibleBounds &bounds, int8_t floor_z);
+  bool visibleListCurrent() const;
+  void rebuildVisibleList();
+
   std::vector<VisibleChunk> visible_chunks_;
-  std::vector<Domain::Chunk *> chunk_buffer_; // Reusable buffer for map query
+  std::vector<Domain::Chunk *> candidates_; // Allocated chunks in region
+  std::vector<uint64_t> candidate_keys_;    // Sorted, for diffing
+  std::vector<uint64_t> previous_keys_;
+  std::vector<ChunkCoord> entered_;
+  std::vector<ChunkCoord> left_;
 
-  void addVisibleChunk(Domain::Chunk *chunk, float floor_offset,
-                       const VisibleBounds &bounds);
+  // Last query
+  const Domain::ChunkedMap *last_map_ = nullptr;
+  VisibleBounds last_bounds_;
+  uint32_t last_layout_ = 0;
+  int8_t last_floor_ = 0;
+  float last_offset_ = 0.0f;
+  bool has_query_ = false;
 };
 
 } // namespace Rendering
@@ -0,0 +1,144 @@
+#include "Rendering/Visibility/FloorCoverage.h"
+#include "Domain/ChunkedMap.h"
+#include "Domain/Item.h"
+#include "Domain/ItemType.h"
+#include "Domain/Tile.h"
+#include "Rendering/Visibility/FloorIterator.h"
+#include <cmath>
+
+namespace MapEditor {
+namespace Rendering {
+
+namespace {
+
+// Window around a chunk: OVERHANG extra tiles up and left of it
+constexpr int OVERHANG = 2;
+constexpr int WINDOW = FloorCoverage::SIZE + OVERHANG;
+constexpr uint64_t WINDOW_MASK = (uint64_t{1} << WINDOW) - 1;
+
+} // anonymous namespace
+
+void FloorCoverage::beginFrame() {
+  ++frame_;
+  if (chunks_.size() > Config::Performance::COVERAGE_CHUNK_CACHE_LIMIT) {
+    for (auto it = chunks_.begin(); it != chunks_.end();) {
+      // Keep masks used last frame; they are likely needed again
+      if (frame_ - it->second.last_used > 1) {
+        it = chunks_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+bool FloorCoverage::computeOccluded(const Domain::ChunkedMap &map,
+                                    const Domain::Chunk &chunk, int floor_z,
+                                    int top_z, int current_floor, Rows &out) {
+  // Coverage of the window rows (wy - OVERHANG .. wy + SIZE - 1); bit i of a
+  // row is tile x = wx - OVERHANG + i
+  std::array<uint64_t, WINDOW> window{};
+  bool any = false;
+
+  const float offset = FloorIterator::getFloorOffset(current_floor, floor_z);
+  for (int upper_z = floor_z - 1; upper_z >= top_z; --upper_z) {
+    // Tile (x, y) shares its screen footprint with (x + d, y + d) above
+    const float tiles =
+        (FloorIterator::getFloorOffset(current_floor, upper_z) - offset) /
+        Config::Rendering::TILE_SIZE;
+    const int d = static_cast<int>(std::lround(tiles));
+    if (d <= 0) {
+      continue;
+    }
+
+    const int32_t x0 = chunk.world_x - OVERHANG + d; // Upper-floor tile x
+    const int32_t y0 = chunk.world_y - OVERHANG + d;
+    const int32_t chunk_x0 = x0 >> 5;
+    const int32_t chunk_y0 = y0 >> 5;
+    const int bit = x0 & (SIZE - 1);
+
+    // The window spans at most 3x3 upper chunks
+    const ChunkMask *masks[3][3];
+    bool found = false;
+    for (int j = 0; j < 3; ++j) {
+      for (int i = 0; i < 3; ++i) {
+        masks[j][i] = getMask(map, chunk_x0 + i, chunk_y0 + j, upper_z);
+        found = found || masks[j][i];
+      }
+    }
+    if (!found) {
+      continue;
+    }
+
+    for (int row = 0; row < WINDOW; ++row) {
+      const int32_t y = y0 + row;
+      const int j = (y >> 5) - chunk_y0;
+      const int local_y = y & (SIZE - 1);
+      uint64_t bits = 0;
+      for (int i = 0; i < 3; ++i) {
+        // Window bit where this chunk's local x = 0 lands
+        const int shift = i * SIZE - bit;
+        if (!masks[j][i] || shift >= WINDOW) {
+          continue;
+        }
+        const uint64_t chunk_row = masks[j][i]->rows[local_y];
+        bits |= shift >= 0 ? chunk_row << shift : chunk_row >> -shift;
+      }
+      bits &= WINDOW_MASK;
+      window[row] |= bits;
+      any = any || bits;
+    }
+  }
+
+  if (!any) {
+    return false;
+  }
+
+  // Erode: a tile is hidden if it and the OVERHANG tiles up/left are covered
+  for (uint64_t &row : window) {
+    row &= (row << 1) & (row << 2);
+  }
+  bool hidden = false;
+  for (int y = 0; y < SIZE; ++y) {
+    const uint64_t rows =
+        window[y + 2] & window[y + 1] & window[y]; // y, y-1, y-2
+    out[y] = static_cast<uint32_t>(rows >> OVERHANG);
+    hidden = hidden || out[y];
+  }
+  return hidden;
+}
+
+const FloorCoverage::ChunkMask *
+FloorCoverage::getMask(const Domain::ChunkedMap &map, int32_t chunk_x,
+                       int32_t chunk_y, int floor) {
+  const Domain::Chunk *chunk =
+      map.getChunk(chunk_x, chunk_y, static_cast<int16_t>(floor));
+  if (!chunk) {
+    return nullptr;
+  }
+
+  ChunkMask &mask = chunks_[makeKey(chunk_x, chunk_y, floor)];
+  mask.last_used = frame_;
+  if (mask.revision != chunk->getRevision()) {
+    buildMask(mask, *chunk);
+  }
+  return mask.any ? &mask : nullptr;
+}
+
+void FloorCoverage::buildMask(ChunkMask &mask, const Domain::Chunk &chunk) {
+  mask.rows.fill(0);
+  mask.any = false;
+  chunk.forEachTileWithCoords(
+      [&](const Domain::Tile *tile, int local_x, int local_y) {
+        const Domain::Item *ground = tile->getGround();
+        const Domain::ItemType *type = ground ? ground->getType() : nullptr;
+        if (type && type->is_full_ground && !type->is_translucent) {
+          mask.rows[local_y] |= uint32_t{1} << local_x;
+          mask.any = true;
+        }
+      });
+  mask.revision = chunk.getRevision();
+}
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -0,0 +1,85 @@
+#pragma once
+#include "Core/Config.h"
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+namespace MapEditor {
+
+namespace Domain {
+class ChunkedMap;
+class Chunk;
+} // namespace Domain
+
+namespace Rendering {
+
+/**
+ * Occlusion of lower-floor tiles by opaque ground on the floors drawn above.
+ *
+ * Each chunk gets a bitmask of tiles whose ground is a full, non-translucent
+ * ground sprite, rebuilt only when the chunk revision changes. For a chunk
+ * on a lower floor, the masks of the floors above are projected through the
+ * per-floor parallax shift into one coverage mask. A tile counts as hidden
+ * only if it and the two tiles up and to the left of it in both directions
+ * are covered, since large and elevated sprites overhang up-left by up to
+ * two tiles.
+ *
+ * Usage per frame:
+ *   coverage.beginFrame();
+ *   if (coverage.computeOccluded(map, chunk, z, floors_above..., rows))
+ *     skip tiles with (rows[ly] >> lx) & 1
+ */
+class FloorCoverage {
+public:
+  static constexpr int SIZE = Config::Performance::CHUNK_SIZE;
+  using Rows = std::array<uint32_t, SIZE>;
+
+  /**
+   * Advance the frame counter and drop stale chunk masks over the limit.
+   */
+  void beginFrame();
+
+  /**
+   * Build the hidden-tile mask of a chunk drawn below other floors.
+   * @param floor_z Floor of the chunk
+   * @param top_z Topmost floor drawn (lowest z); floors top_z..floor_z-1
+   *              are the ones covering this chunk
+   * @param current_floor Floor being viewed (for the parallax shift)
+   * @param out Per-row bitmask of hidden tiles (bit x = local x)
+   * @return true if any tile is hidden
+   */
+  bool computeOccluded(const Domain::ChunkedMap &map,
+                       const Domain::Chunk &chunk, int floor_z, int top_z,
+                       int current_floor, Rows &out);
+
+  size_t getCachedChunkCount() const { return chunks_.size(); }
+
+private:
+  struct ChunkMask {
+    Rows rows{};
+    uint32_t revision = 0; // 0 = not built
+    uint32_t last_used = 0;
+    bool any = false;
+  };
+
+  static uint64_t makeKey(int32_t chunk_x, int32_t chunk_y, int floor) {
+    // Same packing as ChunkSpriteCache: 24 bits x, 24 bits y, 8 bits floor
+    uint64_t key = 0;
+    key |= (static_cast<uint64_t>(chunk_x + 0x800000) & 0xFFFFFF) << 32;
+    key |= (static_cast<uint64_t>(chunk_y + 0x800000) & 0xFFFFFF) << 8;
+    key |= static_cast<uint64_t>(floor & 0xFF);
+    return key;
+  }
+
+  // Opaque-ground mask of the chunk at chunk coords on a floor, or nullptr
+  const ChunkMask *getMask(const Domain::ChunkedMap &map, int32_t chunk_x,
+                           int32_t chunk_y, int floor);
+
+  static void buildMask(ChunkMask &mask, const Domain::Chunk &chunk);
+
+  std::unordered_map<uint64_t, ChunkMask> chunks_;
+  uint32_t frame_ = 0;
+};
+
+} // namespace Rendering
+} // namespace MapEditor
@@ -85,9 +85,64 @@ bool FloorVisibilityCalculator::isLookPossible(const Domain::Tile* tile) const {
     return true;
 }
 
+void FloorVisibilityCalculator::clear() {
+    chunks_.clear();
+    memo_map_ = nullptr;
+    memo_reads_.clear();
+}
+
 int FloorVisibilityCalculator::calcFirstVisibleFloor(
+    const Domain::ChunkedMap& map,
+    int camera_x, int camera_y, int camera_z)
+{
+    if (memoCurrent(map, camera_x, camera_y, camera_z)) {
+        return memo_result_;
+    }
+
+    ++scan_;
+    memo_reads_.clear();
+    memo_result_ = scanFirstVisibleFloor(map, camera_x, camera_y, camera_z);
+    memo_map_ = &map;
+    memo_x_ = camera_x;
+    memo_y_ = camera_y;
+    memo_z_ = camera_z;
+
+    // Only a few chunks are read per scan; drop the ones this scan skipped
+    if (chunks_.size() > Config::Performance::FLOOR_BLOCKER_CACHE_LIMIT) {
+        for (auto it = chunks_.begin(); it != chunks_.end();) {
+            if (it->second.last_used != scan_) {
+                it = chunks_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    return memo_result_;
+}
+
+bool FloorVisibilityCalculator::memoCurrent(
     const Domain::ChunkedMap& map,
     int camera_x, int camera_y, int camera_z) const
+{
+    if (memo_map_ != &map || memo_x_ != camera_x || memo_y_ != camera_y ||
+        memo_z_ != camera_z) {
+        return false;
+    }
+    // Chunk revisions are unique, so a match means nothing read has changed
+    // (and a missing chunk that was recorded as 0 has not been created)
+    for (const ChunkRead& read : memo_reads_) {
+        const Domain::Chunk* chunk =
+            map.getChunk(read.chunk_x, read.chunk_y, read.z);
+        if ((chunk ? chunk->getRevision() : 0) != read.revision) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int FloorVisibilityCalculator::scanFirstVisibleFloor(
+    const Domain::ChunkedMap& map,
+    int camera_x, int camera_y, int camera_z)
 {
     using FC = FloorConstants;
     
@@ -109,19 +164,21 @@ int FloorVisibilityCalculator::calcFirstVisibleFloor(
             bool is_center = (ix == 0 && iy == 0);
             bool is_diagonal = (std::abs(ix) == std::abs(iy)) && !is_center;
             
+            bool can_look =
+                !(getTileBits(map, pos_x, pos_y, camera_z) & LOOK_BLOCKED);
+            
             // For diagonal tiles, check if we can look through (window/door)
-            if (!is_center && is_diagonal) {
-                const Domain::Tile* current_tile = map.getTile(pos_x, pos_y, camera_z);
-                if (!isLookPossible(current_tile)) {
-                    continue;  // Can't look diagonally through solid tiles
-                }
+            if (!is_center && is_diagonal && !can_look) {
+                continue;  // Can't look diagonally through solid tiles
             }
             
+            // Tile directly above is judged in free view unless we can look
+            // through ours; the covered tile the other way round
+            const uint8_t upper_limit = can_look ? LIMITS_PLAYER : LIMITS_FREE;
+            const uint8_t covered_limit = can_look ? LIMITS_FREE : LIMITS_PLAYER;
+            
             // Walk up through floors checking for blockers
             // OTClient uses coveredUp which shifts x+1, y+1, z-1
-            int check_x = pos_x;
-            int check_y = pos_y;
-            
             for (int check_z = camera_z - 1; check_z >= first_floor; --check_z) {
                 // Apply covered position shift (each floor up = x+1, y+1)
                 int z_diff = camera_z - check_z;
@@ -129,17 +186,14 @@ int FloorVisibilityCalculator::calcFirstVisibleFloor(
                 int covered_y = pos_y + z_diff;
                 
                 // Check tile directly above (physical position)
-                const Domain::Tile* upper_tile = map.getTile(pos_x, pos_y, check_z);
-                bool can_look = isLookPossible(map.getTile(pos_x, pos_y, camera_z));
-                
-                if (upper_tile && tileLimitsFloorsView(upper_tile, !can_look)) {
+                if (getTileBits(map, pos_x, pos_y, check_z) & upper_limit) {
                     first_floor = check_z + 1;
                     break;
                 }
                 
                 // Check tile geometrically above (covered position)
-                const Domain::Tile* covered_tile = map.getTile(covered_x, covered_y, check_z);
-                if (covered_tile && tileLimitsFloorsView(covered_tile, can_look)) {
+                if (getTileBits(map, covered_x, covered_y, check_z) &
+                    covered_limit) {
                     first_floor = check_z + 1;
                     break;
                 }
@@ -150,6 +204,70 @@ int FloorVisibilityCalculator::calcFirstVisibleFloor(
     return std::clamp(first_floor, 0, static_cast<int>(FC::MAX_Z));
 }
 
+uint8_t FloorVisibilityCalculator::getTileBits(
+    const Domain::ChunkedMap& map, int x, int y, int z)
+{
+    const int32_t chunk_x = x >> 5;
+    const int32_t chunk_y = y >> 5;
+    const Domain::Chunk* chunk =
+        map.getChunk(chunk_x, chunk_y, static_cast<int16_t>(z));
+    const uint32_t revision = chunk ? chunk->getRevision() : 0;
+
+    // Record the read for memo validation (a scan touches only a few chunks)
+    bool recorded = false;
+    for (const ChunkRead& read : memo_reads_) {
+        if (read.chunk_x == chunk_x && read.chunk_y == chunk_y &&
+            read.z == z) {
+            recorded = true;
+            break;
+        }
+    }
+    if (!recorded) {
+        memo_reads_.push_back(
+            {chunk_x, chunk_y, static_cast<int16_t>(z), revision});
+    }
+
+    if (!chunk) {
+        return 0;
+    }
+
+    ChunkBlockers& blockers = chunks_[makeKey(chunk_x, chunk_y, z)];
+    blockers.last_used = scan_;
+    if (blockers.revision != revision) {
+        buildBlockers(blockers, *chunk);
+    }
+
+    const int local_x = x & (CHUNK_SIZE - 1);
+    const int local_y = y & (CHUNK_SIZE - 1);
+    uint8_t bits = 0;
+    if ((blockers.limits_free[local_y] >> local_x) & 1) bits |= LIMITS_FREE;
+    if ((blockers.limits_player[local_y] >> local_x) & 1) bits |= LIMITS_PLAYER;
+    if ((blockers.look_blocked[local_y] >> local_x) & 1) bits |= LOOK_BLOCKED;
+    return bits;
+}
+
+void FloorVisibilityCalculator::buildBlockers(
+    ChunkBlockers& blockers, const Domain::Chunk& chunk) const
+{
+    blockers.limits_free.fill(0);
+    blockers.limits_player.fill(0);
+    blockers.look_blocked.fill(0);
+    chunk.forEachTileWithCoords(
+        [&](const Domain::Tile* tile, int local_x, int local_y) {
+            const uint32_t bit = uint32_t{1} << local_x;
+            if (tileLimitsFloorsView(tile, true)) {
+                blockers.limits_free[local_y] |= bit;
+            }
+            if (tileLimitsFloorsView(tile, false)) {
+                blockers.limits_player[local_y] |= bit;
+            }
+            if (!isLookPossible(tile)) {
+                blockers.look_blocked[local_y] |= bit;
+            }
+        });
+    blockers.revision = chunk.getRevision();
+}
+
 int FloorVisibilityCalculator::calcLastVisibleFloor(int camera_z) const {
     using FC = FloorConstants;
     
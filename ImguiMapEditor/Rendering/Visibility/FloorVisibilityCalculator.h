@@ -1,8 +1,12 @@
 #pragma once
 #include "Domain/ChunkedMap.h"
 #include "Domain/ItemType.h"
+#include "Core/Config.h"
 #include "Services/ClientDataService.h"
+#include <array>
 #include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace MapEditor {
 namespace Rendering {
@@ -28,6 +32,11 @@ struct FloorConstants {
  * - Ground tiles block view unless translucent
  * - isOnBottom items (walls) block view unless isDontHide
  * - Windows/doors (isLookPossible) allow viewing diagonal tiles
+ *
+ * Tile properties are cached per chunk as bitmasks (view-limiting for free
+ * and player view, look-blocking), rebuilt only when the chunk revision
+ * changes, so the scan is a handful of bit tests. The result is memoized per
+ * camera tile and reused until one of the chunks it read changes.
  */
 class FloorVisibilityCalculator {
 public:
@@ -44,7 +53,7 @@ public:
      */
     int calcFirstVisibleFloor(
         const Domain::ChunkedMap& map,
-        int camera_x, int camera_y, int camera_z) const;
+        int camera_x, int camera_y, int camera_z);
     
     /**
      * Calculate last (deepest) visible floor from camera position.
@@ -71,8 +80,72 @@ public:
      */
     bool isLookPossible(const Domain::Tile* tile) const;
 
+    /**
+     * Drop cached chunk masks and the memoized result (e.g. after item
+     * types were reloaded).
+     */
+    void clear();
+
 private:
+    static constexpr int CHUNK_SIZE = Config::Performance::CHUNK_SIZE;
+    using Rows = std::array<uint32_t, CHUNK_SIZE>;
+
+    // Per-tile bits, one row mask per local y (bit x = local x)
+    struct ChunkBlockers {
+        Rows limits_free{};   // tileLimitsFloorsView(tile, true)
+        Rows limits_player{}; // tileLimitsFloorsView(tile, false)
+        Rows look_blocked{};  // !isLookPossible(tile)
+        uint32_t revision = 0; // 0 = not built
+        uint32_t last_used = 0;
+    };
+
+    enum TileBit : uint8_t {
+        LIMITS_FREE = 1 << 0,
+        LIMITS_PLAYER = 1 << 1,
+        LOOK_BLOCKED = 1 << 2,
+    };
+
+    // A chunk read by the memoized scan (revision 0 = no chunk)
+    struct ChunkRead {
+        int32_t chunk_x;
+        int32_t chunk_y;
+        int16_t z;
+        uint32_t revision;
+    };
+
+    static uint64_t makeKey(int32_t chunk_x, int32_t chunk_y, int floor) {
+        // Same packing as ChunkSpriteCache: 24 bits x, 24 bits y, 8 bits floor
+        uint64_t key = 0;
+        key |= (static_cast<uint64_t>(chunk_x + 0x800000) & 0xFFFFFF) << 32;
+        key |= (static_cast<uint64_t>(chunk_y + 0x800000) & 0xFFFFFF) << 8;
+        key |= static_cast<uint64_t>(floor & 0xFF);
+        return key;
+    }
+
+    int scanFirstVisibleFloor(
+        const Domain::ChunkedMap& map,
+        int camera_x, int camera_y, int camera_z);
+
+    // TileBit flags of a tile (0 for missing tiles)
+    uint8_t getTileBits(const Domain::ChunkedMap& map, int x, int y, int z);
+
+    bool memoCurrent(const Domain::ChunkedMap& map, int camera_x,
+                     int camera_y, int camera_z) const;
+
+    void buildBlockers(ChunkBlockers& blockers, const Domain::Chunk& chunk) const;
+
     Services::ClientDataService* client_data_;
+
+    std::unordered_map<uint64_t, ChunkBlockers> chunks_;
+    uint32_t scan_ = 0; // Scan counter for cache trimming
+
+    // Memoized result for the last camera tile
+    const Domain::ChunkedMap* memo_map_ = nullptr;
+    int memo_x_ = 0;
+    int memo_y_ = 0;
+    int memo_z_ = -1;
+    int memo_result_ = 0;
+    std::vector<ChunkRead> memo_reads_;
     
     /**
      * Get ItemType for an item's client ID.
@@ -53,6 +53,8 @@ struct VisibleBounds {
     expanded.end_y += floor_diff;
     return expanded;
   }
+
+  bool operator==(const VisibleBounds &) const = default;
 };
 
 } // namespace Rendering
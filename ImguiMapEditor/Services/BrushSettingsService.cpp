@@ -186,6 +186,15 @@ BrushSettingsService::getBrushPositions(const Domain::Position &center) const {
   return positions;
 }
 
+const std::vector<std::pair<int, int>> &
+BrushSettingsService::getStampOffsets() const {
+  if (!stampValid_) {
+    stampOffsets_ = getBrushOffsets();
+    stampValid_ = true;
+  }
+  return stampOffsets_;
+}
+
 std::vector<std::pair<int, int>> BrushSettingsService::getBrushOffsets() const {
   switch (type_) {
   case BrushType::Square:
@@ -382,6 +391,7 @@ bool BrushSettingsService::loadCustomBrushes(const std::string &filepath) {
       brush.computeOffsets();
       customBrushes_.push_back(std::move(brush));
     }
+    stampValid_ = false;
 
     spdlog::info("Loaded {} custom brushes from {}", customBrushes_.size(),
                  filepath);
@@ -398,6 +408,7 @@ bool BrushSettingsService::loadCustomBrushes(const std::string &filepath) {
 // ========================
 
 void BrushSettingsService::notifyChanged() {
+  stampValid_ = false;
   if (onSettingsChanged_) {
     onSettingsChanged_();
   }
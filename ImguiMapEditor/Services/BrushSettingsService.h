@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/Config.h"
 #include "Domain/Position.h"
 #include <algorithm>
 #include <cmath>
@@ -211,6 +212,13 @@ public:
    */
   std::vector<std::pair<int, int>> getBrushOffsets() const;
 
+  /**
+   * Cached getBrushOffsets() result, rebuilt only after a settings change.
+   * Use this in per-frame paths (stroke painting) to avoid recomputing and
+   * allocating the stamp for every interpolated point.
+   */
+  const std::vector<std::pair<int, int>> &getStampOffsets() const;
+
   // ========================
   // Persistence
   // ========================
@@ -270,6 +278,31 @@ public:
   }
   int getDefaultSpawnTime() const { return defaultSpawnTime_; }
 
+  // ========================
+  // Fill Mode
+  // ========================
+
+  /**
+   * Enable/disable area fill: a click fills the connected region of the
+   * clicked tile's ground instead of painting the brush shape.
+   */
+  void setFillMode(bool enabled) {
+    fillMode_ = enabled;
+    notifyChanged();
+  }
+  bool isFillMode() const { return fillMode_; }
+
+  /**
+   * Largest region (tiles) a single fill may cover; larger fills are refused.
+   */
+  void setFillLimit(int tiles) {
+    fillLimit_ = std::clamp(tiles, 1, MAX_FILL_LIMIT);
+    notifyChanged();
+  }
+  int getFillLimit() const { return fillLimit_; }
+
+  static constexpr int MAX_FILL_LIMIT = 1 << 20;
+
 private:
   BrushType type_ = BrushType::Square;
   BrushSizeMode sizeMode_ = BrushSizeMode::Standard;
@@ -282,11 +315,20 @@ private:
 
   OnSettingsChangedCallback onSettingsChanged_;
 
+  // Stamp cache for getStampOffsets()
+  mutable std::vector<std::pair<int, int>> stampOffsets_;
+  mutable bool stampValid_ = false;
+
   // Spawn settings
   bool autoCreateSpawn_ = false;
   int defaultSpawnRadius_ = 3;
   int defaultSpawnTime_ = 60; // seconds
 
+  // Fill mode settings
+  bool fillMode_ = false;
+  int fillLimit_ =
+      static_cast<int>(Config::Performance::BRUSH_FILL_MAX_TILES);
+
   void notifyChanged();
 
   // Position calculation helpers
@@ -337,6 +337,7 @@ void ClientDataService::mergeOtbWithDat(
 
       // Copy ground flag from DAT
       merged.is_ground = dat->is_ground;
+      merged.is_full_ground = dat->full_ground;
 
       // Merge light info
       if (dat->has_light) {
@@ -394,6 +395,9 @@ void ClientDataService::mergeOtbWithDat(
       merged.is_fluid_container = dat->is_fluid_container;
     }
 
+    // Precompute the renderer's sprite layout once appearance is final
+    merged.buildDrawRecipe();
+
     // Store the item
     size_t index = items_.size();
     items_.push_back(std::move(merged));
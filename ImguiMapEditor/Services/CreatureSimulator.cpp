@@ -2,6 +2,8 @@
 #include "ClientDataService.h"
 #include "Domain/ItemType.h"
 #include "Core/Config.h"
+#include "Core/WorkerPool.h"
+#include <algorithm>
 #include <cmath>
 
 namespace MapEditor {
@@ -10,102 +12,186 @@ namespace Services {
 // Use centralized Config values
 using namespace Config::Simulation;
 
+namespace {
+
+bool isBlockingType(const Domain::ItemType* type) {
+    return type && (type->is_blocking ||
+                    type->hasFlag(Domain::ItemFlag::Unpassable) ||
+                    type->hasFlag(Domain::ItemFlag::BlockPathfinder));
+}
+
+void directionDelta(int direction, int& dx, int& dy) {
+    dx = 0;
+    dy = 0;
+    switch (direction) {
+        case 0: dy = -1; break; // North
+        case 1: dx = 1; break;  // East
+        case 2: dy = 1; break;  // South
+        case 3: dx = -1; break; // West
+    }
+}
+
+void advanceWalk(CreatureAnimState& state, float delta_time) {
+    // Update walk animation progress
+    state.walk_progress += delta_time / WALK_DURATION_SEC;
+
+    if (state.walk_progress >= 1.0f) {
+        // Walk complete
+        state.walk_progress = 1.0f;
+        state.is_walking = false;
+        state.walk_offset_x = 0.0f;
+        state.walk_offset_y = 0.0f;
+        state.animation_frame = 0;
+        return;
+    }
+
+    // Interpolate walk offset (from 1.0 to 0.0)
+    float remaining = 1.0f - state.walk_progress;
+
+    int dx = 0, dy = 0;
+    directionDelta(state.direction, dx, dy);
+
+    // Creature walks FROM the offset toward current position
+    state.walk_offset_x = -dx * remaining;
+    state.walk_offset_y = -dy * remaining;
+
+    // Animation frame (0-3)
+    state.animation_frame = static_cast<int>(state.walk_progress * 4) % 4;
+}
+
+} // anonymous namespace
+
 CreatureSimulator::CreatureSimulator() 
     : rng_(std::random_device{}()),
-      chance_dist_(0.0f, 1.0f),
-      interval_dist_(Config::Simulation::RANDOM_MOVE_INTERVAL_MIN, Config::Simulation::RANDOM_MOVE_INTERVAL_MAX),
-      direction_dist_(0, NUM_DIRECTIONS - 1) {
+      interval_dist_(Config::Simulation::RANDOM_MOVE_INTERVAL_MIN, Config::Simulation::RANDOM_MOVE_INTERVAL_MAX) {
 }
 
+CreatureSimulator::~CreatureSimulator() = default;
+CreatureSimulator::CreatureSimulator(CreatureSimulator&&) noexcept = default;
+CreatureSimulator& CreatureSimulator::operator=(CreatureSimulator&&) noexcept = default;
+
 void CreatureSimulator::update(float delta_time,
                                const Domain::Position& viewport_min,
                                const Domain::Position& viewport_max,
                                int current_floor,
                                Domain::ChunkedMap* map,
                                ClientDataService* client_data) {
-    if (!enabled_) return;
-    
-    // Performance: Rebuild spatial index once per frame
-    occupied_positions_.clear();
-    // Pre-allocate to avoid rehashes (approx size matches active creatures)
-    occupied_positions_.reserve(states_.size());
+    if (!enabled_ || buckets_.empty()) return;
+
+    // Chunks touching the viewport (with margin) step every frame
+    constexpr int margin = 2;
+    const int32_t near_min_x = toChunk(viewport_min.x - margin);
+    const int32_t near_min_y = toChunk(viewport_min.y - margin);
+    const int32_t near_max_x = toChunk(viewport_max.x + margin);
+    const int32_t near_max_y = toChunk(viewport_max.y + margin);
+
+    jobs_.clear();
+    size_t stepped_creatures = 0;
+    for (auto it = buckets_.begin(); it != buckets_.end();) {
+        if (it->second.creatures.empty()) {
+            it = buckets_.erase(it);
+            continue;
+        }
+        ChunkBucket& bucket = it->second;
+        ++it;
 
-    for (const auto& [key, state] : states_) {
-        // Only track creatures on current floor for collision
-        if (state.current_pos.z == current_floor) {
-            occupied_positions_[state.current_pos]++;
+        const bool near = bucket.z == current_floor &&
+                          bucket.chunk_x >= near_min_x && bucket.chunk_x <= near_max_x &&
+                          bucket.chunk_y >= near_min_y && bucket.chunk_y <= near_max_y;
+        float step_time = delta_time;
+        if (near) {
+            bucket.far_time = 0.0f;
+        } else {
+            bucket.far_time += delta_time;
+            if (bucket.far_time < FAR_STEP_INTERVAL_SEC) continue;
+            step_time = bucket.far_time;
+            bucket.far_time = 0.0f;
+        }
+        jobs_.push_back({&bucket, step_time});
+        stepped_creatures += bucket.creatures.size();
+    }
+    if (jobs_.empty()) return;
+
+    // Walk masks for stepped chunks and the neighbours a move can reach.
+    // Built here so the parallel steps only read them.
+    if (map) {
+        // Masks of chunks nobody walks in any more are dropped in bulk
+        if (walk_mask_client_data_ != client_data ||
+            walk_masks_.size() > 8 * buckets_.size() + 256) {
+            walk_masks_.clear();
+            walk_mask_client_data_ = client_data;
+        }
+        for (const auto& job : jobs_) {
+            const ChunkBucket& b = *job.bucket;
+            ensureWalkMask(b.chunk_x, b.chunk_y, b.z, *map, client_data);
+            ensureWalkMask(b.chunk_x - 1, b.chunk_y, b.z, *map, client_data);
+            ensureWalkMask(b.chunk_x + 1, b.chunk_y, b.z, *map, client_data);
+            ensureWalkMask(b.chunk_x, b.chunk_y - 1, b.z, *map, client_data);
+            ensureWalkMask(b.chunk_x, b.chunk_y + 1, b.z, *map, client_data);
+        }
+    } else {
+        walk_masks_.clear();
+    }
+
+    const bool parallel = stepped_creatures >= PARALLEL_MIN_CREATURES && jobs_.size() > 1;
+    if (parallel && !workers_) {
+        workers_ = std::make_unique<WorkerPool>(WORKER_THREADS);
+    }
+
+    const size_t context_count = parallel ? workers_->size() : 1;
+    while (contexts_.size() < context_count) {
+        contexts_.emplace_back();
+        contexts_.back().rng.seed(rng_());
+    }
+    for (auto& ctx : contexts_) {
+        ctx.proposals.clear();
+    }
+
+    if (parallel) {
+        workers_->run(jobs_.size(), [this](size_t job, size_t worker) {
+            stepBucket(*jobs_[job].bucket, jobs_[job].delta_time, contexts_[worker]);
+        });
+    } else {
+        for (const auto& job : jobs_) {
+            stepBucket(*job.bucket, job.delta_time, contexts_[0]);
         }
     }
 
-    for (auto& [key, state] : states_) {
-        // Skip if not on current floor
-        if (state.current_pos.z != current_floor) continue;
-        
-        // Skip if outside viewport (with margin)
-        int margin = 2;
-        if (state.current_pos.x < viewport_min.x - margin || state.current_pos.x > viewport_max.x + margin ||
-            state.current_pos.y < viewport_min.y - margin || state.current_pos.y > viewport_max.y + margin) {
+    // Resolve moves serially: occupancy and bucket membership change here
+    for (auto& ctx : contexts_) {
+        for (const auto& proposal : ctx.proposals) {
+            commitMove(proposal);
+        }
+    }
+}
+
+void CreatureSimulator::stepBucket(const ChunkBucket& bucket, float delta_time,
+                                   StepContext& ctx) const {
+    for (CreatureAnimState* state : bucket.creatures) {
+        if (state->is_walking) {
+            advanceWalk(*state, delta_time);
             continue;
         }
-        
-        if (state.is_walking) {
-            // Update walk animation progress
-            state.walk_progress += delta_time / WALK_DURATION_SEC;
-            
-            if (state.walk_progress >= 1.0f) {
-                // Walk complete
-                state.walk_progress = 1.0f;
-                state.is_walking = false;
-                state.walk_offset_x = 0.0f;
-                state.walk_offset_y = 0.0f;
-                state.animation_frame = 0;
-            } else {
-                // Interpolate walk offset (from 1.0 to 0.0)
-                float remaining = 1.0f - state.walk_progress;
-                
-                int dx = 0, dy = 0;
-                switch (state.direction) {
-                    case 0: dy = -1; break; // North
-                    case 1: dx = 1; break;  // East
-                    case 2: dy = 1; break;  // South
-                    case 3: dx = -1; break; // West
-                }
-                
-                // Creature walks FROM the offset toward current position
-                state.walk_offset_x = -dx * remaining;
-                state.walk_offset_y = -dy * remaining;
-                
-                // Animation frame (0-3)
-                state.animation_frame = static_cast<int>(state.walk_progress * 4) % 4;
-            }
-        } else {
-            // Countdown to next movement attempt
-            state.move_timer -= delta_time;
-            if (state.move_timer <= 0.0f) {
-                state.move_timer = TICK_INTERVAL_SEC;
-                
-                // Random chance to move (33%) - Uses member distribution
-                if (chance_dist_(rng_) < MOVE_CHANCE) {
-                    tryMoveCreature(state, map, client_data);
-                }
+
+        // Countdown to next movement attempt
+        state->move_timer -= delta_time;
+        if (state->move_timer <= 0.0f) {
+            state->move_timer = TICK_INTERVAL_SEC;
+
+            // Random chance to move (33%)
+            if (ctx.chance_dist(ctx.rng) < MOVE_CHANCE) {
+                proposeMove(*state, ctx);
             }
         }
     }
 }
 
-void CreatureSimulator::tryMoveCreature(CreatureAnimState& state, 
-                                        Domain::ChunkedMap* map,
-                                        ClientDataService* client_data) {
-    // Pick random direction (0=N, 1=E, 2=S, 3=W) - Uses member distribution
-    int new_dir = direction_dist_(rng_);
+void CreatureSimulator::proposeMove(CreatureAnimState& state, StepContext& ctx) const {
+    // Pick random direction (0=N, 1=E, 2=S, 3=W)
+    int new_dir = ctx.direction_dist(ctx.rng);
     
     int dx = 0, dy = 0;
-    switch (new_dir) {
-        case 0: dy = -1; break; // North
-        case 1: dx = 1; break;  // East
-        case 2: dy = 1; break;  // South
-        case 3: dx = -1; break; // West
-    }
+    directionDelta(new_dir, dx, dy);
     
     Domain::Position new_pos = state.current_pos;
     new_pos.x += dx;
@@ -119,54 +205,19 @@ void CreatureSimulator::tryMoveCreature(CreatureAnimState& state,
         return; // Out of spawn area
     }
     
-    // Check walkability - MUST have map to check
-    if (!map) return;
-    
-    auto* tile = map->getTile(new_pos);
-    if (!tile) {
-        return; // No tile exists
-    }
-    
-    if (!tile->hasGround()) {
-        return; // No ground
-    }
-    
-    // Check ground item for walkable/blocking flags
-    if (client_data) {
-        auto* ground = tile->getGround();
-        if (ground) {
-            auto* ground_type = client_data->getItemTypeByServerId(ground->getServerId());
-            if (ground_type) {
-                // Check if ground itself blocks
-                if (ground_type->is_blocking || 
-                    ground_type->hasFlag(Domain::ItemFlag::Unpassable) ||
-                    ground_type->hasFlag(Domain::ItemFlag::BlockPathfinder)) {
-                    return; // Ground is not walkable
-                }
-            }
-        }
-        
-        // Check all items on tile for blocking
-        for (const auto& item : tile->getItems()) {
-            if (item) {
-                auto* item_type = client_data->getItemTypeByServerId(item->getServerId());
-                if (item_type && (item_type->is_blocking || 
-                    item_type->hasFlag(Domain::ItemFlag::Unpassable) ||
-                    item_type->hasFlag(Domain::ItemFlag::BlockPathfinder))) {
-                    return; // Blocked by item (wall, etc)
-                }
-            }
-        }
+    // Ground present, nothing blocking, no real creature
+    if (!isWalkable(new_pos)) {
+        return;
     }
-    
-    // Check if tile already has a creature
-    if (tile->hasCreature()) {
-        return; // Occupied by real creature
-    }
-    
+
+    ctx.proposals.push_back({&state, new_pos, static_cast<uint8_t>(new_dir)});
+}
+
+void CreatureSimulator::commitMove(const MoveProposal& proposal) {
+    CreatureAnimState& state = *proposal.state;
+
     // Check if another simulated creature is at target
-    // Optimization: Use O(1) lookup instead of O(N) loop
-    if (occupied_positions_.count(new_pos)) {
+    if (occupied_positions_.count(proposal.target)) {
         return; // Occupied by simulated creature
     }
     
@@ -177,11 +228,20 @@ void CreatureSimulator::tryMoveCreature(CreatureAnimState& state,
             occupied_positions_.erase(it);
         }
     }
-    occupied_positions_[new_pos]++;
+    occupied_positions_[proposal.target]++;
+
+    const bool changes_chunk = toChunk(state.current_pos.x) != toChunk(proposal.target.x) ||
+                               toChunk(state.current_pos.y) != toChunk(proposal.target.y);
+    if (changes_chunk) {
+        removeFromBucket(&state);
+    }
+
+    int dx = 0, dy = 0;
+    directionDelta(proposal.direction, dx, dy);
 
     // Start walk animation
-    state.current_pos = new_pos;
-    state.direction = static_cast<uint8_t>(new_dir);
+    state.current_pos = proposal.target;
+    state.direction = proposal.direction;
     state.is_walking = true;
     state.walk_progress = 0.0f;
     state.animation_frame = 1;
@@ -189,6 +249,101 @@ void CreatureSimulator::tryMoveCreature(CreatureAnimState& state,
     // Initial offset (creature starts from previous tile)
     state.walk_offset_x = -dx;
     state.walk_offset_y = -dy;
+
+    if (changes_chunk) {
+        addToBucket(&state);
+    }
+}
+
+void CreatureSimulator::ensureWalkMask(int32_t chunk_x, int32_t chunk_y, int16_t z,
+                                       const Domain::ChunkedMap& map,
+                                       const ClientDataService* client_data) {
+    const Domain::Chunk* chunk = map.getChunk(chunk_x, chunk_y, z);
+    WalkMask& mask = walk_masks_[chunkKey(chunk_x, chunk_y, z)];
+    const uint32_t revision = chunk ? chunk->getRevision() : 0;
+    if (mask.chunk == chunk && mask.revision == revision) {
+        return;
+    }
+
+    mask.chunk = chunk;
+    mask.revision = revision;
+    mask.walkable.reset();
+    if (!chunk) return;
+
+    constexpr int size = Domain::Chunk::SIZE;
+    for (int i = 0; i < Domain::Chunk::TILE_COUNT; ++i) {
+        const Domain::Tile* tile = chunk->getTileUnsafe(i % size, i / size);
+        if (!tile || !tile->hasGround() || tile->hasCreature()) {
+            continue;
+        }
+
+        bool blocked = false;
+        if (client_data) {
+            blocked = isBlockingType(client_data->getItemTypeByServerId(tile->getGround()->getServerId()));
+            for (const auto& item : tile->getItems()) {
+                if (blocked) break;
+                if (item) {
+                    blocked = isBlockingType(client_data->getItemTypeByServerId(item->getServerId()));
+                }
+            }
+        }
+        if (!blocked) {
+            mask.walkable.set(i);
+        }
+    }
+}
+
+bool CreatureSimulator::isWalkable(const Domain::Position& pos) const {
+    const int32_t chunk_x = toChunk(pos.x);
+    const int32_t chunk_y = toChunk(pos.y);
+    auto it = walk_masks_.find(chunkKey(chunk_x, chunk_y, pos.z));
+    if (it == walk_masks_.end()) {
+        return false; // No map, or target chunk not prepared
+    }
+    constexpr int size = Domain::Chunk::SIZE;
+    const int local_x = pos.x - chunk_x * size;
+    const int local_y = pos.y - chunk_y * size;
+    return it->second.walkable.test(local_y * size + local_x);
+}
+
+void CreatureSimulator::addToBucket(CreatureAnimState* state) {
+    const int32_t chunk_x = toChunk(state->current_pos.x);
+    const int32_t chunk_y = toChunk(state->current_pos.y);
+    auto [it, inserted] = buckets_.try_emplace(chunkKey(chunk_x, chunk_y, state->current_pos.z));
+    if (inserted) {
+        it->second.chunk_x = chunk_x;
+        it->second.chunk_y = chunk_y;
+        it->second.z = state->current_pos.z;
+    }
+    it->second.creatures.push_back(state);
+}
+
+void CreatureSimulator::removeFromBucket(CreatureAnimState* state) {
+    const uint64_t key = chunkKey(toChunk(state->current_pos.x),
+                                  toChunk(state->current_pos.y),
+                                  state->current_pos.z);
+    auto it = buckets_.find(key);
+    if (it == buckets_.end()) return;
+
+    auto& creatures = it->second.creatures;
+    auto pos = std::find(creatures.begin(), creatures.end(), state);
+    if (pos != creatures.end()) {
+        *pos = creatures.back();
+        creatures.pop_back();
+    }
+    // Empty buckets are erased by the next update(), which holds pointers
+    // to buckets while resolving moves
+}
+
+int32_t CreatureSimulator::toChunk(int32_t coord) {
+    constexpr int32_t size = Domain::Chunk::SIZE;
+    return coord >= 0 ? coord / size : (coord - size + 1) / size;
+}
+
+uint64_t CreatureSimulator::chunkKey(int32_t chunk_x, int32_t chunk_y, int16_t z) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(chunk_x) & 0xFFFFFF) << 32) |
+           (static_cast<uint64_t>(static_cast<uint32_t>(chunk_y) & 0xFFFFFF) << 8) |
+           static_cast<uint8_t>(z);
 }
 
 CreatureAnimState* CreatureSimulator::getOrCreateState(
@@ -261,11 +416,11 @@ CreatureAnimState* CreatureSimulator::getOrCreateState(
     
     auto [inserted_it, success] = states_.emplace(key, std::move(state));
 
-    // Add to spatial index if on current floor (though update() will rebuild it anyway)
-    // We assume current floor management is handled in update(), but safe to add if needed.
-    // For now, let update() handle the index population to keep it consistent with the viewport.
+    CreatureAnimState* created = &inserted_it->second;
+    occupied_positions_[created->current_pos]++;
+    addToBucket(created);
 
-    return &inserted_it->second;
+    return created;
 }
 
 const CreatureAnimState* CreatureSimulator::getState(
@@ -281,7 +436,10 @@ const CreatureAnimState* CreatureSimulator::getState(
 
 void CreatureSimulator::reset() {
     states_.clear();
+    buckets_.clear();
     occupied_positions_.clear();
+    walk_masks_.clear();
+    walk_mask_client_data_ = nullptr;
 }
 
 uint64_t CreatureSimulator::makeKey(const Domain::Creature* creature) const {
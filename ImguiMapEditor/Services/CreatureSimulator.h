@@ -4,14 +4,22 @@
 #include "Domain/Position.h"
 #include "Domain/ChunkedMap.h"
 #include "Core/Config.h"
+#include <bitset>
+#include <memory>
 #include <unordered_map>
 #include <string>
 #include <cstdint>
 #include <random>
+#include <vector>
 
 namespace MapEditor {
+
+class WorkerPool;
+
 namespace Services {
 
+class ClientDataService;
+
 /**
  * Per-creature animation state for walk simulation.
  */
@@ -39,16 +47,27 @@ struct CreatureAnimState {
 /**
  * Manages creature walk simulation for visual feedback.
  * 
- * Only simulates creatures currently visible in viewport.
+ * Creatures are bucketed by the chunk they stand in. Chunks touching the
+ * viewport on the current floor are stepped every frame; all others are
+ * stepped every FAR_STEP_INTERVAL_SEC with the accumulated time. Chunk steps
+ * run in parallel and only propose moves; moves are checked against the
+ * occupancy index and committed on the calling thread.
+ *
+ * Walkability comes from a per-chunk bitmap built from the map and item
+ * flags, rebuilt when the chunk's revision changes.
  * Separate concern from rendering - just manages animation state.
  */
 class CreatureSimulator {
 public:
     CreatureSimulator();
+    ~CreatureSimulator();
+
+    CreatureSimulator(CreatureSimulator&&) noexcept;
+    CreatureSimulator& operator=(CreatureSimulator&&) noexcept;
     
     /**
      * Update all creature states for current frame.
-     * Only updates creatures within the given viewport bounds.
+     * Creatures near the viewport step at full rate, distant ones throttled.
      * 
      * @param delta_time Frame time in seconds
      * @param viewport_min Top-left tile of visible area
@@ -93,10 +112,63 @@ public:
     bool isEnabled() const { return enabled_; }
 
 private:
-    // Attempt to move a creature one tile in a random direction
-    void tryMoveCreature(CreatureAnimState& state,
-                        Domain::ChunkedMap* map,
-                        class ClientDataService* client_data);
+    // Simulated creatures standing in one chunk
+    struct ChunkBucket {
+        int32_t chunk_x = 0;
+        int32_t chunk_y = 0;
+        int16_t z = 0;
+        float far_time = 0.0f;  // Time accumulated while throttled
+        std::vector<CreatureAnimState*> creatures;
+    };
+
+    // Walkable tiles of one chunk: ground, nothing blocking, no creature
+    struct WalkMask {
+        const Domain::Chunk* chunk = nullptr;
+        uint32_t revision = 0;
+        std::bitset<Domain::Chunk::TILE_COUNT> walkable;
+    };
+
+    struct StepJob {
+        ChunkBucket* bucket = nullptr;
+        float delta_time = 0.0f;
+    };
+
+    struct MoveProposal {
+        CreatureAnimState* state = nullptr;
+        Domain::Position target;
+        uint8_t direction = 0;
+    };
+
+    // Per-thread RNG and proposals, so chunk steps share nothing mutable
+    struct StepContext {
+        std::mt19937 rng;
+        std::uniform_real_distribution<float> chance_dist{0.0f, 1.0f};
+        std::uniform_int_distribution<int> direction_dist{0, NUM_DIRECTIONS - 1};
+        std::vector<MoveProposal> proposals;
+    };
+
+    static constexpr int NUM_DIRECTIONS = 4;
+
+    // Advance timers and walk animation, queueing move attempts
+    void stepBucket(const ChunkBucket& bucket, float delta_time, StepContext& ctx) const;
+
+    // Pick a random direction and queue the move if the target is walkable
+    void proposeMove(CreatureAnimState& state, StepContext& ctx) const;
+
+    // Commit a proposal unless another creature got there first
+    void commitMove(const MoveProposal& proposal);
+
+    // Refresh the walk mask of a chunk if it was edited since it was built
+    void ensureWalkMask(int32_t chunk_x, int32_t chunk_y, int16_t z,
+                        const Domain::ChunkedMap& map,
+                        const ClientDataService* client_data);
+    bool isWalkable(const Domain::Position& pos) const;
+
+    void addToBucket(CreatureAnimState* state);
+    void removeFromBucket(CreatureAnimState* state);
+
+    static int32_t toChunk(int32_t coord);
+    static uint64_t chunkKey(int32_t chunk_x, int32_t chunk_y, int16_t z);
     
     // Generate unique key for creature at position
     uint64_t makeKey(const Domain::Creature* creature) const;
@@ -104,19 +176,25 @@ private:
     bool enabled_ = false;
     std::unordered_map<uint64_t, CreatureAnimState> states_;
 
-    // Optimization: Spatial index for O(1) collision checks
-    // Rebuilt every frame in update()
-    // Map of Position -> Count (to handle stacked creatures correctly)
+    // Creatures by chunk key; states_ nodes are stable, so pointers are safe
+    std::unordered_map<uint64_t, ChunkBucket> buckets_;
+
+    // Spatial index for O(1) collision checks, kept up to date on every
+    // state creation and move. Map of Position -> Count (to handle stacked
+    // creatures correctly)
     std::unordered_map<Domain::Position, int> occupied_positions_;
 
-    std::mt19937 rng_;
+    // Walkability per chunk key, read concurrently during chunk steps
+    std::unordered_map<uint64_t, WalkMask> walk_masks_;
+    const ClientDataService* walk_mask_client_data_ = nullptr;
 
-    /// Reusable distributions to avoid reconstruction in hot loops
-    std::uniform_real_distribution<float> chance_dist_; // 0.0f to 1.0f
-    std::uniform_real_distribution<float> interval_dist_; // For random move intervals
-    std::uniform_int_distribution<int> direction_dist_; // 0 to NUM_DIRECTIONS - 1
+    // Reused every frame
+    std::vector<StepJob> jobs_;
+    std::vector<StepContext> contexts_;
+    std::unique_ptr<WorkerPool> workers_;
 
-    static constexpr int NUM_DIRECTIONS = 4;
+    std::mt19937 rng_;
+    std::uniform_real_distribution<float> interval_dist_; // For random move intervals
 };
 
 } // namespace Services
@@ -12,7 +12,9 @@ namespace Services {
 CreatureSpriteService::CreatureSpriteService(
     std::shared_ptr<IO::SprReader> spr_reader,
     Rendering::AtlasManager &atlas_manager)
-    : spr_reader_(std::move(spr_reader)), atlas_manager_(atlas_manager) {}
+    : spr_reader_(std::move(spr_reader)), atlas_manager_(atlas_manager),
+      colorized_capacity_(Config::Performance::COLORIZED_OUTFIT_CACHE_BYTES /
+                          Config::Rendering::SPRITE_BYTES) {}
 
 uint64_t CreatureSpriteService::makeOutfitCacheKey(uint32_t base_id,
                                                    uint32_t template_id,
@@ -30,7 +32,7 @@ uint64_t CreatureSpriteService::makeOutfitCacheKey(uint32_t base_id,
 
 std::vector<uint8_t> CreatureSpriteService::colorizeSprite(
     uint32_t base_sprite_id, uint32_t template_sprite_id, uint8_t head,
-    uint8_t body, uint8_t legs, uint8_t feet) {
+    uint8_t body, uint8_t legs, uint8_t feet) const {
 
   if (base_sprite_id == 0 || !spr_reader_) {
     return {};
@@ -111,8 +113,15 @@ const Rendering::AtlasRegion *CreatureSpriteService::getColorizedOutfitRegion(
 
   auto it = colorized_outfit_region_cache_.find(cache_key);
   if (it != colorized_outfit_region_cache_.end()) {
-    return it->second;
+    ColorizedSlot &slot = colorized_slots_[it->second];
+    slot.last_frame = frame_;
+    // LRU: Move accessed slot to front
+    colorized_lru_order_.splice(colorized_lru_order_.begin(),
+                                colorized_lru_order_, slot.lru);
+    ++colorized_hits_;
+    return slot.region;
   }
+  ++colorized_misses_;
 
   auto colorized_data = colorizeSprite(base_sprite_id, template_sprite_id, head,
                                        body, legs, feet);
@@ -120,15 +129,55 @@ const Rendering::AtlasRegion *CreatureSpriteService::getColorizedOutfitRegion(
     return nullptr;
   }
 
-  uint32_t atlas_sprite_id =
-      Config::Rendering::COLORIZED_OUTFIT_OFFSET + next_colorized_id_++;
+  // Reuse the least recently drawn slot once the budget is reached
+  const bool reuse = colorized_slots_.size() >= colorized_capacity_ &&
+                     !colorized_lru_order_.empty() &&
+                     colorized_slots_[colorized_lru_order_.back()].last_frame !=
+                         frame_;
+
+  uint32_t slot_index = 0;
+  if (reuse) {
+    slot_index = colorized_lru_order_.back();
+  } else {
+    slot_index = static_cast<uint32_t>(colorized_slots_.size());
+  }
 
+  const uint32_t atlas_sprite_id =
+      Config::Rendering::COLORIZED_OUTFIT_OFFSET + slot_index;
   const Rendering::AtlasRegion *region =
-      atlas_manager_.addSprite(atlas_sprite_id, colorized_data.data());
+      atlas_manager_.getRegion(atlas_sprite_id);
   if (region) {
-    colorized_outfit_region_cache_[cache_key] = region;
+    // Slot already in the atlas (reused, or kept across clearCache)
+    if (!atlas_manager_.updateSprite(atlas_sprite_id, colorized_data.data())) {
+      return nullptr;
+    }
+  } else {
+    region = atlas_manager_.addSprite(atlas_sprite_id, colorized_data.data());
+    if (!region) {
+      return nullptr;
+    }
+    // Slots keep their region across frames and are recycled by this pool
+    atlas_manager_.pinSprite(atlas_sprite_id);
   }
 
+  if (reuse) {
+    ColorizedSlot &slot = colorized_slots_[slot_index];
+    colorized_outfit_region_cache_.erase(slot.key);
+    colorized_lru_order_.splice(colorized_lru_order_.begin(),
+                                colorized_lru_order_, slot.lru);
+    ++colorized_evictions_;
+  } else {
+    colorized_lru_order_.push_front(slot_index);
+    colorized_slots_.push_back({});
+    colorized_slots_.back().lru = colorized_lru_order_.begin();
+  }
+
+  ColorizedSlot &slot = colorized_slots_[slot_index];
+  slot.key = cache_key;
+  slot.region = region;
+  slot.last_frame = frame_;
+  colorized_outfit_region_cache_[cache_key] = slot_index;
+
   return region;
 }
 
@@ -156,10 +205,44 @@ Rendering::Texture *CreatureSpriteService::getCompositedCreatureTexture(
     return it->second.get();
   }
 
-  const int width = std::max<int>(1, outfit_data->width);
-  const int height = std::max<int>(1, outfit_data->height);
-  const int layers = std::max<int>(1, outfit_data->layers);
-  const int pattern_x = std::max<int>(1, outfit_data->pattern_x);
+  std::vector<uint8_t> composite_rgba =
+      compositeCreatureRgba(*outfit_data, head, body, legs, feet);
+  const uint32_t composite_size =
+      std::max<uint32_t>(1, std::max(outfit_data->width, outfit_data->height)) *
+      32;
+
+  auto texture = std::make_unique<Rendering::Texture>(
+      composite_size, composite_size, composite_rgba.data());
+  Rendering::Texture *result = texture.get();
+  composited_creature_cache_[cache_key] = std::move(texture);
+
+  // LRU: Add new entry to front
+  composited_lru_order_.push_front(cache_key);
+  composited_lru_map_[cache_key] = composited_lru_order_.begin();
+
+  // LRU: Evict oldest entries if cache exceeds limit
+  while (composited_creature_cache_.size() > MAX_COMPOSITED_CACHE_SIZE) {
+    uint64_t oldest_key = composited_lru_order_.back();
+    composited_lru_order_.pop_back();
+    composited_lru_map_.erase(oldest_key);
+    composited_creature_cache_.erase(oldest_key);
+  }
+
+  return result;
+}
+
+std::vector<uint8_t> CreatureSpriteService::compositeCreatureRgba(
+    const IO::ClientItem &outfit_data, uint8_t head, uint8_t body, uint8_t legs,
+    uint8_t feet) const {
+
+  if (outfit_data.sprite_ids.empty() || !spr_reader_) {
+    return {};
+  }
+
+  const int width = std::max<int>(1, outfit_data.width);
+  const int height = std::max<int>(1, outfit_data.height);
+  const int layers = std::max<int>(1, outfit_data.layers);
+  const int pattern_x = std::max<int>(1, outfit_data.pattern_x);
 
   const int composite_size = std::max(width, height) * 32;
   std::vector<uint8_t> composite_rgba(composite_size * composite_size * 4, 0);
@@ -181,11 +264,11 @@ Rendering::Texture *CreatureSpriteService::getCompositedCreatureTexture(
   for (int h = 0; h < height; ++h) {
     for (int w = 0; w < width; ++w) {
       uint32_t base_idx = Utils::SpriteUtils::getSpriteIndex(
-          outfit_data, w, h, 0, dir, addon, mount, frame);
-      if (base_idx >= outfit_data->sprite_ids.size())
+          &outfit_data, w, h, 0, dir, addon, mount, frame);
+      if (base_idx >= outfit_data.sprite_ids.size())
         continue;
 
-      uint32_t base_sprite_id = outfit_data->sprite_ids[base_idx];
+      uint32_t base_sprite_id = outfit_data.sprite_ids[base_idx];
       if (base_sprite_id == 0)
         continue;
 
@@ -193,9 +276,9 @@ Rendering::Texture *CreatureSpriteService::getCompositedCreatureTexture(
       uint32_t template_sprite_id = 0;
       if (layers >= 2) {
         uint32_t template_idx = Utils::SpriteUtils::getSpriteIndex(
-            outfit_data, w, h, 1, dir, addon, mount, frame);
-        if (template_idx < outfit_data->sprite_ids.size()) {
-          template_sprite_id = outfit_data->sprite_ids[template_idx];
+            &outfit_data, w, h, 1, dir, addon, mount, frame);
+        if (template_idx < outfit_data.sprite_ids.size()) {
+          template_sprite_id = outfit_data.sprite_ids[template_idx];
         }
       }
 
@@ -219,34 +302,32 @@ Rendering::Texture *CreatureSpriteService::getCompositedCreatureTexture(
     }
   }
 
-  auto texture = std::make_unique<Rendering::Texture>(
-      composite_size, composite_size, composite_rgba.data());
-  Rendering::Texture *result = texture.get();
-  composited_creature_cache_[cache_key] = std::move(texture);
-
-  // LRU: Add new entry to front
-  composited_lru_order_.push_front(cache_key);
-  composited_lru_map_[cache_key] = composited_lru_order_.begin();
-
-  // LRU: Evict oldest entries if cache exceeds limit
-  while (composited_creature_cache_.size() > MAX_COMPOSITED_CACHE_SIZE) {
-    uint64_t oldest_key = composited_lru_order_.back();
-    composited_lru_order_.pop_back();
-    composited_lru_map_.erase(oldest_key);
-    composited_creature_cache_.erase(oldest_key);
-  }
-
-  return result;
+  return composite_rgba;
 }
 
 void CreatureSpriteService::clearCache() {
   colorized_outfit_cache_.clear();
   colorized_outfit_region_cache_.clear();
+  colorized_slots_.clear();
+  colorized_lru_order_.clear();
   composited_creature_cache_.clear();
   composited_lru_order_.clear();
   composited_lru_map_.clear();
 }
 
+CreatureSpriteService::ColorizedCacheStats
+CreatureSpriteService::getColorizedCacheStats() const {
+  ColorizedCacheStats stats;
+  stats.hits = colorized_hits_;
+  stats.misses = colorized_misses_;
+  stats.evictions = colorized_evictions_;
+  stats.resident = colorized_outfit_region_cache_.size();
+  stats.capacity = colorized_capacity_;
+  stats.resident_bytes =
+      colorized_slots_.size() * Config::Rendering::SPRITE_BYTES;
+  return stats;
+}
+
 size_t CreatureSpriteService::getCacheSize() const {
   return colorized_outfit_cache_.size() +
          colorized_outfit_region_cache_.size() +
@@ -57,7 +57,11 @@ public:
 
   /**
    * Get atlas region for a colorized outfit sprite (for GPU batch rendering).
-   * Results are cached by (baseSpriteId, templateSpriteId, colorHash).
+   * Results are cached by (baseSpriteId, templateSpriteId, colorHash) in a
+   * pool of atlas slots bounded by COLORIZED_OUTFIT_CACHE_BYTES. When the
+   * pool is full the least recently drawn sprite's slot is rewritten in
+   * place. Regions drawn in the current frame are never reused, so a frame
+   * with more distinct outfits than the budget grows the pool instead.
    *
    * @param base_sprite_id Base sprite ID (layer 0)
    * @param template_sprite_id Template mask sprite ID (layer 1, 0 if none)
@@ -88,6 +92,38 @@ public:
   getCompositedCreatureTexture(const IO::ClientItem *outfit_data, uint8_t head,
                                uint8_t body, uint8_t legs, uint8_t feet);
 
+  /**
+   * Composite a creature's south-facing outfit into a square RGBA image of
+   * max(width, height) * 32 pixels. Touches no GL state or cache, so it is
+   * safe to call from worker threads.
+   *
+   * @param outfit_data ClientItem data for the outfit type
+   * @return RGBA pixels, or empty if the outfit has no sprites
+   */
+  std::vector<uint8_t> compositeCreatureRgba(const IO::ClientItem &outfit_data,
+                                             uint8_t head, uint8_t body,
+                                             uint8_t legs, uint8_t feet) const;
+
+  /**
+   * Colorized outfit region cache statistics.
+   */
+  struct ColorizedCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t resident = 0;       // Sprites currently cached
+    size_t capacity = 0;       // Sprites allowed by the memory budget
+    size_t resident_bytes = 0; // Atlas memory held by the pool
+  };
+
+  ColorizedCacheStats getColorizedCacheStats() const;
+
+  /**
+   * Mark the start of a frame. Regions returned during the current frame
+   * are protected from eviction until the next call.
+   */
+  void beginFrame() { ++frame_; }
+
   /**
    * Clear all cached textures.
    */
@@ -112,7 +148,8 @@ private:
    */
   std::vector<uint8_t> colorizeSprite(uint32_t base_sprite_id,
                                       uint32_t template_sprite_id, uint8_t head,
-                                      uint8_t body, uint8_t legs, uint8_t feet);
+                                      uint8_t body, uint8_t legs,
+                                      uint8_t feet) const;
 
   std::shared_ptr<IO::SprReader> spr_reader_;
   Rendering::AtlasManager &atlas_manager_;
@@ -121,9 +158,23 @@ private:
   std::unordered_map<uint64_t, std::unique_ptr<Rendering::Texture>>
       colorized_outfit_cache_;
 
-  // Colorized outfit region cache (for GPU batch rendering)
-  std::unordered_map<uint64_t, const Rendering::AtlasRegion *>
-      colorized_outfit_region_cache_;
+  // Colorized outfit region cache (for GPU batch rendering). Slot i owns
+  // atlas sprite id COLORIZED_OUTFIT_OFFSET + i.
+  struct ColorizedSlot {
+    uint64_t key = 0;
+    const Rendering::AtlasRegion *region = nullptr;
+    uint64_t last_frame = 0;
+    std::list<uint32_t>::iterator lru;
+  };
+  std::vector<ColorizedSlot> colorized_slots_;
+  std::unordered_map<uint64_t, uint32_t> colorized_outfit_region_cache_;
+  // LRU tracking of slots: front = most recently drawn
+  std::list<uint32_t> colorized_lru_order_;
+  size_t colorized_capacity_ = 0;
+  uint64_t frame_ = 0;
+  uint64_t colorized_hits_ = 0;
+  uint64_t colorized_misses_ = 0;
+  uint64_t colorized_evictions_ = 0;
 
   // Composited creature texture cache with LRU eviction
   static constexpr size_t MAX_COMPOSITED_CACHE_SIZE = 1024;
@@ -133,9 +184,6 @@ private:
   std::list<uint64_t> composited_lru_order_;
   std::unordered_map<uint64_t, std::list<uint64_t>::iterator>
       composited_lru_map_;
-
-  // Counter for unique atlas sprite IDs
-  uint32_t next_colorized_id_ = 0;
 };
 
 } // namespace Services
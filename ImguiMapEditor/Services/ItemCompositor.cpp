@@ -25,26 +25,34 @@ ItemCompositor::getCompositedItemTexture(const Domain::ItemType *type) {
     return it->second.get();
   }
 
-  // For single-tile items (1x1), load directly and cache
-  if (type->width == 1 && type->height == 1) {
-    uint32_t sprite_id = type->sprite_ids[0];
-    auto sprite_data =
-        Utils::SpriteUtils::loadDecodedSprite(spr_reader_, sprite_id);
-    if (sprite_data.empty()) {
-      return nullptr;
-    }
+  auto rgba = compositeRgba(type->sprite_ids, type->width, type->height);
+  if (rgba.empty()) {
+    return nullptr;
+  }
 
-    // Create and cache texture
-    auto texture =
-        std::make_unique<Rendering::Texture>(32, 32, sprite_data.data());
-    Rendering::Texture *ptr = texture.get();
-    cache_[client_id] = std::move(texture);
-    return ptr;
+  const uint32_t composite_size =
+      std::max<uint32_t>(1, std::max(type->width, type->height)) * 32;
+  auto texture = std::make_unique<Rendering::Texture>(
+      composite_size, composite_size, rgba.data());
+  Rendering::Texture *ptr = texture.get();
+  cache_[client_id] = std::move(texture);
+
+  return ptr;
+}
+
+std::vector<uint8_t>
+ItemCompositor::compositeRgba(const std::vector<uint32_t> &sprite_ids,
+                              uint8_t width, uint8_t height) const {
+  if (sprite_ids.empty() || !spr_reader_) {
+    return {};
+  }
+
+  // For single-tile items (1x1), the sprite is the image
+  if (width <= 1 && height <= 1) {
+    return Utils::SpriteUtils::loadDecodedSprite(spr_reader_, sprite_ids[0]);
   }
 
   // Multi-tile item: need to composite all parts
-  const uint8_t width = type->width;
-  const uint8_t height = type->height;
   const int composite_size = std::max(width, height) * 32;
 
   // Create RGBA buffer for the composited image
@@ -64,11 +72,11 @@ ItemCompositor::getCompositedItemTexture(const Domain::ItemType *type) {
     for (uint8_t w = 0; w < width; ++w) {
       size_t sprite_index = static_cast<size_t>(h) * width + w;
 
-      if (sprite_index >= type->sprite_ids.size()) {
+      if (sprite_index >= sprite_ids.size()) {
         continue;
       }
 
-      uint32_t sprite_id = type->sprite_ids[sprite_index];
+      uint32_t sprite_id = sprite_ids[sprite_index];
       auto sprite_data =
           Utils::SpriteUtils::loadDecodedSprite(spr_reader_, sprite_id);
       if (sprite_data.size() < 32 * 32 * 4) {
@@ -86,13 +94,7 @@ ItemCompositor::getCompositedItemTexture(const Domain::ItemType *type) {
     }
   }
 
-  // Create texture at full composite resolution
-  auto texture = std::make_unique<Rendering::Texture>(
-      composite_size, composite_size, composite_rgba.data());
-  Rendering::Texture *ptr = texture.get();
-  cache_[client_id] = std::move(texture);
-
-  return ptr;
+  return composite_rgba;
 }
 
 void ItemCompositor::clearCache() { cache_.clear(); }
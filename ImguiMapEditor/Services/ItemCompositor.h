@@ -3,6 +3,7 @@
 #include "Rendering/Core/Texture.h"
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace MapEditor {
 
@@ -43,6 +44,19 @@ public:
      */
     Rendering::Texture* getCompositedItemTexture(const Domain::ItemType* type);
 
+    /**
+     * Composite an item's sprite parts into a square RGBA image of
+     * max(width, height) * 32 pixels. Touches no GL state or cache, so it is
+     * safe to call from worker threads.
+     *
+     * @param sprite_ids Sprite ids of the item (first width*height are used)
+     * @param width Item width in tiles
+     * @param height Item height in tiles
+     * @return RGBA pixels, or empty if no sprite could be loaded
+     */
+    std::vector<uint8_t> compositeRgba(const std::vector<uint32_t>& sprite_ids,
+                                       uint8_t width, uint8_t height) const;
+
     /**
      * Clear the composited texture cache.
      */
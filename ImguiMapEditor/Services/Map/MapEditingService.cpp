@@ -1,15 +1,18 @@
 #include "MapEditingService.hpp"
 
 #include <algorithm>
-#include <unordered_map>
+#include <array>
+#include <limits>
 #include <unordered_set>
 
 #include <spdlog/spdlog.h>
 
+#include "Core/Config.h"
 #include "Domain/ChunkedMap.h"
 #include "Domain/Creature.h"
 #include "Domain/History/HistoryManager.h"
 #include "Domain/Item.h"
+#include "Domain/Selection/SelectionBucket.h"
 #include "Domain/Spawn.h"
 #include "Domain/Tile.h"
 #include "Services/Selection/SelectionService.h"
@@ -27,21 +30,33 @@ bool MapEditingService::moveItems(
     return false;
   }
 
-  auto entries = selection_service.getAllEntries();
+  // Read the selection chunk by chunk instead of flattening it into a copy
+  const SelectionBucket &selection = selection_service.getBucket();
 
   // Start history operation (with selection state)
   history_manager.beginOperation("Move items",
                                  Domain::History::ActionType::Other,
                                  &selection_service);
 
-  collectAffectedTiles(entries, dx, dy, map, history_manager);
+  size_t selected_tiles = 0;
+  selection.forEachChunk([&](const SelectionChunk &chunk) {
+    selected_tiles += chunk.tiles.count();
+  });
+
+  // Large moves record compressed regions instead of a TileSnapshot per
+  // source and destination tile
+  if (selected_tiles >= Config::Performance::BULK_HISTORY_MIN_TILES) {
+    recordAffectedRegions(selection, dx, dy, map, history_manager);
+  } else {
+    collectAffectedTiles(selection, dx, dy, map, history_manager);
+  }
 
   MoveContext ctx{};
-  extractMovables(entries, dx, dy, map, ctx);
+  extractMovables(selection, dx, dy, map, ctx);
   insertMovables(map, ctx);
 
   bool has_moves = !ctx.moved_info.empty() || !ctx.pending_creatures.empty() ||
-                   !ctx.pending_spawns.empty();
+                   !ctx.pending_spawns.empty() || ctx.moved_tiles > 0;
 
   if (has_moves) {
     history_manager.endOperation(map, &selection_service);
@@ -54,19 +69,24 @@ bool MapEditingService::moveItems(
 }
 
 void MapEditingService::collectAffectedTiles(
-    const std::vector<Domain::Selection::SelectionEntry> &entries, int32_t dx,
+    const Domain::Selection::SelectionBucket &selection, int32_t dx,
     int32_t dy, Domain::ChunkedMap *map,
     Domain::History::HistoryManager &history_manager) {
-  // Collect all unique tile positions that will be affected
+  // Collect all unique tile positions that will be affected.
+  // Source tiles come straight from the chunk tile masks (one bit per tile,
+  // regardless of how many entities are selected on it).
   std::unordered_set<uint64_t> affected_tiles;
-  for (const auto &entry : entries) {
-    Domain::Position from_pos = entry.getPosition();
-    Domain::Position to_pos = from_pos;
-    to_pos.x += dx;
-    to_pos.y += dy;
-    affected_tiles.insert(from_pos.pack());
-    affected_tiles.insert(to_pos.pack());
-  }
+  affected_tiles.reserve(selection.getChunkCount() * 64);
+  selection.forEachChunk([&](const SelectionChunk &chunk) {
+    chunk.tiles.forEachSetBit([&](int index) {
+      Domain::Position from_pos = chunk.tilePosition(index);
+      Domain::Position to_pos = from_pos;
+      to_pos.x += dx;
+      to_pos.y += dy;
+      affected_tiles.insert(from_pos.pack());
+      affected_tiles.insert(to_pos.pack());
+    });
+  });
 
   // Record BEFORE states for all affected tiles
   for (uint64_t packed : affected_tiles) {
@@ -75,60 +95,239 @@ void MapEditingService::collectAffectedTiles(
   }
 }
 
+void MapEditingService::recordAffectedRegions(
+    const Domain::Selection::SelectionBucket &selection, int32_t dx,
+    int32_t dy, Domain::ChunkedMap *map,
+    Domain::History::HistoryManager &history_manager) {
+  struct Bounds {
+    int32_t min_x = std::numeric_limits<int32_t>::max();
+    int32_t min_y = std::numeric_limits<int32_t>::max();
+    int32_t max_x = std::numeric_limits<int32_t>::min();
+    int32_t max_y = std::numeric_limits<int32_t>::min();
+    size_t tiles = 0;
+    bool valid() const { return min_x <= max_x; }
+    size_t area() const {
+      return static_cast<size_t>(max_x - min_x + 1) *
+             static_cast<size_t>(max_y - min_y + 1);
+    }
+  };
+  std::array<Bounds, Domain::ChunkedMap::FLOOR_COUNT> floors{};
+
+  // Per-floor selection bounds from the chunk masks
+  selection.forEachChunk([&](const SelectionChunk &chunk) {
+    int lx0, ly0, lx1, ly1;
+    if (chunk.z < Domain::ChunkedMap::FLOOR_MIN ||
+        chunk.z > Domain::ChunkedMap::FLOOR_MAX ||
+        !chunk.tiles.bounds(lx0, ly0, lx1, ly1)) {
+      return;
+    }
+    Bounds &b = floors[chunk.z - Domain::ChunkedMap::FLOOR_MIN];
+    b.min_x = std::min(b.min_x, chunk.worldX() + lx0);
+    b.min_y = std::min(b.min_y, chunk.worldY() + ly0);
+    b.max_x = std::max(b.max_x, chunk.worldX() + lx1);
+    b.max_y = std::max(b.max_y, chunk.worldY() + ly1);
+    b.tiles += chunk.tiles.count();
+  });
+
+  bool any_sparse = false;
+  std::array<bool, Domain::ChunkedMap::FLOOR_COUNT> sparse{};
+  for (size_t i = 0; i < floors.size(); ++i) {
+    const Bounds &src = floors[i];
+    if (!src.valid()) {
+      continue;
+    }
+    // A scattered selection would snapshot every tile between its parts
+    if (src.area() > src.tiles * 2) {
+      sparse[i] = true;
+      any_sparse = true;
+      continue;
+    }
+
+    const int16_t z = static_cast<int16_t>(Domain::ChunkedMap::FLOOR_MIN + i);
+    const Bounds dst{src.min_x + dx, src.min_y + dy, src.max_x + dx,
+                     src.max_y + dy};
+
+    const bool overlap = dst.min_x <= src.max_x && dst.max_x >= src.min_x &&
+                         dst.min_y <= src.max_y && dst.max_y >= src.min_y;
+    if (overlap) {
+      // One region covering both source and destination
+      history_manager.recordRegionBefore(
+          *map, std::min(src.min_x, dst.min_x), std::min(src.min_y, dst.min_y),
+          std::max(src.max_x, dst.max_x), std::max(src.max_y, dst.max_y), z);
+    } else {
+      history_manager.recordRegionBefore(*map, src.min_x, src.min_y,
+                                         src.max_x, src.max_y, z);
+      history_manager.recordRegionBefore(*map, dst.min_x, dst.min_y,
+                                         dst.max_x, dst.max_y, z);
+    }
+  }
+  if (!any_sparse) {
+    return;
+  }
+
+  // Sparse floors: a region per densely selected chunk (source and
+  // destination), tile snapshots for the rest - as fillArea does
+  std::unordered_set<uint64_t> affected_tiles;
+  selection.forEachChunk([&](const SelectionChunk &chunk) {
+    int lx0, ly0, lx1, ly1;
+    if (chunk.z < Domain::ChunkedMap::FLOOR_MIN ||
+        chunk.z > Domain::ChunkedMap::FLOOR_MAX ||
+        !sparse[chunk.z - Domain::ChunkedMap::FLOOR_MIN] ||
+        !chunk.tiles.bounds(lx0, ly0, lx1, ly1)) {
+      return;
+    }
+    const Bounds src{chunk.worldX() + lx0, chunk.worldY() + ly0,
+                     chunk.worldX() + lx1, chunk.worldY() + ly1,
+                     chunk.tiles.count()};
+    if (src.area() <= src.tiles * 2) {
+      history_manager.recordRegionBefore(*map, src.min_x, src.min_y,
+                                         src.max_x, src.max_y, chunk.z);
+      history_manager.recordRegionBefore(*map, src.min_x + dx, src.min_y + dy,
+                                         src.max_x + dx, src.max_y + dy,
+                                         chunk.z);
+      return;
+    }
+    chunk.tiles.forEachSetBit([&](int index) {
+      const Domain::Position from_pos = chunk.tilePosition(index);
+      Domain::Position to_pos = from_pos;
+      to_pos.x += dx;
+      to_pos.y += dy;
+      affected_tiles.insert(from_pos.pack());
+      affected_tiles.insert(to_pos.pack());
+    });
+  });
+
+  // After all regions, so tiles they cover are skipped
+  for (uint64_t packed : affected_tiles) {
+    Domain::Position tile_pos = Domain::Position::unpack(packed);
+    history_manager.recordTileBefore(tile_pos, map->getTile(tile_pos));
+  }
+}
+
+// Number of selectable entities on a tile (ground + items + creature + spawn)
+static size_t selectableCount(const Domain::Tile *tile) {
+  return (tile->hasGround() ? 1 : 0) + tile->getItemCount() +
+         (tile->hasCreature() ? 1 : 0) + (tile->hasSpawn() ? 1 : 0);
+}
+
+void MapEditingService::detachSourceState(Domain::Tile &tile,
+                                          const Domain::Position &from_pos,
+                                          MoveContext &ctx) {
+  if (tile.getFlags() == Domain::TileFlag::None && tile.getHouseId() == 0) {
+    return;
+  }
+  ctx.source_states.push_back({from_pos, tile.getFlags(), tile.getHouseId()});
+  tile.setFlags(Domain::TileFlag::None);
+  tile.setHouseId(0);
+}
+
 void MapEditingService::extractMovables(
-    const std::vector<Domain::Selection::SelectionEntry> &entries, int32_t dx,
+    const Domain::Selection::SelectionBucket &selection, int32_t dx,
     int32_t dy, Domain::ChunkedMap *map, MoveContext &ctx) {
+  constexpr int32_t SIZE = SelectionChunk::SIZE;
+  const bool chunk_aligned = dx % SIZE == 0 && dy % SIZE == 0;
+
+  // Selection entries are grouped per chunk and sorted by tile, so each
+  // source tile is a contiguous run: resolve the map chunk once and read
+  // tiles directly instead of grouping through a hash map.
+  struct TileRun {
+    size_t first, last;
+    int index;
+    Domain::Tile *tile;
+    bool whole; // Every entity on the tile is selected
+  };
+  std::vector<TileRun> runs;
+  std::vector<std::pair<size_t, Domain::Position>>
+      indexed_items; // index, destination
+
+  selection.forEachChunk([&](const SelectionChunk &sel_chunk) {
+    const Domain::Chunk *map_chunk =
+        map->getChunk(sel_chunk.chunk_x, sel_chunk.chunk_y, sel_chunk.z);
+    if (!map_chunk) {
+      return;
+    }
 
-  // Group by source tile for efficient extraction
-  using ItemToMove = std::pair<const Domain::Item *, Domain::Position>;
-  using TileItemsMap = std::unordered_map<uint64_t, std::vector<ItemToMove>>;
-  TileItemsMap items_by_tile;
-  items_by_tile.reserve(entries.size());
+    const auto &entries = sel_chunk.entries;
+    runs.clear();
+    bool whole_chunk = static_cast<int>(sel_chunk.tiles.count()) ==
+                       map_chunk->getNonEmptyCount();
+
+    for (size_t run = 0; run < entries.size();) {
+      const int index = SelectionChunk::entryTileIndex(entries[run]);
+      size_t run_end = run + 1;
+      while (run_end < entries.size() &&
+             SelectionChunk::entryTileIndex(entries[run_end]) == index) {
+        ++run_end;
+      }
 
-  std::vector<std::pair<Domain::Position, Domain::Position>>
-      creature_moves; // from, to
-  std::vector<std::pair<Domain::Position, Domain::Position>>
-      spawn_moves; // from, to
+      Domain::Tile *tile =
+          map_chunk->getTileUnsafe(index % SIZE, index / SIZE);
+      const bool whole = tile && run_end - run == selectableCount(tile);
+      whole_chunk = whole_chunk && whole;
+      runs.push_back({run, run_end, index, tile, whole});
+      run = run_end;
+    }
 
-  for (const auto &entry : entries) {
-    Domain::Position from_pos = entry.getPosition();
-    Domain::Position to_pos = from_pos;
-    to_pos.x += dx;
-    to_pos.y += dy;
+    // Chunk-aligned move of a fully selected chunk: transplant the whole
+    // tile array in one step
+    if (chunk_aligned && whole_chunk) {
+      auto chunk = map->extractChunk(sel_chunk.chunk_x, sel_chunk.chunk_y,
+                                     sel_chunk.z);
+      ctx.moved_tiles += static_cast<size_t>(chunk->getNonEmptyCount());
+      chunk->forEachTileMutable([&](Domain::Tile *tile) {
+        detachSourceState(*tile, tile->getPosition(), ctx);
+      });
+      ctx.pending_chunks.push_back({sel_chunk.chunk_x + dx / SIZE,
+                                    sel_chunk.chunk_y + dy / SIZE, sel_chunk.z,
+                                    std::move(chunk)});
+      return;
+    }
 
-    switch (entry.getType()) {
+    for (const TileRun &run : runs) {
+      if (!run.tile) {
+        continue;
+      }
+
+      const Domain::Position from_pos = sel_chunk.tilePosition(run.index);
+      Domain::Position to_pos = from_pos;
+      to_pos.x += dx;
+      to_pos.y += dy;
+
+      if (run.whole) {
+        // Fully selected tile: move the Tile object itself
+        auto tile = map->removeTile(from_pos);
+        detachSourceState(*tile, from_pos, ctx);
+        ++ctx.moved_tiles;
+        ctx.pending_tiles.push_back({from_pos, to_pos, std::move(tile)});
+        continue;
+      }
+
+      extractFromTile(entries.begin() + run.first, entries.begin() + run.last,
+                      run.tile, from_pos, to_pos, map, ctx, indexed_items);
+    }
+  });
+}
+
+void MapEditingService::extractFromTile(
+    std::vector<SelectionEntry>::const_iterator first,
+    std::vector<SelectionEntry>::const_iterator last, Domain::Tile *from_tile,
+    const Domain::Position &from_pos, const Domain::Position &to_pos,
+    Domain::ChunkedMap *map, MoveContext &ctx,
+    std::vector<std::pair<size_t, Domain::Position>> &indexed_items) {
+  indexed_items.clear();
+  bool move_creature = false;
+  bool move_spawn = false;
+
+  for (auto it = first; it != last; ++it) {
+    switch (it->getType()) {
     case EntityType::Ground:
     case EntityType::Item: {
       const Domain::Item *item_ptr =
-          static_cast<const Domain::Item *>(entry.entity_ptr);
-      if (item_ptr) {
-        items_by_tile[from_pos.pack()].push_back({item_ptr, to_pos});
+          static_cast<const Domain::Item *>(it->entity_ptr);
+      if (!item_ptr) {
+        break;
       }
-      break;
-    }
-    case EntityType::Creature: {
-      creature_moves.push_back({from_pos, to_pos});
-      break;
-    }
-    case EntityType::Spawn: {
-      spawn_moves.push_back({from_pos, to_pos});
-      break;
-    }
-    }
-  }
 
-  // Extract all items from source tiles (PHASE 1)
-  for (auto &[tile_key, item_list] : items_by_tile) {
-    Domain::Position from_pos = Domain::Position::unpack(tile_key);
-    Domain::Tile *from_tile = map->getTile(from_pos);
-    if (!from_tile)
-      continue;
-
-    // Separate ground items from regular items
-    std::vector<std::pair<size_t, Domain::Position>>
-        indexed_items; // index, destination
-
-    for (const auto &[item_ptr, to_pos] : item_list) {
       // Check if it's ground
       if (from_tile->getGround() == item_ptr) {
         auto ground = from_tile->removeGround();
@@ -136,64 +335,144 @@ void MapEditingService::extractMovables(
           ctx.pending_items.push_back(
               {from_pos, to_pos, std::move(ground), true});
         }
-        continue;
+        break;
       }
 
-      // Find index in items vector using std::ranges
+      // Find index in items vector
       auto &items = from_tile->getItems();
-      // Using C++20 iterator based find_if
-      auto it = std::find_if(items.begin(), items.end(),
-                             [&](const std::unique_ptr<Domain::Item> &item) {
-                               return item.get() == item_ptr;
-                             });
-
-      if (it != items.end()) {
-        size_t index = std::distance(items.begin(), it);
-        indexed_items.push_back({index, to_pos});
+      auto found = std::find_if(items.begin(), items.end(),
+                                [&](const std::unique_ptr<Domain::Item> &item) {
+                                  return item.get() == item_ptr;
+                                });
+      if (found != items.end()) {
+        indexed_items.push_back(
+            {static_cast<size_t>(std::distance(items.begin(), found)), to_pos});
       }
+      break;
     }
+    case EntityType::Creature:
+      move_creature = true;
+      break;
+    case EntityType::Spawn:
+      move_spawn = true;
+      break;
+    }
+  }
 
-    // Sort by index descending to remove from back first (preserves indices)
-    std::sort(indexed_items.begin(), indexed_items.end(),
-              [](const auto &a, const auto &b) { return a.first > b.first; });
+  // Sort by index descending to remove from back first (preserves indices)
+  std::sort(indexed_items.begin(), indexed_items.end(),
+            [](const auto &a, const auto &b) { return a.first > b.first; });
 
-    for (const auto &[idx, to_pos] : indexed_items) {
-      auto moved = from_tile->removeItem(idx);
-      if (moved) {
-        ctx.pending_items.push_back(
-            {from_pos, to_pos, std::move(moved), false});
-      }
+  for (const auto &[idx, dest] : indexed_items) {
+    auto moved = from_tile->removeItem(idx);
+    if (moved) {
+      ctx.pending_items.push_back({from_pos, dest, std::move(moved), false});
     }
   }
 
-  // Extract all creatures
-  for (const auto &[from_pos, to_pos] : creature_moves) {
-    Domain::Tile *from_tile = map->getTile(from_pos);
-    if (from_tile && from_tile->hasCreature()) {
-      auto creature = from_tile->removeCreature();
-      if (creature) {
-        ctx.pending_creatures.push_back(
-            {from_pos, to_pos, std::move(creature)});
-      }
+  if (move_creature && from_tile->hasCreature()) {
+    auto creature = from_tile->removeCreature();
+    if (creature) {
+      ctx.pending_creatures.push_back({from_pos, to_pos, std::move(creature)});
     }
   }
 
-  // Extract all spawns
-  for (const auto &[from_pos, to_pos] : spawn_moves) {
-    Domain::Tile *from_tile = map->getTile(from_pos);
-    if (from_tile && from_tile->hasSpawn()) {
-      auto spawn = from_tile->removeSpawn();
-      if (spawn) {
-        map->notifySpawnChange(from_pos, false);
-        ctx.pending_spawns.push_back({from_pos, to_pos, std::move(spawn)});
-      }
+  // Tile::removeSpawn/setSpawn keep the chunk spawn counts, exactly like
+  // removeTile/setTile do for whole-tile moves; no extra notification
+  if (move_spawn && from_tile->hasSpawn()) {
+    auto spawn = from_tile->removeSpawn();
+    if (spawn) {
+      ctx.pending_spawns.push_back({from_pos, to_pos, std::move(spawn)});
     }
   }
+
+  // A source left with nothing at all goes away, as with whole-tile moves
+  if (from_tile->isEmpty() && !from_tile->hasCreature() &&
+      !from_tile->hasSpawn() &&
+      from_tile->getFlags() == Domain::TileFlag::None &&
+      from_tile->getHouseId() == 0) {
+    map->removeTile(from_pos);
+  }
+}
+
+// Record ground/items of a transplanted tile for the selection update
+static void recordMovedTile(const Domain::Tile *tile,
+                            std::vector<MapEditingService::MovedItemInfo> &out) {
+  const Domain::Position &pos = tile->getPosition();
+  if (const Domain::Item *ground = tile->getGround()) {
+    out.push_back({pos, EntityType::Ground, ground, ground->getServerId()});
+  }
+  for (const auto &item : tile->getItems()) {
+    out.push_back({pos, EntityType::Item, item.get(), item->getServerId()});
+  }
 }
 
 void MapEditingService::insertMovables(Domain::ChunkedMap *map,
                                        MoveContext &ctx) {
-  // PHASE 2: Insert all items into destination tiles
+  constexpr int32_t SIZE = Domain::Chunk::SIZE;
+
+  // PHASE 2a: Whole chunks go into empty destination slots as-is; occupied
+  // destinations fall back to per-tile moves
+  for (auto &pending : ctx.pending_chunks) {
+    auto rejected = map->insertChunk(pending.chunk_x, pending.chunk_y,
+                                     pending.z, std::move(pending.chunk));
+    if (!rejected) {
+      map->getChunk(pending.chunk_x, pending.chunk_y, pending.z)
+          ->forEachTile([&](const Domain::Tile *tile) {
+            recordMovedTile(tile, ctx.moved_info);
+          });
+      continue;
+    }
+
+    const int32_t dx = pending.chunk_x * SIZE - rejected->world_x;
+    const int32_t dy = pending.chunk_y * SIZE - rejected->world_y;
+    for (int ly = 0; ly < SIZE; ++ly) {
+      for (int lx = 0; lx < SIZE; ++lx) {
+        auto tile = rejected->removeTile(lx, ly);
+        if (!tile) {
+          continue;
+        }
+        tile->setParentChunk(nullptr);
+        Domain::Position from_pos(rejected->world_x + lx,
+                                  rejected->world_y + ly, pending.z);
+        Domain::Position to_pos(from_pos.x + dx, from_pos.y + dy, pending.z);
+        ctx.pending_tiles.push_back({from_pos, to_pos, std::move(tile)});
+      }
+    }
+  }
+
+  // PHASE 2b: Whole tiles - empty destinations take the Tile object, others
+  // merge entity by entity like partial selections
+  for (auto &pending : ctx.pending_tiles) {
+    if (!map->getTile(pending.to)) {
+      if (Domain::Spawn *spawn = pending.tile->getSpawn()) {
+        spawn->position = pending.to;
+      }
+      map->setTile(pending.to, std::move(pending.tile));
+      recordMovedTile(map->getTile(pending.to), ctx.moved_info);
+      continue;
+    }
+
+    Domain::Tile &tile = *pending.tile;
+    if (tile.hasGround()) {
+      ctx.pending_items.push_back(
+          {pending.from, pending.to, tile.removeGround(), true});
+    }
+    while (tile.getItemCount() > 0) {
+      ctx.pending_items.push_back(
+          {pending.from, pending.to, tile.removeItem(0), false});
+    }
+    if (tile.hasCreature()) {
+      ctx.pending_creatures.push_back(
+          {pending.from, pending.to, tile.removeCreature()});
+    }
+    if (tile.hasSpawn()) {
+      ctx.pending_spawns.push_back(
+          {pending.from, pending.to, tile.removeSpawn()});
+    }
+  }
+
+  // PHASE 2c: Insert all items into destination tiles
   // IMPORTANT: Save raw pointers and server IDs BEFORE moving, for selection
   // update
 
@@ -236,13 +515,20 @@ void MapEditingService::insertMovables(Domain::ChunkedMap *map,
     if (to_tile && !to_tile->hasSpawn()) {
       pending.spawn->position = pending.to;
       to_tile->setSpawn(std::move(pending.spawn));
-      map->notifySpawnChange(pending.to, true);
       spdlog::debug(
           "[MapEditingService] Moved spawn from ({},{},{}) to ({},{},{})",
           pending.from.x, pending.from.y, pending.from.z, pending.to.x,
           pending.to.y, pending.to.z);
     }
   }
+
+  // Flags and house ids of whole-tile moves return to their source
+  // positions, on top of anything moved there
+  for (const auto &state : ctx.source_states) {
+    Domain::Tile *tile = map->getOrCreateTile(state.pos);
+    tile->setFlags(state.flags);
+    tile->setHouseId(state.house_id);
+  }
 }
 
 void MapEditingService::updateSelectionAfterMove(
@@ -250,14 +536,17 @@ void MapEditingService::updateSelectionAfterMove(
     const MoveContext &ctx) {
   // Update selection to new positions using saved info
   selection_service.clear();
+
+  std::vector<SelectionEntry> entries;
+  entries.reserve(ctx.moved_info.size());
   for (const auto &info : ctx.moved_info) {
     EntityId new_id;
     new_id.position = info.position;
     new_id.type = info.type;
     new_id.local_id = reinterpret_cast<uint64_t>(info.ptr);
-    selection_service.addEntity(
-        SelectionEntry{new_id, info.ptr, info.server_id});
+    entries.push_back(SelectionEntry{new_id, info.ptr, info.server_id});
   }
+  selection_service.addEntities(entries);
 }
 
 } // namespace MapEditor::Services
@@ -2,16 +2,22 @@
 
 #include "Domain/MapInstance.h"
 #include "Domain/Selection/SelectionEntry.h"
+#include "Domain/Tile.h"
 #include <vector>
 
 namespace MapEditor::Domain {
 class ChunkedMap;
+class Chunk;
 class Item;
 class Creature;
 class Spawn;
+class Tile;
 namespace History {
 class HistoryManager;
 }
+namespace Selection {
+class SelectionBucket;
+}
 } // namespace MapEditor::Domain
 
 namespace MapEditor::Services {
@@ -45,6 +51,13 @@ public:
                  Domain::History::HistoryManager &history_manager, int32_t dx,
                  int32_t dy);
 
+  struct MovedItemInfo {
+    Domain::Position position;
+    Domain::Selection::EntityType type;
+    const Domain::Item *ptr;
+    uint16_t server_id;
+  };
+
 private:
   struct PendingItemMove {
     Domain::Position from, to;
@@ -60,30 +73,68 @@ private:
     std::unique_ptr<Domain::Spawn> spawn;
   };
 
-  struct MovedItemInfo {
-    Domain::Position position;
-    Domain::Selection::EntityType type;
-    const Domain::Item *ptr;
-    uint16_t server_id;
+  // Fully selected tile moved as a whole Tile object
+  struct PendingTileMove {
+    Domain::Position from, to;
+    std::unique_ptr<Domain::Tile> tile;
+  };
+  // Fully selected chunk moved by a chunk-aligned offset
+  struct PendingChunkMove {
+    int32_t chunk_x, chunk_y; // Destination chunk coordinates
+    int16_t z;
+    std::unique_ptr<Domain::Chunk> chunk;
+  };
+  // Flags and house id of a tile moved as a whole; they stay at the source
+  // like they do for partially selected tiles
+  struct SourceTileState {
+    Domain::Position pos;
+    Domain::TileFlag flags;
+    uint32_t house_id;
   };
 
   struct MoveContext {
+      std::vector<PendingChunkMove> pending_chunks;
+      std::vector<PendingTileMove> pending_tiles;
+      size_t moved_tiles = 0;
       std::vector<PendingItemMove> pending_items;
       std::vector<PendingCreatureMove> pending_creatures;
       std::vector<PendingSpawnMove> pending_spawns;
+      std::vector<SourceTileState> source_states;
       std::vector<MovedItemInfo> moved_info;
   };
 
-  void collectAffectedTiles(const std::vector<Domain::Selection::SelectionEntry>& entries,
+  void collectAffectedTiles(const Domain::Selection::SelectionBucket& selection,
                             int32_t dx, int32_t dy,
                             Domain::ChunkedMap* map,
                             Domain::History::HistoryManager& history_manager);
 
-  void extractMovables(const std::vector<Domain::Selection::SelectionEntry>& entries,
+  // Bulk variant of collectAffectedTiles: one region per floor, or per
+  // chunk (tiles where sparse) when the floor's selection is sparse
+  void recordAffectedRegions(const Domain::Selection::SelectionBucket& selection,
+                             int32_t dx, int32_t dy,
+                             Domain::ChunkedMap* map,
+                             Domain::History::HistoryManager& history_manager);
+
+  void extractMovables(const Domain::Selection::SelectionBucket& selection,
                        int32_t dx, int32_t dy,
                        Domain::ChunkedMap* map,
                        MoveContext& ctx);
 
+  // Extract the selected entities of one source tile (a run of entries)
+  void extractFromTile(std::vector<Domain::Selection::SelectionEntry>::const_iterator first,
+                       std::vector<Domain::Selection::SelectionEntry>::const_iterator last,
+                       Domain::Tile* from_tile,
+                       const Domain::Position& from_pos,
+                       const Domain::Position& to_pos,
+                       Domain::ChunkedMap* map,
+                       MoveContext& ctx,
+                       std::vector<std::pair<size_t, Domain::Position>>& indexed_items);
+
+  // Queue the flags and house id of a whole-tile move to stay at the source
+  static void detachSourceState(Domain::Tile& tile,
+                                const Domain::Position& from_pos,
+                                MoveContext& ctx);
+
   void insertMovables(Domain::ChunkedMap* map, MoveContext& ctx);
 
   void updateSelectionAfterMove(Services::Selection::SelectionService& selection_service,
@@ -0,0 +1,236 @@
+#include "MapSearchJob.h"
+#include "Core/Config.h"
+#include "Domain/ChunkedMap.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iterator>
+#include <spdlog/spdlog.h>
+
+namespace MapEditor::Services {
+
+MapSearchJob::MapSearchJob(const MapSearchService& service, const Domain::ChunkedMap& map,
+                           std::vector<MapSearchCriteria> passes, const MapSearchRequest& request)
+    : service_(service),
+      passes_(std::move(passes)),
+      query_(request.query),
+      limit_(request.limit),
+      pass_counts_(passes_.size()) {
+
+    // List chunk coordinates on the calling thread; workers never touch the map
+    const int32_t half = Domain::Chunk::SIZE / 2;
+    map.forEachChunk([&](const Domain::Chunk* chunk, int16_t z) {
+        if (!chunk || chunk->isEmpty()) return;
+        const int64_t dx = std::abs(static_cast<int64_t>(chunk->world_x + half) - request.origin.x);
+        const int64_t dy = std::abs(static_cast<int64_t>(chunk->world_y + half) - request.origin.y);
+        const int64_t dz = std::abs(static_cast<int64_t>(z) - request.origin.z);
+        chunks_.push_back({chunk->world_x / Domain::Chunk::SIZE,
+                           chunk->world_y / Domain::Chunk::SIZE, static_cast<int8_t>(z),
+                           std::max(dx, dy) + dz * Domain::Chunk::SIZE});
+    });
+
+    // Nearest-first so the first batches land around the camera
+    std::sort(chunks_.begin(), chunks_.end(),
+              [](const ChunkRef& a, const ChunkRef& b) { return a.distance < b.distance; });
+
+    if (chunks_.empty() || limit_ == 0) {
+        return;
+    }
+    snapshots_.resize(chunks_.size());
+
+    // First chunks are ready before the workers start
+    feed(map);
+
+    size_t thread_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+    thread_count = std::min({thread_count, Config::Performance::MAP_SEARCH_THREADS, chunks_.size()});
+
+    active_workers_.store(thread_count, std::memory_order_release);
+    workers_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers_.emplace_back(&MapSearchJob::workerLoop, this);
+    }
+}
+
+MapSearchJob::~MapSearchJob() {
+    cancel();
+
+    Batch* batch = published_.exchange(nullptr, std::memory_order_acquire);
+    while (batch) {
+        Batch* next = batch->next;
+        delete batch;
+        batch = next;
+    }
+}
+
+void MapSearchJob::feed(const Domain::ChunkedMap& map) {
+    // Everything fed (or workers released by cancel() / the limit)
+    if (fed_count_.load(std::memory_order_relaxed) >= chunks_.size()) {
+        return;
+    }
+
+    if (!anyPassWanted()) {
+        // Wake workers waiting for chunks so they see the limit and exit
+        fed_count_.store(chunks_.size(), std::memory_order_release);
+        fed_count_.notify_all();
+        return;
+    }
+
+    const size_t claimed = std::min(next_chunk_.load(std::memory_order_relaxed), chunks_.size());
+    const size_t end = std::min(chunks_.size(), claimed + Config::Performance::MAP_SEARCH_FEED_WINDOW);
+    if (fed_ >= end) {
+        return;
+    }
+
+    // Building a snapshot copies a whole chunk; cap the main-thread time and
+    // continue next frame. At least one chunk per call keeps the search moving.
+    const auto deadline = std::chrono::steady_clock::now() +
+        std::chrono::duration<double, std::milli>(Config::Performance::MAP_SEARCH_FEED_BUDGET_MS);
+    while (fed_ < end) {
+        const ChunkRef& ref = chunks_[fed_];
+        // Removed chunks simply have no snapshot; workers skip them
+        if (const Domain::Chunk* chunk = map.getChunk(ref.chunk_x, ref.chunk_y, ref.z)) {
+            snapshots_[fed_] = Domain::ChunkSnapshot::build(*chunk, ref.z);
+        }
+        ++fed_;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+    }
+
+    fed_count_.store(fed_, std::memory_order_release);
+    fed_count_.notify_all();
+}
+
+void MapSearchJob::cancel() {
+    cancelled_.store(true, std::memory_order_relaxed);
+    fed_count_.store(chunks_.size(), std::memory_order_release);
+    fed_count_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
+size_t MapSearchJob::drainResults(std::vector<std::vector<Domain::Search::MapSearchResult>>& out) {
+    out.resize(passes_.size());
+
+    Batch* head = published_.exchange(nullptr, std::memory_order_acquire);
+    if (!head) return 0;
+
+    // Stack is LIFO - reverse to restore publish order
+    Batch* ordered = nullptr;
+    while (head) {
+        Batch* next = head->next;
+        head->next = ordered;
+        ordered = head;
+        head = next;
+    }
+
+    size_t appended = 0;
+    while (ordered) {
+        Batch* next = ordered->next;
+        appended += ordered->results.size();
+        std::move(ordered->results.begin(), ordered->results.end(),
+                  std::back_inserter(out[ordered->pass]));
+        delete ordered;
+        ordered = next;
+    }
+    return appended;
+}
+
+float MapSearchJob::getProgress() const {
+    if (chunks_.empty()) return 1.0f;
+    const size_t claimed = std::min(next_chunk_.load(std::memory_order_relaxed), chunks_.size());
+    return static_cast<float>(claimed) / static_cast<float>(chunks_.size());
+}
+
+bool MapSearchJob::passWanted(size_t pass) const {
+    // A pass is shown after every earlier pass, so it is useless once it or
+    // the passes before it filled the limit
+    if (pass_counts_[pass].load(std::memory_order_relaxed) >= limit_) return false;
+    size_t before = 0;
+    for (size_t i = 0; i < pass; ++i) {
+        before += std::min(pass_counts_[i].load(std::memory_order_relaxed), limit_);
+    }
+    return before < limit_;
+}
+
+bool MapSearchJob::anyPassWanted() const {
+    for (size_t pass = 0; pass < passes_.size(); ++pass) {
+        if (passWanted(pass)) return true;
+    }
+    return false;
+}
+
+size_t MapSearchJob::resultCount() const {
+    size_t total = 0;
+    for (const auto& count : pass_counts_) {
+        total += std::min(count.load(std::memory_order_relaxed), limit_);
+    }
+    return total;
+}
+
+bool MapSearchJob::claimChunk(size_t& index) {
+    index = next_chunk_.load(std::memory_order_relaxed);
+    while (!cancelled_.load(std::memory_order_relaxed) && anyPassWanted() &&
+           index < chunks_.size()) {
+        const size_t fed = fed_count_.load(std::memory_order_acquire);
+        if (index >= fed) {
+            // Caught up with the main thread; sleep until the next feed()
+            fed_count_.wait(fed, std::memory_order_acquire);
+            index = next_chunk_.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (next_chunk_.compare_exchange_weak(index, index + 1, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void MapSearchJob::workerLoop() {
+    std::vector<std::vector<Domain::Search::MapSearchResult>> local(passes_.size());
+
+    size_t index = 0;
+    while (claimChunk(index)) {
+        // Only this worker touches the slot now; dropping it frees the copy
+        const auto snapshot = std::move(snapshots_[index]);
+        if (!snapshot) continue;  // Chunk removed since the search started
+
+        for (size_t pass = 0; pass < passes_.size(); ++pass) {
+            if (!passWanted(pass)) continue;
+            for (const auto& tile : snapshot->tiles) {
+                service_.searchSnapshotTile(*snapshot, tile, passes_[pass], local[pass], limit_);
+            }
+
+            // Publish per chunk so results stream in as soon as they are found
+            if (!local[pass].empty()) {
+                publish(pass, std::move(local[pass]));
+                local[pass].clear();
+            }
+        }
+    }
+
+    if (active_workers_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        spdlog::debug("MapSearchJob: '{}' finished ({} results)", query_, resultCount());
+    }
+}
+
+void MapSearchJob::publish(size_t pass, std::vector<Domain::Search::MapSearchResult>&& results) {
+    // Reserve result slots so concurrent workers never overshoot the limit
+    const size_t previous = pass_counts_[pass].fetch_add(results.size(), std::memory_order_relaxed);
+    if (previous >= limit_) return;
+    if (previous + results.size() > limit_) {
+        results.resize(limit_ - previous);
+    }
+
+    auto* batch = new Batch{pass, std::move(results), nullptr};
+    batch->next = published_.load(std::memory_order_relaxed);
+    while (!published_.compare_exchange_weak(batch->next, batch, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace MapEditor::Services
@@ -0,0 +1,145 @@
+#pragma once
+#include "Domain/Position.h"
+#include "Domain/ChunkSnapshot.h"
+#include "Domain/Search/MapSearchResult.h"
+#include "Services/Map/MapSearchService.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MapEditor {
+
+namespace Domain {
+    class ChunkedMap;
+}
+
+namespace Services {
+
+/**
+ * Parameters for an asynchronous map search.
+ */
+struct MapSearchRequest {
+    std::string query;
+    std::vector<MapSearchMode> modes = {MapSearchMode::ByName};  // Result order: all of pass 0, then pass 1, ...
+    bool search_items = true;
+    bool search_creatures = true;
+    size_t limit = 1000;
+    Domain::Position origin;  // Chunks nearest to this position are scanned first
+};
+
+/**
+ * Background map search with progressive result delivery.
+ *
+ * ARCHITECTURE:
+ * - Constructor lists the map's chunk coordinates (main thread) and sorts
+ *   them by distance to the request origin, so nearby hits arrive first
+ * - Main thread calls feed() each frame: it builds immutable snapshots of
+ *   the next chunks into per-chunk slots, within MAP_SEARCH_FEED_BUDGET_MS
+ *   and at most MAP_SEARCH_FEED_WINDOW chunks ahead of the workers
+ * - Worker threads claim fed chunks through an atomic cursor, take the
+ *   chunk's snapshot out of its slot and scan it; they never touch the map
+ * - Each worker publishes its matches per pass as a batch onto a lock-free
+ *   stack; a pass stops once it (or the passes before it) filled the limit
+ * - Main thread calls drainResults() each frame to collect new batches,
+ *   grouped by pass so callers can keep ID matches ahead of name matches
+ *
+ * Edits made while the search runs are safe: a chunk is read as of the frame
+ * it was fed, and chunks removed before that are skipped.
+ *
+ * Cancellation is cooperative: workers check the flag between chunks, so
+ * cancel() returns within one chunk scan. The destructor cancels and joins.
+ */
+class MapSearchJob {
+public:
+    MapSearchJob(const MapSearchService& service, const Domain::ChunkedMap& map,
+                 std::vector<MapSearchCriteria> passes, const MapSearchRequest& request);
+    ~MapSearchJob();
+
+    // Non-copyable
+    MapSearchJob(const MapSearchJob&) = delete;
+    MapSearchJob& operator=(const MapSearchJob&) = delete;
+
+    /**
+     * Snapshot the next chunks for the workers. Main thread only, with the
+     * map the job was started on; bounded by MAP_SEARCH_FEED_BUDGET_MS.
+     */
+    void feed(const Domain::ChunkedMap& map);
+
+    /**
+     * Request cancellation and wait for workers to stop.
+     * Batches already published remain drainable.
+     */
+    void cancel();
+
+    /**
+     * Move all published batches into out[pass] (appends, publish order).
+     * out is resized to getPassCount(). Non-blocking; call once per frame
+     * from the main thread.
+     * @return Number of results appended
+     */
+    size_t drainResults(std::vector<std::vector<Domain::Search::MapSearchResult>>& out);
+
+    size_t getPassCount() const { return passes_.size(); }
+
+    /**
+     * True once all workers have exited (completed, limit hit or cancelled).
+     */
+    bool isFinished() const { return active_workers_.load(std::memory_order_acquire) == 0; }
+
+    bool isCancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+    /**
+     * Progress in [0, 1] based on chunks claimed by workers.
+     */
+    float getProgress() const;
+
+    const std::string& getQuery() const { return query_; }
+
+private:
+    struct ChunkRef {
+        int32_t chunk_x = 0;
+        int32_t chunk_y = 0;
+        int8_t z = 0;
+        int64_t distance = 0;
+    };
+
+    // Intrusive node for the lock-free multi-producer result stack
+    struct Batch {
+        size_t pass = 0;
+        std::vector<Domain::Search::MapSearchResult> results;
+        Batch* next = nullptr;
+    };
+
+    void workerLoop();
+    bool claimChunk(size_t& index);
+    bool passWanted(size_t pass) const;
+    bool anyPassWanted() const;
+    size_t resultCount() const;
+    void publish(size_t pass, std::vector<Domain::Search::MapSearchResult>&& results);
+
+    const MapSearchService& service_;
+    std::vector<MapSearchCriteria> passes_;
+    std::vector<ChunkRef> chunks_;
+    std::string query_;
+    size_t limit_;
+
+    // Slot per chunk: written by feed() before fed_count_ covers it, then
+    // moved out by the worker that claims it
+    std::vector<std::shared_ptr<const Domain::ChunkSnapshot>> snapshots_;
+    size_t fed_ = 0;
+
+    std::atomic<size_t> fed_count_{0};  // Chunks workers may claim
+    std::atomic<size_t> next_chunk_{0};
+    std::vector<std::atomic<size_t>> pass_counts_;  // Results reserved per pass
+    std::atomic<bool> cancelled_{false};
+    std::atomic<size_t> active_workers_{0};
+    std::atomic<Batch*> published_{nullptr};
+
+    std::vector<std::thread> workers_;
+};
+
+} // namespace Services
+} // namespace MapEditor
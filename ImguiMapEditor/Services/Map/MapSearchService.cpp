@@ -1,4 +1,5 @@
 #include "MapSearchService.h"
+#include "MapSearchJob.h"
 #include "Domain/ChunkedMap.h"
 #include "Domain/Tile.h"
 #include "Domain/Item.h"
@@ -18,82 +19,161 @@ std::vector<Domain::Search::MapSearchResult> MapSearchService::search(
     
     std::vector<Domain::Search::MapSearchResult> results;
     
-    if (!map_ || query.empty()) {
+    MapSearchCriteria criteria;
+    if (!map_ || !buildCriteria(query, mode, search_items, search_creatures, criteria)) {
         return results;
     }
     
-    std::string query_lower = toLower(query);
-    uint16_t search_id = 0;
+    // Iterate all tiles on the map
+    map_->forEachTile([&](const Domain::Tile* tile) {
+        searchTile(tile, criteria, results, limit);
+    });
+    
+    return results;
+}
+
+std::unique_ptr<MapSearchJob> MapSearchService::startSearch(const MapSearchRequest& request) const {
+    if (!map_ || request.query.empty()) {
+        return nullptr;
+    }
+    
+    std::vector<MapSearchCriteria> passes;
+    for (MapSearchMode mode : request.modes) {
+        MapSearchCriteria criteria;
+        if (buildCriteria(request.query, mode, request.search_items, request.search_creatures, criteria)) {
+            passes.push_back(std::move(criteria));
+        }
+    }
+    
+    if (passes.empty()) {
+        return nullptr;
+    }
+    
+    return std::make_unique<MapSearchJob>(*this, *map_, std::move(passes), request);
+}
+
+bool MapSearchService::buildCriteria(const std::string& query, MapSearchMode mode,
+                                     bool search_items, bool search_creatures,
+                                     MapSearchCriteria& out) const {
+    if (query.empty()) {
+        return false;
+    }
+    
+    out.mode = mode;
+    out.query_lower = toLower(query);
+    out.search_id = 0;
+    out.search_items = search_items;
+    // Creatures only have names, so ID modes never match them
+    out.search_creatures = search_creatures && mode == MapSearchMode::ByName;
     
     // Parse ID for ID-based searches
     if (mode == MapSearchMode::ByServerId || mode == MapSearchMode::ByClientId) {
         try {
-            search_id = static_cast<uint16_t>(std::stoi(query));
+            out.search_id = static_cast<uint16_t>(std::stoi(query));
         } catch (...) {
-            return results;  // Invalid ID
+            return false;  // Invalid ID
         }
     }
+    return true;
+}
+
+void MapSearchService::searchTile(const Domain::Tile* tile, const MapSearchCriteria& criteria,
+                                  std::vector<Domain::Search::MapSearchResult>& results,
+                                  size_t limit) const {
+    if (!tile || results.size() >= limit) return;
     
-    // Iterate all tiles on the map
-    map_->forEachTile([&](const Domain::Tile* tile) {
-        if (!tile || results.size() >= limit) return;
+    const MapSearchMode mode = criteria.mode;
+    const std::string& query_lower = criteria.query_lower;
+    const uint16_t search_id = criteria.search_id;
+    
+    // Search items on tile
+    if (criteria.search_items) {
+        // Check ground
+        if (auto* ground = tile->getGround()) {
+            if (matchesItem(ground->getServerId(), mode, query_lower, search_id)) {
+                results.push_back(createResult(tile->getPosition(), ground->getServerId()));
+                if (results.size() >= limit) return;
+            }
+        }
         
-        // Search items on tile
-        if (search_items) {
-            // Check ground
-            if (auto* ground = tile->getGround()) {
-                if (matchesItem(ground, mode, query_lower, search_id)) {
-                    results.push_back(createResult(tile, ground));
-                    if (results.size() >= limit) return;
-                }
+        // Check stacked items
+        for (const auto& item_ptr : tile->getItems()) {
+            if (results.size() >= limit) return;
+            auto* item = item_ptr.get();
+            if (item && matchesItem(item->getServerId(), mode, query_lower, search_id)) {
+                results.push_back(createResult(tile->getPosition(), item->getServerId()));
             }
             
-            // Check stacked items
-            for (const auto& item_ptr : tile->getItems()) {
-                if (results.size() >= limit) return;
-                auto* item = item_ptr.get();
-                if (item && matchesItem(item, mode, query_lower, search_id)) {
-                    results.push_back(createResult(tile, item));
-                }
-                
-                // Search inside containers recursively
-                if (item) {
-                    searchContainerItems(item, tile, mode, query_lower, search_id, results, limit);
-                }
+            // Search inside containers recursively
+            if (item) {
+                searchContainerItems(item, tile, mode, query_lower, search_id, results, limit);
             }
         }
-        
-        // Search creature on tile
-        if (search_creatures && tile->hasCreature()) {
-            auto* creature = tile->getCreature();
-            if (creature && mode == MapSearchMode::ByName) {
-                if (matchesFuzzy(creature->name, query_lower)) {
-                    Domain::Search::MapSearchResult result;
-                    result.position = tile->getPosition();
-                    result.item_id = 0;
-                    result.creature_name = creature->name;
-                    result.display_name = creature->name;
-                    results.push_back(result);
-                }
+    }
+    
+    // Search creature on tile
+    if (criteria.search_creatures && tile->hasCreature() && results.size() < limit) {
+        auto* creature = tile->getCreature();
+        if (creature && matchesFuzzy(creature->name, query_lower)) {
+            Domain::Search::MapSearchResult result;
+            result.position = tile->getPosition();
+            result.item_id = 0;
+            result.creature_name = creature->name;
+            result.display_name = creature->name;
+            results.push_back(result);
+        }
+    }
+}
+
+void MapSearchService::searchSnapshotTile(const Domain::ChunkSnapshot& snapshot,
+                                          const Domain::ChunkSnapshot::Tile& tile,
+                                          const MapSearchCriteria& criteria,
+                                          std::vector<Domain::Search::MapSearchResult>& results,
+                                          size_t limit) const {
+    if (results.size() >= limit) return;
+    
+    const Domain::Position position(snapshot.world_x + tile.localX(),
+                                    snapshot.world_y + tile.localY(), snapshot.z);
+    
+    // Stack (ground first) followed by flattened container contents
+    if (criteria.search_items) {
+        const uint32_t end = tile.first_item + tile.item_count + tile.content_count;
+        for (uint32_t i = tile.first_item; i < end; ++i) {
+            if (results.size() >= limit) return;
+            const uint16_t server_id = snapshot.items[i].server_id;
+            if (matchesItem(server_id, criteria.mode, criteria.query_lower, criteria.search_id)) {
+                auto result = createResult(position, server_id);
+                result.is_in_container = i >= tile.first_item + tile.item_count;
+                results.push_back(std::move(result));
             }
         }
-    });
+    }
     
-    return results;
+    if (criteria.search_creatures &&
+        tile.creature != Domain::ChunkSnapshot::Tile::NO_CREATURE &&
+        results.size() < limit) {
+        const std::string& name = snapshot.creature_names[tile.creature];
+        if (matchesFuzzy(name, criteria.query_lower)) {
+            Domain::Search::MapSearchResult result;
+            result.position = position;
+            result.item_id = 0;
+            result.creature_name = name;
+            result.display_name = name;
+            results.push_back(result);
+        }
+    }
 }
 
-bool MapSearchService::matchesItem(const Domain::Item* item, MapSearchMode mode,
+bool MapSearchService::matchesItem(uint16_t server_id, MapSearchMode mode,
                                     const std::string& query_lower, uint16_t search_id) const {
-    if (!item) return false;
-    
     switch (mode) {
         case MapSearchMode::ByServerId:
-            return item->getServerId() == search_id;
+            return server_id == search_id;
             
         case MapSearchMode::ByClientId:
             // Need ClientDataService to lookup client ID
             if (client_data_) {
-                auto* item_type = client_data_->getItemTypeByServerId(item->getServerId());
+                auto* item_type = client_data_->getItemTypeByServerId(server_id);
                 return item_type && item_type->client_id == search_id;
             }
             return false;
@@ -102,7 +182,7 @@ bool MapSearchService::matchesItem(const Domain::Item* item, MapSearchMode mode,
         default:
             // Lookup item name from ClientDataService
             if (client_data_) {
-                auto* item_type = client_data_->getItemTypeByServerId(item->getServerId());
+                auto* item_type = client_data_->getItemTypeByServerId(server_id);
                 if (item_type && !item_type->name.empty()) {
                     return matchesFuzzy(item_type->name, query_lower);
                 }
@@ -112,22 +192,22 @@ bool MapSearchService::matchesItem(const Domain::Item* item, MapSearchMode mode,
 }
 
 Domain::Search::MapSearchResult MapSearchService::createResult(
-    const Domain::Tile* tile, const Domain::Item* item) const {
+    const Domain::Position& position, uint16_t server_id) const {
     
     Domain::Search::MapSearchResult result;
-    result.position = tile->getPosition();
-    result.item_id = item->getServerId();
+    result.position = position;
+    result.item_id = server_id;
     
     // Get display name from ClientDataService
     if (client_data_) {
-        auto* item_type = client_data_->getItemTypeByServerId(item->getServerId());
+        auto* item_type = client_data_->getItemTypeByServerId(server_id);
         if (item_type && !item_type->name.empty()) {
             result.display_name = item_type->name;
         } else {
-            result.display_name = "Item " + std::to_string(item->getServerId());
+            result.display_name = "Item " + std::to_string(server_id);
         }
     } else {
-        result.display_name = "Item " + std::to_string(item->getServerId());
+        result.display_name = "Item " + std::to_string(server_id);
     }
     
     return result;
@@ -145,8 +225,8 @@ void MapSearchService::searchContainerItems(
     for (const auto& item_ptr : container->getContainerItems()) {
         if (results.size() >= limit) return;
         auto* item = item_ptr.get();
-        if (item && matchesItem(item, mode, query_lower, search_id)) {
-            auto result = createResult(tile, item);
+        if (item && matchesItem(item->getServerId(), mode, query_lower, search_id)) {
+            auto result = createResult(tile->getPosition(), item->getServerId());
             result.is_in_container = true;  // Mark as found inside container
             results.push_back(result);
         }
@@ -1,6 +1,8 @@
 #pragma once
 #include "Domain/Search/MapSearchResult.h"
 #include "Domain/Search/SearchFilterTypes.h"
+#include "Domain/ChunkSnapshot.h"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -16,6 +18,8 @@ namespace Domain {
 namespace Services {
 
 class ClientDataService;
+class MapSearchJob;
+struct MapSearchRequest;
 
 /**
  * Mode for map search operations.
@@ -26,6 +30,18 @@ enum class MapSearchMode {
     ByClientId    // Exact client ID
 };
 
+/**
+ * Pre-parsed search parameters shared by every tile visited during a search.
+ * Built once per query so workers never re-parse or re-lowercase the query.
+ */
+struct MapSearchCriteria {
+    MapSearchMode mode = MapSearchMode::ByName;
+    std::string query_lower;
+    uint16_t search_id = 0;
+    bool search_items = true;
+    bool search_creatures = true;
+};
+
 /**
  * Service for searching items/creatures ON THE MAP.
  * Iterates map tiles to find matching entities.
@@ -66,6 +82,42 @@ public:
         size_t limit = 1000
     ) const;
     
+    /**
+     * Start an asynchronous, cancellable map search.
+     * Chunks are scanned on worker threads nearest-first from request.origin;
+     * results are delivered in batches via MapSearchJob::drainResults().
+     * @return Running job, or nullptr if no map is set or the query is invalid
+     */
+    std::unique_ptr<MapSearchJob> startSearch(const MapSearchRequest& request) const;
+    
+    /**
+     * Parse a query into criteria for the given mode.
+     * @return false if the query is empty or not a valid ID for ID modes
+     */
+    bool buildCriteria(const std::string& query, MapSearchMode mode,
+                       bool search_items, bool search_creatures,
+                       MapSearchCriteria& out) const;
+    
+    /**
+     * Append matches on a single tile (ground, stack, containers, creature).
+     * Thread-safe: only reads the tile and the item type database.
+     */
+    void searchTile(const Domain::Tile* tile, const MapSearchCriteria& criteria,
+                    std::vector<Domain::Search::MapSearchResult>& results,
+                    size_t limit) const;
+    
+    /**
+     * Append matches on one tile of a chunk snapshot.
+     * Thread-safe: snapshots are immutable, so this never touches the live map.
+     */
+    void searchSnapshotTile(const Domain::ChunkSnapshot& snapshot,
+                            const Domain::ChunkSnapshot::Tile& tile,
+                            const MapSearchCriteria& criteria,
+                            std::vector<Domain::Search::MapSearchResult>& results,
+                            size_t limit) const;
+    
+    const Domain::ChunkedMap* getMap() const { return map_; }
+    
     /**
      * Search the ITEM DATABASE (not map) for items matching filters.
      * Used for Advanced Search preview - shows matching item types.
@@ -84,7 +136,7 @@ public:
     
 private:
     bool matchesFuzzy(const std::string& text, const std::string& query) const;
-    bool matchesItem(const Domain::Item* item, MapSearchMode mode,
+    bool matchesItem(uint16_t server_id, MapSearchMode mode,
                      const std::string& query_lower, uint16_t search_id) const;
     void searchContainerItems(
         const Domain::Item* container,
@@ -95,7 +147,7 @@ private:
         std::vector<Domain::Search::MapSearchResult>& results,
         size_t limit) const;
     Domain::Search::MapSearchResult createResult(
-        const Domain::Tile* tile, const Domain::Item* item) const;
+        const Domain::Position& position, uint16_t server_id) const;
     std::string toLower(const std::string& str) const;
     
     const Domain::ChunkedMap* map_ = nullptr;
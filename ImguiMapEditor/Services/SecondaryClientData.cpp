@@ -124,12 +124,14 @@ SecondaryClientResult SecondaryClientData::loadFromFolder(
             }
             
             otb_item.is_ground = dat_item->is_ground;
+            otb_item.is_full_ground = dat_item->full_ground;
             otb_item.is_border = false;
             otb_item.is_hangable = dat_item->is_hangable;
             otb_item.hook_south = dat_item->is_horizontal;
             otb_item.hook_east = dat_item->is_vertical;
             otb_item.is_stackable = dat_item->is_stackable;
         }
+        otb_item.buildDrawRecipe();
         
         // Build server_id lookup
         if (otb_item.server_id > 0) {
@@ -58,6 +58,54 @@ void SelectionService::selectAt(Domain::ChunkedMap *map,
   addTileEntities(tile, filter);
 }
 
+// Visit every existing map chunk overlapping an inclusive rectangle together
+// with the covered tiles as a local mask. Missing chunks skip SIZE*SIZE tiles
+// with one lookup.
+template <typename Func>
+static void forEachChunkInRegion(const Domain::ChunkedMap *map, int32_t min_x,
+                                 int32_t min_y, int32_t max_x, int32_t max_y,
+                                 int16_t z, Func &&callback) {
+  constexpr int32_t SHIFT = SelectionChunk::SHIFT;
+  constexpr int32_t SIZE = Domain::Chunk::SIZE;
+  static_assert(SIZE == SelectionChunk::SIZE,
+                "Selection masks must cover exactly one map chunk");
+
+  if (min_x > max_x || min_y > max_y) {
+    return;
+  }
+
+  for (int32_t cy = min_y >> SHIFT; cy <= (max_y >> SHIFT); ++cy) {
+    for (int32_t cx = min_x >> SHIFT; cx <= (max_x >> SHIFT); ++cx) {
+      const Domain::Chunk *chunk = map->getChunk(cx, cy, z);
+      if (!chunk || chunk->isEmpty()) {
+        continue;
+      }
+
+      const TileMask rect =
+          TileMask::rect(std::max(min_x - chunk->world_x, 0),
+                         std::max(min_y - chunk->world_y, 0),
+                         std::min(max_x - chunk->world_x, SIZE - 1),
+                         std::min(max_y - chunk->world_y, SIZE - 1));
+      callback(*chunk, cx, cy, rect);
+    }
+  }
+}
+
+void SelectionService::collectChunkEntities(
+    const Domain::Chunk &chunk, int16_t z, const TileMask &mask,
+    const SelectionFilter &filter, std::vector<SelectionEntry> &out) {
+  constexpr int SIZE = SelectionChunk::SIZE;
+  mask.forEachSetBit([&](int index) {
+    const int lx = index & (SIZE - 1);
+    const int ly = index >> SelectionChunk::SHIFT;
+    if (const Domain::Tile *tile = chunk.getTileUnsafe(lx, ly)) {
+      appendFilteredEntities(
+          tile, Domain::Position{chunk.world_x + lx, chunk.world_y + ly, z},
+          filter, out);
+    }
+  });
+}
+
 void SelectionService::selectRegion(Domain::ChunkedMap *map, int32_t min_x,
                                     int32_t min_y, int32_t max_x, int32_t max_y,
                                     int16_t z, const SelectionFilter &filter) {
@@ -66,60 +114,79 @@ void SelectionService::selectRegion(Domain::ChunkedMap *map, int32_t min_x,
   }
 
   std::vector<SelectionEntry> added;
+  std::vector<SelectionEntry> candidates;
+
+  forEachChunkInRegion(map, min_x, min_y, max_x, max_y, z,
+                       [&](const Domain::Chunk &chunk, int32_t cx, int32_t cy,
+                           const TileMask &rect) {
+                         candidates.clear();
+                         collectChunkEntities(chunk, z, rect, filter,
+                                              candidates);
+                         bucket_.addChunkEntries(cx, cy, z, candidates, &added);
+                       });
+
+  for (const auto &entry : added) {
+    syncSelectionState(entry, true);
+  }
 
-  for (int32_t y = min_y; y <= max_y; ++y) {
-    for (int32_t x = min_x; x <= max_x; ++x) {
-      Domain::Position pos{x, y, z};
-      Domain::Tile *tile = map->getTile(pos);
-      if (!tile) {
-        continue;
-      }
+  if (!added.empty()) {
+    notifyChanged(added, {});
+  }
+}
 
-      // Collect entries to add
-      if (filter.include_ground) {
-        if (const Domain::Item *ground = tile->getGround()) {
-          SelectionEntry entry = createGroundEntry(pos, ground);
-          if (!bucket_.contains(entry.id)) {
-            bucket_.add(entry);
-            added.push_back(entry);
-          }
-        }
-      }
+void SelectionService::deselectRegion(int32_t min_x, int32_t min_y,
+                                      int32_t max_x, int32_t max_y, int16_t z,
+                                      const SelectionFilter &filter) {
+  std::vector<SelectionEntry> removed;
+  bucket_.removeRect(min_x, min_y, max_x, max_y, z, filter, &removed);
 
-      if (filter.include_items) {
-        for (const auto &item : tile->getItems()) {
-          SelectionEntry entry = createItemEntry(pos, item.get());
-          if (!bucket_.contains(entry.id)) {
-            bucket_.add(entry);
-            added.push_back(entry);
-          }
-        }
-      }
+  for (const auto &entry : removed) {
+    syncSelectionState(entry, false);
+  }
 
-      if (filter.include_creatures) {
-        if (const Domain::Creature *creature = tile->getCreature()) {
-          SelectionEntry entry = createCreatureEntry(pos, creature);
-          if (!bucket_.contains(entry.id)) {
-            bucket_.add(entry);
-            added.push_back(entry);
-          }
-        }
-      }
+  if (!removed.empty()) {
+    notifyChanged({}, removed);
+  }
+}
 
-      if (filter.include_spawns) {
-        if (const Domain::Spawn *spawn = tile->getSpawn()) {
-          SelectionEntry entry = createSpawnEntry(pos, spawn);
-          if (!bucket_.contains(entry.id)) {
-            bucket_.add(entry);
-            added.push_back(entry);
-          }
+void SelectionService::toggleRegion(Domain::ChunkedMap *map, int32_t min_x,
+                                    int32_t min_y, int32_t max_x, int32_t max_y,
+                                    int16_t z, const SelectionFilter &filter) {
+  if (!map) {
+    return;
+  }
+
+  std::vector<SelectionEntry> added;
+  std::vector<SelectionEntry> removed;
+  std::vector<SelectionEntry> candidates;
+
+  forEachChunkInRegion(
+      map, min_x, min_y, max_x, max_y, z,
+      [&](const Domain::Chunk &chunk, int32_t cx, int32_t cy,
+          const TileMask &rect) {
+        // Split the rectangle into selected and unselected tiles up front
+        TileMask to_add = rect;
+        if (const SelectionChunk *selected = bucket_.getChunk(cx, cy, z)) {
+          TileMask to_remove = rect;
+          to_remove &= selected->tiles;
+          to_add.clearBits(selected->tiles);
+          bucket_.removeMasked(cx, cy, z, to_remove, filter, &removed);
         }
-      }
-    }
+
+        candidates.clear();
+        collectChunkEntities(chunk, z, to_add, filter, candidates);
+        bucket_.addChunkEntries(cx, cy, z, candidates, &added);
+      });
+
+  for (const auto &entry : removed) {
+    syncSelectionState(entry, false);
+  }
+  for (const auto &entry : added) {
+    syncSelectionState(entry, true);
   }
 
-  if (!added.empty()) {
-    notifyChanged(added, {});
+  if (!added.empty() || !removed.empty()) {
+    notifyChanged(added, removed);
   }
 }
 
@@ -259,6 +326,21 @@ void SelectionService::addEntity(const SelectionEntry &entry) {
   notifyChanged({entry}, {});
 }
 
+void SelectionService::addEntities(const std::vector<SelectionEntry> &entries) {
+  std::vector<SelectionEntry> added;
+  added.reserve(entries.size());
+  for (const auto &entry : entries) {
+    if (bucket_.add(entry)) {
+      syncSelectionState(entry, true);
+      added.push_back(entry);
+    }
+  }
+
+  if (!added.empty()) {
+    notifyChanged(added, {});
+  }
+}
+
 void SelectionService::removeEntity(const EntityId &id) {
   if (!bucket_.contains(id)) {
     return; // Not selected
@@ -414,63 +496,66 @@ void SelectionService::addTileEntities(const Domain::Tile *tile,
   }
 
   // Non-specific filter: add based on type flags
+  addFilteredEntities(tile, pos, filter, added);
+
+  if (!added.empty()) {
+    notifyChanged(added, {});
+  }
+}
+
+void SelectionService::removeAllAt(const Domain::Position &pos) {
+  auto entries = bucket_.getEntriesAt(pos);
+  if (entries.empty()) {
+    return;
+  }
+
+  bucket_.removeAllAt(pos);
+  notifyChanged({}, entries);
+}
+
+// === Private Helpers ===
+
+void SelectionService::addFilteredEntities(const Domain::Tile *tile,
+                                           const Domain::Position &pos,
+                                           const SelectionFilter &filter,
+                                           std::vector<SelectionEntry> &added) {
+  std::vector<SelectionEntry> candidates;
+  appendFilteredEntities(tile, pos, filter, candidates);
+  for (const auto &entry : candidates) {
+    if (bucket_.add(entry)) {
+      added.push_back(entry);
+    }
+  }
+}
+
+void SelectionService::appendFilteredEntities(
+    const Domain::Tile *tile, const Domain::Position &pos,
+    const SelectionFilter &filter, std::vector<SelectionEntry> &out) {
   if (filter.include_ground) {
     if (const Domain::Item *ground = tile->getGround()) {
-      SelectionEntry entry = createGroundEntry(pos, ground);
-      if (!bucket_.contains(entry.id)) {
-        bucket_.add(entry);
-        added.push_back(entry);
-      }
+      out.push_back(createGroundEntry(pos, ground));
     }
   }
 
   if (filter.include_items) {
     for (const auto &item : tile->getItems()) {
-      SelectionEntry entry = createItemEntry(pos, item.get());
-      if (!bucket_.contains(entry.id)) {
-        bucket_.add(entry);
-        added.push_back(entry);
-      }
+      out.push_back(createItemEntry(pos, item.get()));
     }
   }
 
   if (filter.include_creatures) {
     if (const Domain::Creature *creature = tile->getCreature()) {
-      SelectionEntry entry = createCreatureEntry(pos, creature);
-      if (!bucket_.contains(entry.id)) {
-        bucket_.add(entry);
-        added.push_back(entry);
-      }
+      out.push_back(createCreatureEntry(pos, creature));
     }
   }
 
   if (filter.include_spawns) {
     if (const Domain::Spawn *spawn = tile->getSpawn()) {
-      SelectionEntry entry = createSpawnEntry(pos, spawn);
-      if (!bucket_.contains(entry.id)) {
-        bucket_.add(entry);
-        added.push_back(entry);
-      }
+      out.push_back(createSpawnEntry(pos, spawn));
     }
   }
-
-  if (!added.empty()) {
-    notifyChanged(added, {});
-  }
-}
-
-void SelectionService::removeAllAt(const Domain::Position &pos) {
-  auto entries = bucket_.getEntriesAt(pos);
-  if (entries.empty()) {
-    return;
-  }
-
-  bucket_.removeAllAt(pos);
-  notifyChanged({}, entries);
 }
 
-// === Private Helpers ===
-
 SelectionEntry SelectionService::createGroundEntry(const Domain::Position &pos,
                                                    const Domain::Item *ground) {
   EntityId id;
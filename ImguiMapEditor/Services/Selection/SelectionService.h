@@ -9,6 +9,7 @@
 // Forward declarations
 namespace MapEditor::Domain {
 class Tile;
+class Chunk;
 class ChunkedMap;
 class Item;
 struct Creature;
@@ -63,12 +64,29 @@ public:
 
   /**
    * Select entities in a rectangular region.
-   * Iterates through all tiles in the region and selects based on filter.
+   * Works per chunk: the rectangle becomes a tile mask and the new entries
+   * are merged into the chunk in one pass.
    */
   void selectRegion(Domain::ChunkedMap *map, int32_t min_x, int32_t min_y,
                     int32_t max_x, int32_t max_y, int16_t z,
                     const Domain::Selection::SelectionFilter &filter);
 
+  /**
+   * Deselect entities in a rectangular region.
+   * With an all-types filter whole tiles are cleared via the chunk masks.
+   */
+  void deselectRegion(int32_t min_x, int32_t min_y, int32_t max_x,
+                      int32_t max_y, int16_t z,
+                      const Domain::Selection::SelectionFilter &filter);
+
+  /**
+   * Toggle tiles in a rectangular region: tiles with any selection are
+   * deselected (per filter), unselected tiles are selected.
+   */
+  void toggleRegion(Domain::ChunkedMap *map, int32_t min_x, int32_t min_y,
+                    int32_t max_x, int32_t max_y, int16_t z,
+                    const Domain::Selection::SelectionFilter &filter);
+
   /**
    * Select all entities on a single tile.
    * Convenience method that creates filter for all entity types.
@@ -100,6 +118,11 @@ public:
    */
   void addEntity(const Domain::Selection::SelectionEntry &entry);
 
+  /**
+   * Add many entities with a single change notification.
+   */
+  void addEntities(const std::vector<Domain::Selection::SelectionEntry> &entries);
+
   /**
    * Remove a single entity from selection.
    */
@@ -131,6 +154,14 @@ public:
   std::vector<Domain::Selection::SelectionEntry>
   getEntriesOnFloor(int16_t floor) const;
 
+  /**
+   * Direct read access to the chunked storage for chunk-level iteration
+   * (overlay rendering, bulk moves).
+   */
+  const Domain::Selection::SelectionBucket &getBucket() const {
+    return bucket_;
+  }
+
   // === Snapshot (for Undo/Redo) ===
 
   /**
@@ -175,6 +206,25 @@ private:
   Domain::Selection::SelectionBucket bucket_;
   std::vector<ISelectionObserver *> observers_;
 
+  // Helper: add filter-matching entities of a tile, collecting new entries
+  void addFilteredEntities(const Domain::Tile *tile,
+                           const Domain::Position &pos,
+                           const Domain::Selection::SelectionFilter &filter,
+                           std::vector<Domain::Selection::SelectionEntry> &added);
+
+  // Helper: append filter-matching entities of a tile without selecting them
+  void appendFilteredEntities(const Domain::Tile *tile,
+                              const Domain::Position &pos,
+                              const Domain::Selection::SelectionFilter &filter,
+                              std::vector<Domain::Selection::SelectionEntry> &out);
+
+  // Helper: append filter-matching entities of the masked tiles of a chunk,
+  // in tile index order
+  void collectChunkEntities(const Domain::Chunk &chunk, int16_t z,
+                            const Domain::Selection::TileMask &mask,
+                            const Domain::Selection::SelectionFilter &filter,
+                            std::vector<Domain::Selection::SelectionEntry> &out);
+
   // Helper: create SelectionEntry for ground
   Domain::Selection::SelectionEntry
   createGroundEntry(const Domain::Position &pos, const Domain::Item *ground);
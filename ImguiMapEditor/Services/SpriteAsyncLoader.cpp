@@ -55,7 +55,14 @@ size_t SpriteAsyncLoader::process(Rendering::AtlasManager &atlas_manager,
 
   // Logic Fix: Don't drop sprites if PBO is full
   for (auto &result : completed) {
-    if (result.success && !result.rgba_data.empty()) {
+    // Failed loads are not requested again; successful ones become
+    // requestable again in case the upload below does not make it
+    const bool loaded = result.success && !result.rgba_data.empty();
+    atlas_manager.setStatus(result.sprite_id,
+                            loaded ? Rendering::SpriteStatus::None
+                                   : Rendering::SpriteStatus::Failed);
+
+    if (loaded) {
       // Try to stage the sprite
       bool staged = pbo_->stageSprite(result.sprite_id, result.rgba_data.data());
 
@@ -15,9 +15,20 @@ SpriteManager::SpriteManager(std::shared_ptr<IO::SprReader> spr_reader)
   // Create CreatureSpriteService
   creature_sprite_service_ =
       std::make_unique<CreatureSpriteService>(spr_reader_, atlas_manager_);
+  // Create ThumbnailAtlas for packed UI thumbnails
+  thumbnail_atlas_ = std::make_unique<ThumbnailAtlas>(
+      *item_compositor_, *creature_sprite_service_);
   // Create OverlaySpriteCache for ImGui rendering
   overlay_sprite_cache_ =
       std::make_unique<Rendering::OverlaySpriteCache>(spr_reader_);
+  // Size the sprite table for the primary sprite file
+  if (spr_reader_) {
+    atlas_manager_.reserveSprites(spr_reader_->getSpriteCount() + 1);
+  }
+  // Keep the GPU lookup table in step with atlas evictions
+  atlas_manager_.setEvictionCallback([this](uint32_t sprite_id) {
+    sprite_lut_.markPlaceholder(sprite_id);
+  });
 }
 
 SpriteManager::~SpriteManager() {
@@ -96,6 +107,10 @@ std::vector<uint8_t> SpriteManager::loadSpriteData(uint32_t sprite_id) {
 }
 
 size_t SpriteManager::processAsyncLoads() {
+  atlas_manager_.beginFrame();
+  creature_sprite_service_->beginFrame();
+  thumbnail_atlas_->process();
+
   if (!async_loader_ || !async_loader_->isInitialized()) {
     return 0;
   }
@@ -146,13 +161,14 @@ void SpriteManager::requestSpritesAsync(
   to_request.reserve(sprite_ids.size());
 
   for (uint32_t id : sprite_ids) {
-    // Skip if already in atlas or pending
+    // Skip if already in atlas, pending or failed
     if (id == 0)
       continue;
-    if (atlas_manager_.hasSprite(id))
+    if (atlas_manager_.hasSprite(id) ||
+        atlas_manager_.getStatus(id) != Rendering::SpriteStatus::None)
       continue;
 
-    // We don't check pending here because async_loader_ does it efficiently
+    atlas_manager_.setStatus(id, Rendering::SpriteStatus::Pending);
     to_request.push_back(id);
   }
 
@@ -184,8 +200,12 @@ SpriteManager::getSpriteRegion(uint32_t sprite_id) {
   }
 
   if (async_loader_ && async_loader_->isInitialized()) {
-    // Async mode: queue load if not pending, return nullptr
-    async_loader_->request(sprite_id);
+    // Async mode: queue load if not pending (table check, no hashing),
+    // return nullptr
+    if (atlas_manager_.getStatus(sprite_id) == Rendering::SpriteStatus::None) {
+      atlas_manager_.setStatus(sprite_id, Rendering::SpriteStatus::Pending);
+      async_loader_->request(sprite_id);
+    }
     return nullptr; // Caller should use placeholder
   } else {
     // Sync mode: load immediately (may stall!)
@@ -255,6 +275,9 @@ void SpriteManager::clearCache() {
   if (overlay_sprite_cache_) {
     overlay_sprite_cache_->clearCache();
   }
+  if (thumbnail_atlas_) {
+    thumbnail_atlas_->clear();
+  }
   spdlog::debug("Sprite cache cleared");
 }
 
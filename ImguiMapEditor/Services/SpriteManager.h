@@ -9,6 +9,7 @@
 #include "Rendering/Resources/AtlasManager.h"
 #include "Rendering/Resources/SpriteAtlasLUT.h"
 #include "SpriteAsyncLoader.h"
+#include "ThumbnailAtlas.h"
 #include <functional>
 #include <memory>
 #include <optional>
@@ -64,7 +65,8 @@ public:
   /**
    * Process completed async loads.
    * Call once per frame from main thread.
-   * Uploads completed sprites to GPU via PBO.
+   * Uploads completed sprites to GPU via PBO and finished UI thumbnails to
+   * the thumbnail atlas.
    * @return Number of sprites uploaded this frame
    */
   size_t processAsyncLoads();
@@ -117,6 +119,23 @@ public:
    */
   const Rendering::AtlasRegion *getSpriteRegion(uint32_t sprite_id);
 
+  /**
+   * Report a sprite that getSpriteRegion() could not provide.
+   * Counts every report (see getMissCount()) but returns true only for the
+   * first report of the sprite in a frame, so callers can keep their
+   * missing-sprite lists free of duplicates.
+   */
+  bool markMissing(uint32_t sprite_id) {
+    ++miss_count_;
+    return atlas_manager_.markMissing(sprite_id);
+  }
+
+  /**
+   * Get the number of markMissing() reports since start.
+   * Compare before and after building geometry to detect missing sprites.
+   */
+  uint64_t getMissCount() const { return miss_count_; }
+
   /**
    * Preload a sprite to the atlas immediately.
    * Wraps internal loading logic to allow external services to force load a sprite.
@@ -147,6 +166,11 @@ public:
     return *creature_sprite_service_;
   }
 
+  /**
+   * Get the ThumbnailAtlas for packed UI thumbnails (palette, search lists).
+   */
+  ThumbnailAtlas &getThumbnailAtlas() { return *thumbnail_atlas_; }
+
   /**
    * Get the OverlaySpriteCache for ImGui overlay rendering (previews,
    * tooltips).
@@ -169,6 +193,13 @@ public:
     return atlas_manager_.getTotalSpriteCount();
   }
 
+  /**
+   * Get sprite atlas residency counters (resident, evictions, thrash)
+   */
+  Rendering::AtlasResidencyStats getAtlasResidencyStats() const {
+    return atlas_manager_.getResidencyStats();
+  }
+
   /**
    * Clear texture cache (frees GPU memory)
    */
@@ -227,11 +258,15 @@ private:
   // Overlay sprite cache for ImGui rendering (previews, tooltips)
   std::unique_ptr<Rendering::OverlaySpriteCache> overlay_sprite_cache_;
 
+  // Packed UI thumbnails; declared after the compositors its workers use
+  std::unique_ptr<ThumbnailAtlas> thumbnail_atlas_;
+
   // Async loading subsystem (delegated)
   std::unique_ptr<SpriteAsyncLoader> async_loader_;
 
   // GPU lookup table for ID→UV resolution in shader
   Rendering::SpriteAtlasLUT sprite_lut_;
+  uint64_t miss_count_ = 0;
 
   // Callback for cache invalidation when sprites load
   SpritesLoadedCallback on_sprites_loaded_;
@@ -0,0 +1,419 @@
+#include "ThumbnailAtlas.h"
+#include "CreatureSpriteService.h"
+#include "Domain/ItemType.h"
+#include "IO/Readers/DatReaderBase.h"
+#include "ItemCompositor.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace MapEditor {
+namespace Services {
+
+namespace {
+
+constexpr uint64_t CREATURE_KEY_FLAG = 1ull << 63;
+
+// Cell edge in pixels and cells per block edge for a size class
+constexpr int cellSize(int size_class) { return 32 << size_class; }
+constexpr int cellsPerRow(int size_class) { return 4 >> size_class; }
+constexpr uint16_t fullMask(int size_class) {
+  return static_cast<uint16_t>(
+      (1u << (cellsPerRow(size_class) * cellsPerRow(size_class))) - 1);
+}
+
+int sizeClassFor(int pixel_size) {
+  int size_class = 0;
+  while (cellSize(size_class) < pixel_size) {
+    ++size_class;
+  }
+  return size_class;
+}
+
+// 2x2 box filter, used for thumbnails larger than a block
+std::vector<uint8_t> halve(const std::vector<uint8_t> &rgba, int size) {
+  const int half = size / 2;
+  std::vector<uint8_t> out(static_cast<size_t>(half) * half * 4);
+  for (int y = 0; y < half; ++y) {
+    for (int x = 0; x < half; ++x) {
+      const size_t src = (static_cast<size_t>(y) * 2 * size + x * 2) * 4;
+      const size_t dst = (static_cast<size_t>(y) * half + x) * 4;
+      for (int c = 0; c < 4; ++c) {
+        const int sum = rgba[src + c] + rgba[src + 4 + c] +
+                        rgba[src + size * 4 + c] + rgba[src + size * 4 + 4 + c];
+        out[dst + c] = static_cast<uint8_t>(sum / 4);
+      }
+    }
+  }
+  return out;
+}
+
+} // namespace
+
+ThumbnailAtlas::ThumbnailAtlas(ItemCompositor &item_compositor,
+                               CreatureSpriteService &creature_service)
+    : item_compositor_(item_compositor), creature_service_(creature_service) {}
+
+ThumbnailAtlas::~ThumbnailAtlas() { stopWorkers(); }
+
+ThumbnailHandle ThumbnailAtlas::getItem(const Domain::ItemType *type) {
+  if (!type || type->sprite_ids.empty()) {
+    return {};
+  }
+
+  const uint64_t key = type->client_id;
+  if (entries_.count(key)) {
+    return lookup(key);
+  }
+
+  const uint8_t width = type->width;
+  const uint8_t height = type->height;
+  const int size = std::max<int>(1, std::max(width, height)) * 32;
+  return request(key, size,
+                 [this, sprite_ids = type->sprite_ids, width, height] {
+                   return item_compositor_.compositeRgba(sprite_ids, width,
+                                                         height);
+                 });
+}
+
+ThumbnailHandle ThumbnailAtlas::getCreature(const IO::ClientItem *outfit_data,
+                                            uint8_t head, uint8_t body,
+                                            uint8_t legs, uint8_t feet) {
+  if (!outfit_data || outfit_data->sprite_ids.empty()) {
+    return {};
+  }
+
+  // Same layout as CreatureSpriteService's composited cache key
+  const uint64_t key = CREATURE_KEY_FLAG |
+                       (static_cast<uint64_t>(outfit_data->id) << 24) |
+                       (static_cast<uint64_t>(head & 0x3F) << 18) |
+                       (static_cast<uint64_t>(body & 0x3F) << 12) |
+                       (static_cast<uint64_t>(legs & 0x3F) << 6) |
+                       static_cast<uint64_t>(feet & 0x3F);
+  if (entries_.count(key)) {
+    return lookup(key);
+  }
+
+  const int size =
+      std::max<int>(1, std::max(outfit_data->width, outfit_data->height)) * 32;
+  return request(key, size,
+                 [this, outfit = *outfit_data, head, body, legs, feet] {
+                   return creature_service_.compositeCreatureRgba(
+                       outfit, head, body, legs, feet);
+                 });
+}
+
+ThumbnailHandle ThumbnailAtlas::lookup(uint64_t key) {
+  Entry &entry = entries_.find(key)->second;
+  switch (entry.state) {
+  case State::Ready:
+    // LRU: Move drawn entry to front
+    lru_order_.splice(lru_order_.begin(), lru_order_, entry.lru);
+    return entry.handle;
+  case State::Pending:
+    return placeholder(entry.handle.size);
+  case State::Failed:
+    break;
+  }
+  return {};
+}
+
+ThumbnailHandle ThumbnailAtlas::request(uint64_t key, int size,
+                                        Compositor composite) {
+  if (!ensurePlaceholder()) {
+    return {};
+  }
+
+  Entry &entry = entries_[key];
+  entry.handle.size = static_cast<float>(size);
+
+  if (workers_.empty()) {
+    startWorkers();
+  }
+  {
+    std::lock_guard<std::mutex> lock(jobs_mutex_);
+    jobs_.push_back({key, generation_, size, std::move(composite)});
+  }
+  jobs_cv_.notify_one();
+
+  return placeholder(entry.handle.size);
+}
+
+ThumbnailHandle ThumbnailAtlas::placeholder(float size) const {
+  ThumbnailHandle handle = placeholder_;
+  handle.size = size;
+  handle.pending = true;
+  return handle;
+}
+
+bool ThumbnailAtlas::ensurePlaceholder() {
+  if (placeholder_) {
+    return true;
+  }
+
+  uint32_t block = NO_BLOCK;
+  uint8_t cell = 0;
+  if (!allocate(0, block, cell)) {
+    return false;
+  }
+
+  // Background shade of the compositors with a lighter frame
+  constexpr int SIZE = 32;
+  constexpr uint8_t BG_SHADE = 48;
+  constexpr uint8_t FRAME_SHADE = 72;
+  std::vector<uint8_t> rgba(SIZE * SIZE * 4);
+  for (int y = 0; y < SIZE; ++y) {
+    for (int x = 0; x < SIZE; ++x) {
+      const bool frame = x < 2 || y < 2 || x >= SIZE - 2 || y >= SIZE - 2;
+      uint8_t *px = &rgba[(y * SIZE + x) * 4];
+      px[0] = px[1] = px[2] = frame ? FRAME_SHADE : BG_SHADE;
+      px[3] = 255;
+    }
+  }
+
+  Entry entry;
+  entry.block = block;
+  entry.cell = cell;
+  upload(entry, {0, generation_, SIZE, std::move(rgba)});
+  placeholder_ = entry.handle;
+  placeholder_.pending = true;
+  return true;
+}
+
+bool ThumbnailAtlas::addPage() {
+  if (pages_.size() >=
+      static_cast<size_t>(Config::Performance::THUMBNAIL_MAX_PAGES)) {
+    return false;
+  }
+
+  auto page = std::make_unique<Rendering::Texture>(PAGE_SIZE, PAGE_SIZE,
+                                                   nullptr);
+  if (!page->isValid()) {
+    spdlog::error("ThumbnailAtlas: Failed to create page texture");
+    return false;
+  }
+
+  const uint32_t first = static_cast<uint32_t>(blocks_.size());
+  blocks_.resize(blocks_.size() + BLOCKS_PER_PAGE);
+  // Pushed in reverse so blocks are handed out from the top-left
+  for (uint32_t b = first + BLOCKS_PER_PAGE; b-- > first;) {
+    free_blocks_.push_back(b);
+  }
+  pages_.push_back(std::move(page));
+
+  spdlog::debug("ThumbnailAtlas: Added page {} ({}x{})", pages_.size(),
+                PAGE_SIZE, PAGE_SIZE);
+  return true;
+}
+
+bool ThumbnailAtlas::allocate(int size_class, uint32_t &block, uint8_t &cell) {
+  while (!tryAllocate(size_class, block, cell)) {
+    if (lru_order_.empty()) {
+      return false;
+    }
+    evict(lru_order_.back());
+  }
+  return true;
+}
+
+bool ThumbnailAtlas::tryAllocate(int size_class, uint32_t &block,
+                                 uint8_t &cell) {
+  const uint16_t full = fullMask(size_class);
+
+  auto &partial = partial_blocks_[size_class];
+  while (!partial.empty()) {
+    Block &candidate = blocks_[partial.back()];
+    if (candidate.size_class != size_class || candidate.used == full) {
+      partial.pop_back();
+      continue;
+    }
+    block = partial.back();
+    cell = 0;
+    while (candidate.used & (1u << cell)) {
+      ++cell;
+    }
+    candidate.used |= static_cast<uint16_t>(1u << cell);
+    if (candidate.used == full) {
+      partial.pop_back();
+    }
+    return true;
+  }
+
+  if (free_blocks_.empty() && !addPage()) {
+    return false;
+  }
+
+  block = free_blocks_.back();
+  free_blocks_.pop_back();
+  blocks_[block].size_class = static_cast<int8_t>(size_class);
+  blocks_[block].used = 1;
+  cell = 0;
+  if (full != 1) {
+    partial.push_back(block);
+  }
+  return true;
+}
+
+void ThumbnailAtlas::release(uint32_t block, uint8_t cell) {
+  Block &b = blocks_[block];
+  b.used &= static_cast<uint16_t>(~(1u << cell));
+  if (b.used == 0) {
+    b.size_class = -1;
+    free_blocks_.push_back(block);
+  } else {
+    partial_blocks_[b.size_class].push_back(block);
+  }
+}
+
+void ThumbnailAtlas::evict(uint64_t key) {
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    lru_order_.pop_back();
+    return;
+  }
+  lru_order_.erase(it->second.lru);
+  release(it->second.block, it->second.cell);
+  entries_.erase(it);
+}
+
+void ThumbnailAtlas::upload(Entry &entry, const Result &result) {
+  const int size_class = blocks_[entry.block].size_class;
+  const uint32_t page = entry.block / BLOCKS_PER_PAGE;
+  const uint32_t block_in_page = entry.block % BLOCKS_PER_PAGE;
+  const int x = static_cast<int>(block_in_page % BLOCKS_PER_ROW) * BLOCK_SIZE +
+                (entry.cell % cellsPerRow(size_class)) * cellSize(size_class);
+  const int y = static_cast<int>(block_in_page / BLOCKS_PER_ROW) * BLOCK_SIZE +
+                (entry.cell / cellsPerRow(size_class)) * cellSize(size_class);
+
+  Rendering::Texture &texture = *pages_[page];
+  texture.updateRegion(x, y, result.size, result.size, result.rgba.data());
+
+  constexpr float INV_PAGE = 1.0f / static_cast<float>(PAGE_SIZE);
+  entry.handle.texture_id = texture.id();
+  entry.handle.u_min = x * INV_PAGE;
+  entry.handle.v_min = y * INV_PAGE;
+  entry.handle.u_max = (x + result.size) * INV_PAGE;
+  entry.handle.v_max = (y + result.size) * INV_PAGE;
+  entry.handle.pending = false;
+}
+
+size_t ThumbnailAtlas::process() {
+  {
+    std::lock_guard<std::mutex> lock(completed_mutex_);
+    for (auto &result : completed_) {
+      ready_.push_back(std::move(result));
+    }
+    completed_.clear();
+  }
+
+  size_t uploaded = 0;
+  while (!ready_.empty() &&
+         uploaded < Config::Performance::THUMBNAIL_UPLOADS_PER_FRAME) {
+    Result result = std::move(ready_.front());
+    ready_.pop_front();
+
+    if (result.generation != generation_) {
+      continue; // Cleared while in flight
+    }
+    auto it = entries_.find(result.key);
+    if (it == entries_.end() || it->second.state != State::Pending) {
+      continue;
+    }
+    Entry &entry = it->second;
+
+    if (result.rgba.empty() ||
+        !allocate(sizeClassFor(result.size), entry.block, entry.cell)) {
+      entry.state = State::Failed;
+      continue;
+    }
+
+    upload(entry, result);
+    entry.state = State::Ready;
+    lru_order_.push_front(result.key);
+    entry.lru = lru_order_.begin();
+    ++uploaded;
+  }
+
+  return uploaded;
+}
+
+void ThumbnailAtlas::clear() {
+  {
+    std::lock_guard<std::mutex> lock(jobs_mutex_);
+    jobs_.clear();
+  }
+  ++generation_;
+
+  entries_.clear();
+  lru_order_.clear();
+  ready_.clear();
+  pages_.clear();
+  blocks_.clear();
+  free_blocks_.clear();
+  for (auto &partial : partial_blocks_) {
+    partial.clear();
+  }
+  placeholder_ = {};
+}
+
+void ThumbnailAtlas::startWorkers() {
+  const size_t count = Config::Performance::THUMBNAIL_WORKER_THREADS;
+  workers_.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    workers_.emplace_back(&ThumbnailAtlas::workerLoop, this);
+  }
+}
+
+void ThumbnailAtlas::stopWorkers() {
+  if (shutdown_.exchange(true)) {
+    return;
+  }
+  jobs_cv_.notify_all();
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  workers_.clear();
+}
+
+void ThumbnailAtlas::workerLoop() {
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(jobs_mutex_);
+      jobs_cv_.wait(lock, [this] { return shutdown_ || !jobs_.empty(); });
+      if (shutdown_) {
+        return;
+      }
+      job = std::move(jobs_.back());
+      jobs_.pop_back();
+    }
+
+    Result result;
+    result.key = job.key;
+    result.generation = job.generation;
+    result.size = job.size;
+    try {
+      result.rgba = job.composite();
+    } catch (const std::exception &e) {
+      spdlog::error("ThumbnailAtlas: Exception compositing thumbnail: {}",
+                    e.what());
+      result.rgba.clear();
+    }
+
+    if (result.rgba.size() !=
+        static_cast<size_t>(result.size) * result.size * 4) {
+      result.rgba.clear();
+    }
+    while (!result.rgba.empty() && result.size > BLOCK_SIZE) {
+      result.rgba = halve(result.rgba, result.size);
+      result.size /= 2;
+    }
+
+    std::lock_guard<std::mutex> lock(completed_mutex_);
+    completed_.push_back(std::move(result));
+  }
+}
+
+} // namespace Services
+} // namespace MapEditor
@@ -0,0 +1,196 @@
+#pragma once
+#include "Core/Config.h"
+#include "Rendering/Core/Texture.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace MapEditor {
+
+namespace Domain {
+class ItemType;
+}
+
+namespace IO {
+struct ClientItem;
+}
+
+namespace Services {
+
+class ItemCompositor;
+class CreatureSpriteService;
+
+/**
+ * Location of a UI thumbnail inside a ThumbnailAtlas page.
+ * Draw with the page texture and the UV rectangle, e.g.
+ * ImGui::Image(id, size, {u_min, v_min}, {u_max, v_max}).
+ */
+struct ThumbnailHandle {
+  uint32_t texture_id = 0; // GL name of the page texture, 0 if unavailable
+  float u_min = 0.0f;
+  float v_min = 0.0f;
+  float u_max = 0.0f;
+  float v_max = 0.0f;
+  float size = 32.0f;   // Natural size in pixels: max(width, height) * 32
+  bool pending = false; // Placeholder region while compositing is in flight
+
+  explicit operator bool() const { return texture_id != 0; }
+};
+
+/**
+ * Packs UI thumbnails (composited items and creatures) into a few large
+ * textures so palette and search lists draw from one texture per page
+ * instead of one GL texture per entry.
+ *
+ * - Compositing runs on worker threads; the first request for a thumbnail
+ *   returns a placeholder region and queues the work.
+ * - process() uploads finished thumbnails into free page cells on the main
+ *   thread, a bounded number per frame.
+ * - Pages are split into 128px blocks, and each block into cells of one size
+ *   class (32, 64 or 128px). When all pages are full the least recently
+ *   drawn thumbnails are evicted.
+ *
+ * Handles are plain values; look them up every frame rather than storing
+ * them, since an evicted thumbnail's cell is reused.
+ */
+class ThumbnailAtlas {
+public:
+  ThumbnailAtlas(ItemCompositor &item_compositor,
+                 CreatureSpriteService &creature_service);
+  ~ThumbnailAtlas();
+
+  // Non-copyable
+  ThumbnailAtlas(const ThumbnailAtlas &) = delete;
+  ThumbnailAtlas &operator=(const ThumbnailAtlas &) = delete;
+
+  /**
+   * Get the thumbnail for an item type, keyed by client id.
+   * @return Ready or placeholder handle, or an empty handle if the item
+   *         has no sprites
+   */
+  ThumbnailHandle getItem(const Domain::ItemType *type);
+
+  /**
+   * Get the south-facing thumbnail for a colorized outfit.
+   * @return Ready or placeholder handle, or an empty handle if the outfit
+   *         has no sprites
+   */
+  ThumbnailHandle getCreature(const IO::ClientItem *outfit_data, uint8_t head,
+                              uint8_t body, uint8_t legs, uint8_t feet);
+
+  /**
+   * Upload thumbnails finished by the workers.
+   * Call once per frame from the main thread, before UI rendering.
+   * @return Number of thumbnails uploaded
+   */
+  size_t process();
+
+  /**
+   * Drop all thumbnails and pages. In-flight work is discarded.
+   */
+  void clear();
+
+  /**
+   * Get number of tracked thumbnails (ready, pending and failed).
+   */
+  size_t getEntryCount() const { return entries_.size(); }
+
+  /**
+   * Get number of allocated page textures.
+   */
+  size_t getPageCount() const { return pages_.size(); }
+
+private:
+  static constexpr int BLOCK_SIZE = 128;
+  static constexpr int SIZE_CLASSES = 3; // 32, 64, 128px cells
+  static constexpr int PAGE_SIZE = Config::Performance::THUMBNAIL_PAGE_SIZE;
+  static constexpr int BLOCKS_PER_ROW = PAGE_SIZE / BLOCK_SIZE;
+  static constexpr int BLOCKS_PER_PAGE = BLOCKS_PER_ROW * BLOCKS_PER_ROW;
+  static constexpr uint32_t NO_BLOCK = 0xFFFFFFFF;
+
+  enum class State : uint8_t { Pending, Ready, Failed };
+
+  struct Entry {
+    State state = State::Pending;
+    ThumbnailHandle handle;
+    uint32_t block = NO_BLOCK;
+    uint8_t cell = 0;
+    std::list<uint64_t>::iterator lru;
+  };
+
+  using Compositor = std::function<std::vector<uint8_t>()>;
+
+  struct Job {
+    uint64_t key = 0;
+    uint32_t generation = 0;
+    int size = 0;
+    Compositor composite;
+  };
+
+  struct Result {
+    uint64_t key = 0;
+    uint32_t generation = 0;
+    int size = 0; // Pixel size of rgba, may be downsampled from Job::size
+    std::vector<uint8_t> rgba;
+  };
+
+  struct Block {
+    int8_t size_class = -1; // -1 = free
+    uint16_t used = 0;      // Bit per occupied cell
+  };
+
+  ThumbnailHandle lookup(uint64_t key);
+  ThumbnailHandle request(uint64_t key, int size, Compositor composite);
+  ThumbnailHandle placeholder(float size) const;
+
+  bool ensurePlaceholder();
+  bool addPage();
+  bool allocate(int size_class, uint32_t &block, uint8_t &cell);
+  bool tryAllocate(int size_class, uint32_t &block, uint8_t &cell);
+  void release(uint32_t block, uint8_t cell);
+  void evict(uint64_t key);
+  void upload(Entry &entry, const Result &result);
+
+  void startWorkers();
+  void stopWorkers();
+  void workerLoop();
+
+  ItemCompositor &item_compositor_;
+  CreatureSpriteService &creature_service_;
+
+  // Page textures and cell allocation
+  std::vector<std::unique_ptr<Rendering::Texture>> pages_;
+  std::vector<Block> blocks_;
+  std::vector<uint32_t> free_blocks_;
+  // Blocks per size class that may have a free cell (validated on use)
+  std::vector<uint32_t> partial_blocks_[SIZE_CLASSES];
+  ThumbnailHandle placeholder_;
+
+  // Thumbnails by key; LRU front = most recently drawn (ready entries only)
+  std::unordered_map<uint64_t, Entry> entries_;
+  std::list<uint64_t> lru_order_;
+
+  // Results waiting for upload budget (main thread only)
+  std::deque<Result> ready_;
+  uint32_t generation_ = 0;
+
+  // Worker pool: jobs are taken newest first so visible rows win
+  std::vector<std::thread> workers_;
+  std::deque<Job> jobs_;
+  std::mutex jobs_mutex_;
+  std::condition_variable jobs_cv_;
+  std::vector<Result> completed_;
+  std::mutex completed_mutex_;
+  std::atomic<bool> shutdown_{false};
+};
+
+} // namespace Services
+} // namespace MapEditor
@@ -152,6 +152,7 @@ void MapContextMenu::renderItemActions(AppLogic::EditorSession *session) {
             auto &mutable_items = mutable_tile->getItems();
             auto *mutable_item = mutable_items.back().get();
             mutable_item->setServerId(type->rotateTo);
+            mutable_tile->markDirty();
             session->setModified(true);
           }
         }
@@ -190,7 +191,7 @@ void MapContextMenu::renderItemActions(AppLogic::EditorSession *session) {
                       has_items)) {
     if (properties_callback_ && current_tile_ &&
         !current_tile_->getItems().empty()) {
-      properties_callback_(current_tile_->getItems().back().get());
+      properties_callback_(current_tile_->getItems().back().get(), position_);
     }
   }
   if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled)) {
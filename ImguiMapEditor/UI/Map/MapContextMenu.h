@@ -21,7 +21,8 @@ namespace MapEditor::UI {
  */
 class MapContextMenu {
 public:
-    using PropertiesCallback = std::function<void(Domain::Item*)>;
+    using PropertiesCallback =
+        std::function<void(Domain::Item*, const Domain::Position&)>;
     using GotoCallback = std::function<void(const Domain::Position&)>;
     // Extended to pass top item server ID (0 if no item on tile)
     using BrowseTileCallback = std::function<void(const Domain::Position&, uint16_t item_server_id)>;
@@ -374,6 +374,8 @@ void MapPanelInput::handleSelectionMouseDown(const MapViewCamera &camera,
       mods_at_down_ |= GLFW_MOD_CONTROL;
     if (io.KeyShift)
       mods_at_down_ |= GLFW_MOD_SHIFT;
+    if (io.KeyAlt)
+      mods_at_down_ |= GLFW_MOD_ALT;
 
     // Immediate selection on mouse down (if not box selection)
     // IMPORTANT: For brush mode, do NOT paint here - let the drag stroke handle
@@ -484,10 +486,12 @@ void MapPanelInput::handleDragRelease(
     }
 
     if (started_with_shift_ && is_drag) {
-      // Box selection
+      // Box selection: SHIFT replaces, CTRL+SHIFT adds, ALT+SHIFT subtracts
+      // and CTRL+ALT+SHIFT toggles
       if (session) {
-        // FIX: Only clear if CTRL is NOT held (CTRL+SHIFT+Drag = additive)
-        if (!(mods_at_down_ & GLFW_MOD_CONTROL)) {
+        const bool ctrl = mods_at_down_ & GLFW_MOD_CONTROL;
+        const bool alt = mods_at_down_ & GLFW_MOD_ALT;
+        if (!ctrl && !alt) {
           session->getSelectionService().clear();
         }
 
@@ -505,7 +509,13 @@ void MapPanelInput::handleDragRelease(
 
         // Iterate over all floors in range (descending: start to end)
         for (int16_t z = floor_range.start_z; z >= floor_range.end_z; --z) {
-          session->selectRegion(min_x, min_y, max_x, max_y, z);
+          if (ctrl && alt) {
+            session->toggleRegion(min_x, min_y, max_x, max_y, z);
+          } else if (alt) {
+            session->deselectRegion(min_x, min_y, max_x, max_y, z);
+          } else {
+            session->selectRegion(min_x, min_y, max_x, max_y, z);
+          }
         }
       }
     } else if (is_drag) {
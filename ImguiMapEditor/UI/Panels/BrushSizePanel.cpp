@@ -121,6 +121,31 @@ void BrushSizePanel::renderTopRow() {
   Utils::SetTooltipOnHover(
       symmetricSize_ ? "Symmetric: W=H linked (click to unlock)"
                      : "Asymmetric: W and H independent (click to link)");
+
+  ImGui::SameLine();
+
+  // Fill mode toggle (right-click for the size limit)
+  bool fillMode = service_->isFillMode();
+  if (fillMode) {
+    ImGui::PushStyleColor(ImGuiCol_Button, ACTIVE_TOGGLE_COLOR);
+  }
+  if (ImGui::Button(ICON_FA_FILL_DRIP)) {
+    service_->setFillMode(!fillMode);
+  }
+  if (fillMode) {
+    ImGui::PopStyleColor();
+  }
+  Utils::SetTooltipOnHover(
+      "Fill: click fills the connected area of the same ground\n"
+      "(right-click to set the size limit)");
+  if (ImGui::BeginPopupContextItem("##FillLimit")) {
+    int limit = service_->getFillLimit();
+    ImGui::SetNextItemWidth(120.0f);
+    if (ImGui::InputInt("Max tiles", &limit, 1024, 16384)) {
+      service_->setFillLimit(limit);
+    }
+    ImGui::EndPopup();
+  }
 }
 
 void BrushSizePanel::renderSizeSliders() {
@@ -3,6 +3,7 @@
 #include "Services/ClientDataService.h"
 #include "Rendering/Tile/CreatureSpriteHelper.h"
 #include "Rendering/Core/Texture.h"
+#include "Domain/CreatureType.h"
 
 namespace MapEditor::UI::Utils {
 
@@ -45,4 +46,36 @@ CreaturePreviewResult GetCreaturePreview(Services::ClientDataService& clientData
     return GetCreaturePreviewImpl(clientData, spriteManager, outfit);
 }
 
+Services::ThumbnailHandle GetItemThumbnail(Services::SpriteManager& spriteManager,
+                                           const Domain::ItemType* itemType) {
+    return spriteManager.getThumbnailAtlas().getItem(itemType);
+}
+
+Services::ThumbnailHandle GetCreatureThumbnail(Services::ClientDataService& clientData,
+                                               Services::SpriteManager& spriteManager,
+                                               const std::string& name) {
+    if (name.empty()) {
+        return {};
+    }
+    const Domain::CreatureType* creatureType = clientData.getCreatureType(name);
+    if (!creatureType) {
+        return {};
+    }
+    return GetCreatureThumbnail(clientData, spriteManager, creatureType->outfit);
+}
+
+Services::ThumbnailHandle GetCreatureThumbnail(Services::ClientDataService& clientData,
+                                               Services::SpriteManager& spriteManager,
+                                               const Domain::Outfit& outfit) {
+    if (outfit.lookType == 0) {
+        return {};
+    }
+    return spriteManager.getThumbnailAtlas().getCreature(
+        clientData.getOutfitData(outfit.lookType),
+        static_cast<uint8_t>(outfit.lookHead),
+        static_cast<uint8_t>(outfit.lookBody),
+        static_cast<uint8_t>(outfit.lookLegs),
+        static_cast<uint8_t>(outfit.lookFeet));
+}
+
 } // namespace MapEditor::UI::Utils
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Services/ThumbnailAtlas.h"
 #include <string>
 
 namespace MapEditor::Services {
@@ -40,4 +41,19 @@ CreaturePreviewResult GetCreaturePreview(Services::ClientDataService& clientData
                                          Services::SpriteManager& spriteManager,
                                          const Domain::Outfit& outfit);
 
+// Retrieves an item thumbnail from the shared thumbnail atlas.
+// Returns a placeholder region while the thumbnail is being composited.
+Services::ThumbnailHandle GetItemThumbnail(Services::SpriteManager& spriteManager,
+                                           const Domain::ItemType* itemType);
+
+// Retrieves a creature thumbnail from the shared thumbnail atlas by name.
+Services::ThumbnailHandle GetCreatureThumbnail(Services::ClientDataService& clientData,
+                                               Services::SpriteManager& spriteManager,
+                                               const std::string& name);
+
+// Retrieves a creature thumbnail from the shared thumbnail atlas by outfit.
+Services::ThumbnailHandle GetCreatureThumbnail(Services::ClientDataService& clientData,
+                                               Services::SpriteManager& spriteManager,
+                                               const Domain::Outfit& outfit);
+
 } // namespace MapEditor::UI::Utils
@@ -18,7 +18,8 @@ namespace MapEditor::UI::Properties {
 void PropertyPanelRenderer::setContext(
     Domain::Item* item, Domain::Spawn* spawn, Domain::Creature* creature,
     uint32_t otbm_version, Services::SpriteManager* sprite_manager,
-    uint16_t map_width, uint16_t map_height, Domain::ChunkedMap* map) 
+    uint16_t map_width, uint16_t map_height, Domain::ChunkedMap* map,
+    Domain::Tile* tile) 
 {
     bool context_changed = (item_ != item || spawn_ != spawn || creature_ != creature);
     
@@ -30,6 +31,7 @@ void PropertyPanelRenderer::setContext(
     map_width_ = map_width;
     map_height_ = map_height;
     map_ = map;
+    tile_ = tile;
     
     if (item_) {
         item_type_ = item_->getType();
@@ -188,6 +190,11 @@ void PropertyPanelRenderer::applyChangesToContext() {
         creature_->direction = edit_.direction;
     }
     
+    // Edits above are in place; bump the chunk revision for caches
+    if (tile_) {
+        tile_->markDirty();
+    }
+    
     apply_flash_frames_ = 15;  // Flash for ~0.25s at 60fps
 }
 
@@ -9,6 +9,7 @@ class ItemType;
 struct Spawn;
 struct Creature;
 class ChunkedMap;
+class Tile;
 } // namespace Domain
 namespace Services {
 class SpriteManager;
@@ -51,12 +52,14 @@ public:
    * @param otbm_version Map OTBM version for feature gating
    * @param sprite_manager For container item sprites (optional)
    * @param map For town lookup in depot dropdown (optional)
+   * @param tile Tile owning the edited objects, marked dirty on apply
    */
   void setContext(Domain::Item *item, Domain::Spawn *spawn,
                   Domain::Creature *creature, uint32_t otbm_version,
                   Services::SpriteManager *sprite_manager = nullptr,
                   uint16_t map_width = 65535, uint16_t map_height = 65535,
-                  Domain::ChunkedMap *map = nullptr);
+                  Domain::ChunkedMap *map = nullptr,
+                  Domain::Tile *tile = nullptr);
 
   /**
    * Render the appropriate property panel.
@@ -108,6 +111,7 @@ private:
   uint16_t map_width_ = 65535;
   uint16_t map_height_ = 65535;
   Domain::ChunkedMap *map_ = nullptr;
+  Domain::Tile *tile_ = nullptr;
   PanelType panel_type_ = PanelType::None;
 
   // Track context changes
@@ -5,7 +5,6 @@
 #include "Services/ItemPickerService.h"
 #include "Services/ClientDataService.h"
 #include "Services/SpriteManager.h"
-#include "Rendering/Core/Texture.h"
 #include "UI/Utils/UIUtils.hpp"
 #include "UI/Utils/PreviewUtils.hpp"
 #include "Core/Config.h"
@@ -107,14 +106,16 @@ void QuickSearchPopup::render() {
                     bool rendered = false;
                     if (sprite_manager_ && client_data_) {
                         if (result.is_creature) {
-                            if (auto preview = Utils::GetCreaturePreview(*client_data_, *sprite_manager_, result.name)) {
-                                ImGui::Image(reinterpret_cast<void*>(static_cast<intptr_t>(preview.texture->id())), ImVec2(preview.size, preview.size));
+                            if (auto thumb = Utils::GetCreatureThumbnail(*client_data_, *sprite_manager_, result.name)) {
+                                ImGui::Image(reinterpret_cast<void*>(static_cast<intptr_t>(thumb.texture_id)), ImVec2(thumb.size, thumb.size),
+                                             ImVec2(thumb.u_min, thumb.v_min), ImVec2(thumb.u_max, thumb.v_max));
                                 rendered = true;
                             }
                         } else if (const auto* item_type = client_data_->getItemTypeByServerId(result.server_id)) {
-                            if (auto* texture = Utils::GetItemPreview(*sprite_manager_, item_type)) {
+                            if (auto thumb = Utils::GetItemThumbnail(*sprite_manager_, item_type)) {
                                 const float size = static_cast<float>(std::max(item_type->width, item_type->height)) * Config::UI::PREVIEW_TILE_SIZE;
-                                ImGui::Image(reinterpret_cast<void*>(static_cast<intptr_t>(texture->id())), ImVec2(size, size));
+                                ImGui::Image(reinterpret_cast<void*>(static_cast<intptr_t>(thumb.texture_id)), ImVec2(size, size),
+                                             ImVec2(thumb.u_min, thumb.v_min), ImVec2(thumb.u_max, thumb.v_max));
                                 rendered = true;
                             }
                         }
@@ -4,10 +4,9 @@
 #include <string_view>
 #include <format>
 #include "ext/fontawesome6/IconsFontAwesome6.h"
-#include "Services/Map/MapSearchService.h"
+#include "Core/Config.h"
 #include "Services/SpriteManager.h"
 #include "Services/ClientDataService.h"
-#include "Rendering/Core/Texture.h"
 #include "UI/Utils/UIUtils.hpp"
 #include "UI/Utils/PreviewUtils.hpp"
 
@@ -20,13 +19,56 @@ SearchResultsWidget::SearchResultsWidget() {
 void SearchResultsWidget::setResults(const std::vector<Domain::Search::MapSearchResult>& results) {
     auto view = results | std::views::take(MAX_RESULTS);
     results_.assign(view.begin(), view.end());
+    section_ends_.assign(1, results_.size());
     selected_index_ = results_.empty() ? -1 : 0;
+    search_in_progress_ = false;
+    search_due_time_ = -1.0;
+}
+
+void SearchResultsWidget::appendResults(const std::vector<Domain::Search::MapSearchResult>& results,
+                                        size_t section) {
+    if (results.empty()) return;
+    if (section_ends_.size() <= section) {
+        section_ends_.resize(section + 1, results_.size());
+    }
+
+    // Insert at the end of the section; later sections move down and the
+    // overflow past MAX_RESULTS is cut from the last ones
+    const size_t at = section_ends_[section];
+    if (at >= MAX_RESULTS) return;
+    const size_t count = std::min(results.size(), MAX_RESULTS - at);
+    results_.insert(results_.begin() + at, results.begin(), results.begin() + count);
+    for (size_t i = section; i < section_ends_.size(); ++i) {
+        section_ends_[i] = std::min(section_ends_[i] + count, MAX_RESULTS);
+    }
+    if (results_.size() > MAX_RESULTS) {
+        results_.resize(MAX_RESULTS);
+    }
+
+    if (selected_index_ < 0) {
+        selected_index_ = 0;
+    } else if (static_cast<size_t>(selected_index_) >= at) {
+        // Keep the same result selected
+        selected_index_ = static_cast<int>(
+            std::min(static_cast<size_t>(selected_index_) + count, results_.size() - 1));
+    }
+}
+
+void SearchResultsWidget::setSearchProgress(bool in_progress, float progress) {
+    search_in_progress_ = in_progress;
+    search_progress_ = progress;
 }
 
 void SearchResultsWidget::clear() {
     results_.clear();
+    section_ends_.clear();
+    search_due_time_ = -1.0;
     selected_index_ = -1;
     search_buffer_[0] = '\0';
+    if (search_in_progress_ && on_search_request_) {
+        on_search_request_({}, search_items_, search_creatures_);
+    }
+    search_in_progress_ = false;
 }
 
 void SearchResultsWidget::render(bool* p_open) {
@@ -39,12 +81,24 @@ void SearchResultsWidget::render(bool* p_open) {
         float icon_button_width = 30.0f;
         float adv_button_width = 45.0f;
         ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x - icon_button_width - adv_button_width - 16);
-        bool enter_pressed = ImGui::InputTextWithHint(
+        // Search as you type: the async search restarts once typing pauses,
+        // so a burst of keystrokes starts (and cancels) one job, not one each
+        bool text_changed = ImGui::InputTextWithHint(
             "##SearchInput", "Name or ID...",
-            search_buffer_, sizeof(search_buffer_),
-            ImGuiInputTextFlags_EnterReturnsTrue
+            search_buffer_, sizeof(search_buffer_)
         );
+        bool enter_pressed = ImGui::IsItemFocused() && ImGui::IsKeyPressed(ImGuiKey_Enter);
         ImGui::PopItemWidth();
+        if (text_changed) {
+            if (std::string_view(search_buffer_).empty()) {
+                doSearch();  // Cancel right away
+            } else {
+                search_due_time_ = ImGui::GetTime() + Config::Input::SEARCH_DEBOUNCE_SECONDS;
+            }
+        }
+        if (search_due_time_ >= 0.0 && ImGui::GetTime() >= search_due_time_) {
+            doSearch();
+        }
 
         // Clear button if text exists, otherwise Paste button
         if (!std::string_view(search_buffer_).empty()) {
@@ -81,6 +135,7 @@ void SearchResultsWidget::render(bool* p_open) {
         ImGui::PushStyleColor(ImGuiCol_Button, search_items_ ? active_color : normal_color);
         if (ImGui::Button(ICON_FA_CUBE " Items")) {
             search_items_ = !search_items_;
+            doSearch();
         }
         Utils::SetTooltipOnHover("Include items in search results");
         ImGui::PopStyleColor();
@@ -90,6 +145,7 @@ void SearchResultsWidget::render(bool* p_open) {
         ImGui::PushStyleColor(ImGuiCol_Button, search_creatures_ ? active_color : normal_color);
         if (ImGui::Button(ICON_FA_DRAGON " Creatures")) {
             search_creatures_ = !search_creatures_;
+            doSearch();
         }
         Utils::SetTooltipOnHover("Include creatures in search results");
         ImGui::PopStyleColor();
@@ -103,7 +159,9 @@ void SearchResultsWidget::render(bool* p_open) {
             // New Empty State Logic
             bool is_search_active = !std::string_view(search_buffer_).empty();
             const char* icon = is_search_active ? ICON_FA_CIRCLE_EXCLAMATION : ICON_FA_KEYBOARD;
-            const char* text = is_search_active ? "No results found" : "Type to search...";
+            const char* text = is_search_active
+                ? (search_in_progress_ ? "Searching..." : "No results found")
+                : "Type to search...";
 
             // Center text
             ImVec2 window_size = ImGui::GetWindowSize();
@@ -179,6 +237,9 @@ void SearchResultsWidget::render(bool* p_open) {
         if (results_.size() >= MAX_RESULTS) {
             ImGui::SameLine();
             ImGui::TextDisabled("(limit reached)");
+        } else if (search_in_progress_) {
+            ImGui::SameLine();
+            ImGui::TextDisabled(ICON_FA_SPINNER " searching %d%%", static_cast<int>(search_progress_ * 100.0f));
         }
     }
     ImGui::End();
@@ -190,20 +251,18 @@ void SearchResultsWidget::renderPreview(const Domain::Search::MapSearchResult& r
     if (result.isItem() && sprite_manager_ && client_data_) {
         // Item sprite - size based on item dimensions
         auto* item_type = client_data_->getItemTypeByServerId(result.item_id);
-        if (item_type) {
-            if (auto* texture = Utils::GetItemPreview(*sprite_manager_, item_type)) {
-                // Dynamic size: max(width, height) * 32
-                float preview_size = static_cast<float>(std::max(item_type->width, item_type->height) * 32);
-                ImGui::Image((void*)(intptr_t)texture->id(), ImVec2(preview_size, preview_size));
-                rendered = true;
-            }
+        if (auto thumb = Utils::GetItemThumbnail(*sprite_manager_, item_type)) {
+            ImGui::Image(reinterpret_cast<void*>(static_cast<intptr_t>(thumb.texture_id)),
+                         ImVec2(thumb.size, thumb.size),
+                         ImVec2(thumb.u_min, thumb.v_min), ImVec2(thumb.u_max, thumb.v_max));
+            rendered = true;
         }
     } else if (result.isCreature() && sprite_manager_ && client_data_) {
-        // Creature outfit sprite using helper
-        auto preview = Utils::GetCreaturePreview(*client_data_, *sprite_manager_, result.creature_name);
-        if (preview && preview.texture) {
-            float preview_size = preview.size;
-            ImGui::Image((void*)(intptr_t)preview.texture->id(), ImVec2(preview_size, preview_size));
+        // Creature outfit sprite from the thumbnail atlas
+        if (auto thumb = Utils::GetCreatureThumbnail(*client_data_, *sprite_manager_, result.creature_name)) {
+            ImGui::Image(reinterpret_cast<void*>(static_cast<intptr_t>(thumb.texture_id)),
+                         ImVec2(thumb.size, thumb.size),
+                         ImVec2(thumb.u_min, thumb.v_min), ImVec2(thumb.u_max, thumb.v_max));
             rendered = true;
         }
     }
@@ -216,41 +275,20 @@ void SearchResultsWidget::renderPreview(const Domain::Search::MapSearchResult& r
 
 void SearchResultsWidget::doSearch() {
     results_.clear();
+    section_ends_.clear();
     selected_index_ = -1;
+    search_due_time_ = -1.0;
+    search_in_progress_ = false;
     
-    if (!search_service_ || std::string_view(search_buffer_).empty()) {
+    if (!on_search_request_) {
         return;
     }
     
+    // Empty query still goes through so the controller cancels the running job
     std::string query = search_buffer_;
-    
-    auto name_results = search_service_->search(
-        query, Services::MapSearchMode::ByName,
-        search_items_, search_creatures_, MAX_RESULTS);
-    
-    bool is_number = !query.empty() && std::all_of(query.begin(), query.end(), ::isdigit);
-    
-    auto append_results = [&](const auto& source) {
-        if (results_.size() >= MAX_RESULTS) return;
-        auto needed = MAX_RESULTS - results_.size();
-        std::ranges::copy(source | std::views::take(needed), std::back_inserter(results_));
-    };
-
-    if (is_number) {
-        auto server_results = search_service_->search(
-            query, Services::MapSearchMode::ByServerId,
-            search_items_, false, MAX_RESULTS);
-        auto client_results = search_service_->search(
-            query, Services::MapSearchMode::ByClientId,
-            search_items_, false, MAX_RESULTS);
-        
-        append_results(server_results);
-        append_results(client_results);
-    }
-    
-    append_results(name_results);
-    
-    selected_index_ = results_.empty() ? -1 : 0;
+    search_in_progress_ = !query.empty();
+    search_progress_ = 0.0f;
+    on_search_request_(query, search_items_, search_creatures_);
 }
 
 } // namespace MapEditor::UI
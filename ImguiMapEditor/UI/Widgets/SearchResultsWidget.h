@@ -10,18 +10,24 @@ namespace Services {
     class SpriteManager; 
     class ClientDataService;
 }
-namespace Services { class MapSearchService; }
 
 namespace UI {
 
 /**
  * Dockable widget for searching items/creatures on the map.
  * Smart search: auto-detects name vs ID, searches all modes.
+ * Searching is asynchronous: the widget emits search requests as the query
+ * changes and receives results in batches from SearchController.
  */
 class SearchResultsWidget {
 public:
     using NavigateCallback = std::function<void(const Domain::Position&)>;
     using OpenAdvancedSearchCallback = std::function<void()>;
+    // Empty query cancels the running search
+    using SearchRequestCallback = std::function<void(const std::string& query,
+                                                     bool search_items, bool search_creatures)>;
+    
+    static constexpr size_t MAX_RESULTS = 1000;
     
     SearchResultsWidget();
     ~SearchResultsWidget() = default;
@@ -32,11 +38,26 @@ public:
     
     void setSpriteManager(Services::SpriteManager* sprites) { sprite_manager_ = sprites; }
     void setClientData(Services::ClientDataService* data) { client_data_ = data; }
-    void setMapSearchService(Services::MapSearchService* service) { search_service_ = service; }
+    void setSearchRequestCallback(SearchRequestCallback cb) { on_search_request_ = std::move(cb); }
     void setNavigateCallback(NavigateCallback cb) { on_navigate_ = std::move(cb); }
     void setOpenAdvancedSearchCallback(OpenAdvancedSearchCallback cb) { on_open_advanced_search_ = std::move(cb); }
     
     void setResults(const std::vector<Domain::Search::MapSearchResult>& results);
+    
+    /**
+     * Append a batch from the running async search (clamped to MAX_RESULTS).
+     * Results are kept grouped by section in ascending order, so a batch for
+     * section 0 (ID matches) lands before any section 1 (name) results.
+     */
+    void appendResults(const std::vector<Domain::Search::MapSearchResult>& results,
+                       size_t section = 0);
+    
+    /**
+     * Update async search state shown in the footer.
+     */
+    void setSearchProgress(bool in_progress, float progress = 0.0f);
+    bool isSearchInProgress() const { return search_in_progress_; }
+    
     void clear();
     size_t getResultCount() const { return results_.size(); }
     
@@ -48,18 +69,20 @@ private:
     
     Services::SpriteManager* sprite_manager_ = nullptr;
     Services::ClientDataService* client_data_ = nullptr;
-    Services::MapSearchService* search_service_ = nullptr;
     NavigateCallback on_navigate_;
     OpenAdvancedSearchCallback on_open_advanced_search_;
+    SearchRequestCallback on_search_request_;
     
     char search_buffer_[256] = {};
     bool search_items_ = true;
     bool search_creatures_ = true;
     
     std::vector<Domain::Search::MapSearchResult> results_;
+    std::vector<size_t> section_ends_;  // End index of each result section
     int selected_index_ = -1;
-    
-    static constexpr size_t MAX_RESULTS = 1000;
+    bool search_in_progress_ = false;
+    float search_progress_ = 0.0f;
+    double search_due_time_ = -1.0;  // Debounced search-as-you-type, < 0 if none
 };
 
 } // namespace UI
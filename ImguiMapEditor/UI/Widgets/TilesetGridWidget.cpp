@@ -15,7 +15,6 @@
 #include "../../Brushes/Types/CreatureBrush.h"
 #include "../../Brushes/Types/RawBrush.h"
 #include "../../Domain/ItemType.h"
-#include "../../Rendering/Core/Texture.h"
 #include "../../Services/AppSettings.h"
 #include "../../Services/ClientDataService.h"
 #include "../../Services/SpriteManager.h"
@@ -57,32 +56,44 @@ void TilesetGridWidget::setTileset(const std::string &tilesetName) {
   }
 }
 
-void *TilesetGridWidget::getBrushTextureId(const Brushes::IBrush *brush) const {
+Services::ThumbnailHandle
+TilesetGridWidget::getBrushThumbnail(const Brushes::IBrush *brush) {
   if (!clientData_ || !spriteManager_ || !brush) {
-    return nullptr;
+    return {};
   }
 
-  // Try RawBrush first
-  if (auto *rawBrush = dynamic_cast<const Brushes::RawBrush *>(brush)) {
-    const auto *itemType = clientData_->getItemTypeByServerId(
-        static_cast<uint16_t>(rawBrush->getItemId()));
-    if (auto *tex = Utils::GetItemPreview(*spriteManager_, itemType)) {
-      return reinterpret_cast<void *>(static_cast<uintptr_t>(tex->id()));
+  auto [it, inserted] = thumbnailSources_.try_emplace(brush);
+  ThumbnailSource &source = it->second;
+  if (inserted) {
+    if (auto *rawBrush = dynamic_cast<const Brushes::RawBrush *>(brush)) {
+      source.itemType = clientData_->getItemTypeByServerId(
+          static_cast<uint16_t>(rawBrush->getItemId()));
+    } else if (auto *creatureBrush =
+                   dynamic_cast<const Brushes::CreatureBrush *>(brush)) {
+      source.outfit = &creatureBrush->getOutfit();
     }
   }
-  // Try CreatureBrush - use existing utility
-  else if (auto *creatureBrush =
-               dynamic_cast<const Brushes::CreatureBrush *>(brush)) {
-    const auto &outfit = creatureBrush->getOutfit();
-    auto preview =
-        Utils::GetCreaturePreview(*clientData_, *spriteManager_, outfit);
-    if (preview.texture) {
-      return reinterpret_cast<void *>(
-          static_cast<uintptr_t>(preview.texture->id()));
-    }
+
+  if (source.itemType) {
+    return Utils::GetItemThumbnail(*spriteManager_, source.itemType);
   }
+  if (source.outfit) {
+    return Utils::GetCreatureThumbnail(*clientData_, *spriteManager_,
+                                       *source.outfit);
+  }
+  return {};
+}
 
-  return nullptr;
+void TilesetGridWidget::drawBrushThumbnail(const Brushes::IBrush *brush,
+                                           const ImVec2 &min,
+                                           const ImVec2 &max) {
+  const Services::ThumbnailHandle thumb = getBrushThumbnail(brush);
+  if (thumb) {
+    ImGui::GetWindowDrawList()->AddImage(
+        reinterpret_cast<void *>(static_cast<uintptr_t>(thumb.texture_id)),
+        min, max, ImVec2(thumb.u_min, thumb.v_min),
+        ImVec2(thumb.u_max, thumb.v_max));
+  }
 }
 
 void TilesetGridWidget::render() {
@@ -145,6 +156,7 @@ void TilesetGridWidget::renderFilterInput() {
 }
 
 void TilesetGridWidget::applyFilter() {
+  thumbnailSources_.clear();
   if (!tilesetRegistry_) {
     filteredEntries_.clear();
     return;
@@ -288,11 +300,10 @@ void TilesetGridWidget::renderBrushGrid() {
       ImVec2 tileSize(getIconSize(), getIconSize());
       ImVec2 cursorPos = ImGui::GetCursorScreenPos();
 
-      void *textureId = getBrushTextureId(brush);
-
       ImGui::InvisibleButton("##tile", tileSize);
       bool isHovered = ImGui::IsItemHovered();
       bool isClicked = ImGui::IsItemClicked();
+      bool isVisible = ImGui::IsItemVisible();
 
       ImDrawList *dl = ImGui::GetWindowDrawList();
 
@@ -303,10 +314,10 @@ void TilesetGridWidget::renderBrushGrid() {
           cursorPos, ImVec2(cursorPos.x + tileSize.x, cursorPos.y + tileSize.y),
           bgColor);
 
-      // Sprite
-      if (textureId) {
-        dl->AddImage(
-            textureId, cursorPos,
+      // Sprite (off-screen cells would only queue compositing work)
+      if (isVisible) {
+        drawBrushThumbnail(
+            brush, cursorPos,
             ImVec2(cursorPos.x + tileSize.x, cursorPos.y + tileSize.y));
       }
 
@@ -409,12 +420,11 @@ void TilesetGridWidget::renderBrushGrid() {
       ImVec2 tileSize(getIconSize(), getIconSize());
       ImVec2 cursorPos = ImGui::GetCursorScreenPos();
 
-      void *textureId = getBrushTextureId(brush);
-
       // Drag source
       ImGui::InvisibleButton("##tile", tileSize);
       bool isHovered = ImGui::IsItemHovered();
       bool isClicked = ImGui::IsItemClicked();
+      bool isVisible = ImGui::IsItemVisible();
       bool isSelected = selectedIndices_.count(static_cast<int>(entryIdx)) > 0;
 
       // Scroll to this brush if it's the target
@@ -464,10 +474,10 @@ void TilesetGridWidget::renderBrushGrid() {
           cursorPos, ImVec2(cursorPos.x + tileSize.x, cursorPos.y + tileSize.y),
           bgColor);
 
-      // Sprite
-      if (textureId) {
-        dl->AddImage(
-            textureId, cursorPos,
+      // Sprite (off-screen cells would only queue compositing work)
+      if (isVisible) {
+        drawBrushThumbnail(
+            brush, cursorPos,
             ImVec2(cursorPos.x + tileSize.x, cursorPos.y + tileSize.y));
       }
 
@@ -2,6 +2,7 @@
 #include "../../Brushes/BrushRegistry.h"
 #include "../../Domain/Tileset/Tileset.h"
 #include "../../Domain/Tileset/TilesetRegistry.h"
+#include "../../Services/ThumbnailAtlas.h"
 #include <cstdint>
 #include <functional>
 #include <set>
@@ -10,12 +11,19 @@
 #include <utility>
 #include <vector>
 
+struct ImVec2;
+
 namespace MapEditor::Services {
 struct AppSettings;
 }
 
 namespace MapEditor {
 
+namespace Domain {
+class ItemType;
+struct Outfit;
+} // namespace Domain
+
 namespace Services {
 class ClientDataService;
 class SpriteManager;
@@ -173,10 +181,16 @@ private:
   void applyFilter();
 
   /**
-   * Get OpenGL texture ID for a brush (RawBrush or CreatureBrush).
-   * Uses PreviewUtils for consistent texture retrieval.
+   * Get the atlas thumbnail for a brush (RawBrush or CreatureBrush).
+   * The brush type is resolved once and cached in thumbnailSources_.
    */
-  void *getBrushTextureId(const Brushes::IBrush *brush) const;
+  Services::ThumbnailHandle getBrushThumbnail(const Brushes::IBrush *brush);
+
+  /**
+   * Draw a brush thumbnail into a grid cell.
+   */
+  void drawBrushThumbnail(const Brushes::IBrush *brush, const ImVec2 &min,
+                          const ImVec2 &max);
 
   // Services (non-owning)
   Services::ClientDataService *clientData_ = nullptr;
@@ -230,6 +244,15 @@ private:
   std::set<int> selectedIndices_;
   int lastClickedIndex_ = -1; // For shift-click range select
 
+  // What to draw for each brush, resolved on first draw. Cleared with the
+  // filtered entries since brush pointers change when brushes reload.
+  struct ThumbnailSource {
+    const Domain::ItemType *itemType = nullptr;
+    const Domain::Outfit *outfit = nullptr;
+  };
+  std::unordered_map<const Brushes::IBrush *, ThumbnailSource>
+      thumbnailSources_;
+
   // Collapsed sections state (key = original entry index of separator)
   std::unordered_map<size_t, bool> collapsedSections_;
 
@@ -287,7 +287,9 @@ void BrowseTileWindow::render(bool *p_visible) {
       property_renderer_.setContext(selected_item, spawn, creature,
                                     otbm_version, sprite_manager_,
                                     map_ ? map_->getWidth() : 65535,
-                                    map_ ? map_->getHeight() : 65535, map_);
+                                    map_ ? map_->getHeight() : 65535, map_,
+                                    map_ ? map_->getTile(current_pos_)
+                                         : nullptr);
 
       // Show panel header if something is selected
       if (selected_item || spawn || creature) {
@@ -0,0 +1,16 @@
+#version 330 core
+
+in vec2 TexCoord;
+flat in float Layer;
+
+out vec4 FragColor;
+
+uniform sampler2DArray uImpostors;
+
+void main() {
+    // Impostor texels are alpha-premultiplied
+    vec4 color = texture(uImpostors, vec3(TexCoord, Layer));
+    if (color.a < 0.01)
+        discard;
+    FragColor = color;
+}
@@ -0,0 +1,32 @@
+#version 330 core
+
+// Per-vertex attributes (unit quad)
+layout (location = 0) in vec2 aPos;       // 0,0 to 1,1
+layout (location = 1) in vec2 aTexCoord;  // 0,0 to 1,1
+
+// Per-instance attributes
+layout (location = 2) in vec3 aRect;      // x, y (top-left), size
+layout (location = 3) in uint aCell;      // page * cellsPerPage + index
+
+out vec2 TexCoord;
+flat out float Layer;
+
+uniform mat4 uMVP;
+uniform int uCellsPerRow;
+uniform int uCellsPerPage;
+uniform float uCellUV;      // Cell size in texture coordinates
+uniform float uHalfTexel;   // Inset that keeps filtering inside the cell
+
+void main() {
+    vec2 pos = aRect.xy + aPos * aRect.z;
+    gl_Position = uMVP * vec4(pos, 0.0, 1.0);
+
+    int cell = int(aCell);
+    int index = cell % uCellsPerPage;
+    vec2 cellMin = vec2(index % uCellsPerRow, index / uCellsPerRow) * uCellUV;
+
+    // Texture row 0 holds the top of the cell (see ChunkImpostorRenderer)
+    vec2 inset = vec2(uHalfTexel);
+    TexCoord = mix(cellMin + inset, cellMin + vec2(uCellUV) - inset, aTexCoord);
+    Layer = float(cell / uCellsPerPage);
+}
@@ -6,9 +6,14 @@ layout (location = 1) in vec2 aTexCoord;  // 0,0 to 1,1
 
 // Per-instance attributes
 layout (location = 2) in vec4 aRect;      // x, y, w, h
-layout (location = 3) in vec4 aUV;        // u_min, v_min, u_max, v_max
-layout (location = 4) in vec4 aTint;      // r, g, b, a
-layout (location = 5) in float aLayer;    // texture array layer
+layout (location = 3) in uint aSlot;      // atlas slot (AtlasRegion::slot)
+layout (location = 4) in vec4 aTint;      // r, g, b, a (RGBA8, normalized)
+
+// Atlas grid, must match Config::Rendering
+const uint SPRITES_PER_ROW = 128u;
+const uint SPRITES_PER_LAYER = SPRITES_PER_ROW * SPRITES_PER_ROW;
+const float CELL_UV = 32.0 / 4096.0;
+const float HALF_TEXEL = 0.5 / 4096.0;
 
 out vec2 TexCoord;
 out vec4 Tint;
@@ -21,8 +26,16 @@ void main() {
     vec2 pos = aRect.xy + aPos * aRect.zw;
     gl_Position = uMVP * vec4(pos, 0.0, 1.0);
     
+    // Resolve the slot to its atlas cell (same half-texel inset as
+    // TextureAtlas::makeRegion)
+    uint cell = aSlot % SPRITES_PER_LAYER;
+    vec2 cell_min = vec2(float(cell % SPRITES_PER_ROW),
+                         float(cell / SPRITES_PER_ROW)) * CELL_UV;
+    vec2 uv_min = cell_min + HALF_TEXEL;
+    vec2 uv_max = cell_min + CELL_UV - HALF_TEXEL;
+
     // Interpolate UV within the atlas region
-    TexCoord = mix(aUV.xy, aUV.zw, aTexCoord);
+    TexCoord = mix(uv_min, uv_max, aTexCoord);
     Tint = aTint;
-    Layer = aLayer;
+    Layer = float(aSlot / SPRITES_PER_LAYER);
 }
@@ -6,9 +6,9 @@ layout (location = 0) in vec2 aPos;       // 0,0 to 1,1
 layout (location = 1) in vec2 aTexCoord;  // 0,0 to 1,1
 
 // Per-instance attributes (TileInstance format)
-layout (location = 2) in vec4 aRect;      // x, y, w, h
+layout (location = 2) in vec3 aRect;      // x, y (relative to uOrigin), size
 layout (location = 3) in uint aSpriteId;  // Sprite ID for LUT lookup
-layout (location = 4) in vec4 aTint;      // r, g, b, a
+layout (location = 4) in vec4 aTint;      // r, g, b, a (RGBA8, normalized)
 layout (location = 5) in uint aFlags;     // Animation frame, selection state
 
 // Sprite LUT entry structure (matches SpriteAtlasLUT::Entry)
@@ -34,10 +34,11 @@ flat out float Layer;
 flat out float Valid;
 
 uniform mat4 uMVP;
+uniform vec2 uOrigin;   // Chunk origin the instance positions are relative to
 
 void main() {
     // Transform unit quad to screen position
-    vec2 pos = aRect.xy + aPos * aRect.zw;
+    vec2 pos = uOrigin + aRect.xy + aPos * aRect.z;
     gl_Position = uMVP * vec4(pos, 0.0, 1.0);
 
     // Lookup UV from sprite LUT